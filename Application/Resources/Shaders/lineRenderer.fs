@@ -4,5 +4,5 @@ out vec4 FragColor;
 in vec4 Colour;
 
 void main() {
-    FragColor = vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    FragColor = Colour;
 }
\ No newline at end of file
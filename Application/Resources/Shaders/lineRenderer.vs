@@ -1,9 +1,17 @@
 #version 440 core
 layout (location = 0) in vec3 aPosition;
+layout (location = 1) in vec3 aColour;
 
-uniform mat4 view;
-uniform mat4 projection;
+out vec4 Colour;
+
+// Written once a frame by the framework and shared by every shader that draws in the scene.
+layout (std140, binding = 0) uniform Camera
+{
+    mat4 projection;
+    mat4 view;
+};
 
 void main() {
     gl_Position = projection * view * vec4(aPosition, 1.0f);
+    Colour = vec4(aColour, 1.0f);
 }
\ No newline at end of file
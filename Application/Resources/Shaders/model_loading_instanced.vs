@@ -0,0 +1,21 @@
+#version 440 core
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aNormal;
+layout (location = 2) in vec2 aTexCoords;
+// Each instance's model matrix, streamed from a buffer and taking up locations 5 to 8.
+layout (location = 5) in mat4 aInstanceModel;
+
+out vec2 TexCoords;
+
+// Written once a frame by the framework and shared by every shader that draws in the scene.
+layout (std140, binding = 0) uniform Camera
+{
+    mat4 projection;
+    mat4 view;
+};
+
+void main()
+{
+    TexCoords = aTexCoords;    
+    gl_Position = projection * view * aInstanceModel * vec4(aPos, 1.0);
+}
\ No newline at end of file
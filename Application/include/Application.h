@@ -7,12 +7,18 @@
 #define APPLICATION_H
 
 // Header includes.
+#include <atomic>
 #include "glm/ext.hpp"
+#include <mutex>
+#include "Scene.h"
+#include "SceneSnapshot.h"
+#include <thread>
+#include "TripleBuffer.h"
 
 // Forward declarations.
 class Entity;
 class Framework;
-class Scene;
+class Frustum;
 class TransformComponent;
 class UserInterface;
 
@@ -21,7 +27,18 @@ class UserInterface;
 /// </summary>
 class Application {
 public:
-	Application();
+	/// <summary>
+	/// Creates the application and fills its scene with boids.
+	/// </summary>
+	/// <param name="a_spatialIndexType"> The kind of spatial index that the scene uses to keep track of its
+	/// entities. </param>
+	/// <param name="a_bUseFlockSystem"> True if the boids should be moved together by a flock system, rather than
+	/// each one by its own brain component. </param>
+	/// <param name="a_bThreadedSimulation"> True if the scene should be simulated on its own thread while the
+	/// previous snapshots of it are drawn, rather than being updated and drawn in turn. </param>
+	Application(Scene::SPATIAL_INDEX_TYPE a_spatialIndexType = Scene::SPATIAL_INDEX_TYPE_OCT_TREE,
+		bool a_bUseFlockSystem = true,
+		bool a_bThreadedSimulation = true);
 	~Application();
 
 	/// <summary>
@@ -67,10 +84,43 @@ public:
 
 	inline unsigned int GetBoidCount() const;
 	inline unsigned int GetMaximumBoidCount() const;
+	/// <summary>
+	/// Returns the scene that the application's entities are simulated within.
+	/// </summary>
+	/// <returns> A pointer to the application's scene. </returns>
+	inline Scene* GetScene() const;
 	inline bool GetPauseState() const;
 	inline bool GetUpdateOnceState() const;
+	/// <summary>
+	/// Returns the number of entities, or models when the simulation is threaded, that were drawn last frame.
+	/// </summary>
+	unsigned int GetDrawnEntityCount() const;
+	/// <summary>
+	/// Returns the number of entities, or models when the simulation is threaded, that were outside of the camera's
+	/// view last frame.
+	/// </summary>
+	unsigned int GetCulledEntityCount() const;
 
 private:
+	/// <summary>
+	/// Steps the scene through the time that has passed, unless the application is paused. While paused, the scene
+	/// takes a single step if the user asked for one.
+	/// </summary>
+	/// <param name="a_fFrameTime"> The amount of time (in seconds) that has passed since the scene was last
+	/// updated. </param>
+	void UpdateScene(float a_fFrameTime);
+	/// <summary>
+	/// Repeatedly updates the scene and publishes a snapshot of it, until the application stops running.
+	/// Runs on the simulation thread.
+	/// </summary>
+	void Simulate();
+	/// <summary>
+	/// Draws the newest snapshot of the scene, with each model moved back towards where it was in the snapshot before
+	/// so that it moves smoothly between simulation steps.
+	/// </summary>
+	/// <param name="a_rViewFrustum"> The volume of space that the camera can see. </param>
+	void DrawSnapshots(const Frustum& a_rViewFrustum);
+
 	/// <summary>
 	/// The current number of boids that exist within the application.
 	/// </summary>
@@ -92,6 +142,11 @@ private:
 	/// True if the user has spawned an obstacle for the boids to avoid collisions with.
 	/// </summary>
 	bool m_bSpawnedObstacle;
+	const bool mc_bThreadedSimulation;
+	/// <summary>
+	/// Cleared to tell the simulation thread to stop.
+	/// </summary>
+	std::atomic<bool> m_bSimulating;
 	/// <summary>
 	/// A pointer to the program that's responsible for drawing the majority of the application.
 	/// </summary>
@@ -105,6 +160,29 @@ private:
 	/// A 3D world space cursor.
 	/// </summary>
 	Entity* m_pWorldCursor;
+	/// <summary>
+	/// Updates the scene while the main thread draws it, when the simulation is threaded.
+	/// </summary>
+	std::thread m_simulationThread;
+	/// <summary>
+	/// Held by the simulation thread while it updates the scene, and by the main thread while it changes the scene
+	/// through input or the user interface.
+	/// </summary>
+	std::mutex m_sceneMutex;
+	/// <summary>
+	/// Hands snapshots of the scene from the simulation thread to the main thread.
+	/// </summary>
+	TripleBuffer<SceneSnapshot> m_snapshots;
+	/// <summary>
+	/// A copy of the last snapshot that the simulation thread published, which the next snapshot takes its models'
+	/// previous positions from. Only used by the simulation thread.
+	/// </summary>
+	SceneSnapshot m_previousSnapshot;
+	/// <summary>
+	/// The number of models that were drawn from the last snapshot, and the number that were culled.
+	/// </summary>
+	unsigned int m_uiDrawnModelCount;
+	unsigned int m_uiCulledModelCount;
 };
 
 unsigned int Application::GetBoidCount() const {
@@ -115,6 +193,10 @@ unsigned int Application::GetMaximumBoidCount() const {
 	return mc_uiMaximumBoidCount;
 }
 
+Scene* Application::GetScene() const {
+	return m_pScene;
+}
+
 bool Application::GetPauseState() const {
 	return m_bPaused;
 }
@@ -0,0 +1,135 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+#ifndef ARCHETYPE_H
+#define ARCHETYPE_H
+
+// Header includes.
+#include "Component.h"
+#include "Entity.h"
+#include "StaggeredSchedule.h"
+#include <vector>
+
+/// <summary>
+/// Stores every entity in a scene that has the same set of components, with a column of each type of component that
+/// they have. Row i of every column belongs to the archetype's i-th entity, so a system can run over the entities'
+/// components in turn without looking any of them up. The columns only hold pointers to the components, which stay
+/// in the scene's component pools because colliders keep pointers into their transforms. The components are only
+/// laid out in row order as far as they were created in that order, so the archetype saves the lookups and virtual
+/// calls rather than cache misses.
+/// </summary>
+class Archetype {
+public:
+	/// <summary>
+	/// Creates an archetype without any entities.
+	/// </summary>
+	/// <param name="a_signature"> The set of component types that the archetype's entities have. </param>
+	Archetype(ComponentSignature a_signature);
+	~Archetype() {}
+
+	/// <summary>
+	/// Adds an entity to the end of the archetype, along with each of its components.
+	/// </summary>
+	/// <param name="a_pEntity"> The entity to add, which must have the archetype's signature. </param>
+	/// <returns> The row that the entity was added to. </returns>
+	unsigned int AddEntity(Entity* a_pEntity);
+	/// <summary>
+	/// Removes an entity by moving the archetype's last entity into its row, so the columns don't leave gaps.
+	/// </summary>
+	/// <param name="a_uiRow"> The row of the entity to remove. </param>
+	/// <returns> The entity that was moved into the row, or null if the removed entity was the last one. </returns>
+	Entity* RemoveEntity(unsigned int a_uiRow);
+	/// <summary>
+	/// Updates every component of one type in the archetype, in row order, if the archetype's entities have the type.
+	/// </summary>
+	/// <typeparam name="TComponent"> The type of component to update. Naming the final class, rather than
+	/// Component, lets the compiler call its update function directly. </typeparam>
+	/// <param name="a_componentType"> The column to update. </param>
+	/// <param name="a_fDeltaTime"> The amount of time (in seconds) to update the components by. </param>
+	template <typename TComponent>
+	inline void UpdateComponents(COMPONENT_TYPE a_componentType,
+		float a_fDeltaTime) const;
+	/// <summary>
+	/// Recalculates the expensive decisions of every component of one type whose entity is due to, in row order, if
+	/// the archetype's entities have the type.
+	/// </summary>
+	/// <typeparam name="TComponent"> The type of component to reevaluate. </typeparam>
+	/// <param name="a_componentType"> The column to reevaluate. </param>
+	/// <param name="a_rSchedule"> Decides which entities are due, by their IDs. </param>
+	/// <param name="a_uiTick"> The step being taken, counting from zero. </param>
+	template <typename TComponent>
+	inline void ReevaluateComponents(COMPONENT_TYPE a_componentType,
+		const StaggeredSchedule& a_rSchedule,
+		unsigned int a_uiTick) const;
+
+	inline bool HasComponentType(COMPONENT_TYPE a_componentType) const;
+	inline ComponentSignature GetSignature() const;
+	inline unsigned int GetEntityCount() const;
+	inline Entity* GetEntity(unsigned int a_uiRow) const;
+	/// <summary>
+	/// Returns every component of one type in the archetype, in the same order as its entities. Empty if the
+	/// archetype's entities don't have the type.
+	/// </summary>
+	inline const std::vector<Component*>& GetComponents(COMPONENT_TYPE a_componentType) const;
+
+private:
+	ComponentSignature m_signature;
+	std::vector<Entity*> m_entities;
+	/// <summary>
+	/// Pointers to the components of each type, indexed by type. Only the types in the signature have any.
+	/// </summary>
+	std::vector<Component*> m_columns[COMPONENT_TYPE_COUNT];
+};
+
+template <typename TComponent>
+void Archetype::UpdateComponents(COMPONENT_TYPE a_componentType,
+	float a_fDeltaTime) const {
+	if (!HasComponentType(a_componentType)) {
+		return;
+	}
+
+	for (Component* pComponent : m_columns[a_componentType]) {
+		static_cast<TComponent*>(pComponent)->Update(a_fDeltaTime);
+	}
+}
+
+template <typename TComponent>
+void Archetype::ReevaluateComponents(COMPONENT_TYPE a_componentType,
+	const StaggeredSchedule& a_rSchedule,
+	unsigned int a_uiTick) const {
+	if (!HasComponentType(a_componentType)) {
+		return;
+	}
+
+	const std::vector<Component*>& rColumn = m_columns[a_componentType];
+
+	for (unsigned int i = 0; i < rColumn.size(); ++i) {
+		if (a_rSchedule.IsDue(a_uiTick, m_entities[i]->GetID())) {
+			static_cast<TComponent*>(rColumn[i])->Reevaluate();
+		}
+	}
+}
+
+bool Archetype::HasComponentType(COMPONENT_TYPE a_componentType) const {
+	return (m_signature & Component::GetSignatureBit(a_componentType)) != 0;
+}
+
+ComponentSignature Archetype::GetSignature() const {
+	return m_signature;
+}
+
+unsigned int Archetype::GetEntityCount() const {
+	return m_entities.size();
+}
+
+Entity* Archetype::GetEntity(unsigned int a_uiRow) const {
+	return a_uiRow < m_entities.size() ? m_entities[a_uiRow] : nullptr;
+}
+
+const std::vector<Component*>& Archetype::GetComponents(COMPONENT_TYPE a_componentType) const {
+	return m_columns[a_componentType];
+}
+
+#endif // !ARCHETYPE_H
@@ -7,12 +7,14 @@
 #define BOUNDARY_H
 
 // Header includes.
-#include "Framework.h";
-#include "glad/glad.h"
+#include "BoundingBox.h"
+#include "DrawQueue.h"
 #include "glm/glm.hpp"
 
 /// <summary>
 /// Represents a volume of space with a central position.
+/// Boundaries are drawn by adding their edges to a draw queue's batch of lines, so they don't own any rendering
+/// resources and never call into OpenGL themselves.
 /// </summary>
 /// <typeparam name="TVector"> The type of vector that's used for storing the boundary's position and dimensions.
 /// Must be a complete type. </typeparam>
@@ -24,15 +26,16 @@ public:
 		TVector a_newDimensions);
 	Boundary(TVector* a_newPosition,
 		TVector a_newDimensions);
-	Boundary(TVector* a_newPosition,
-		TVector a_newDimensions,
-		bool a_stationary);
-	~Boundary();
+	~Boundary() {}
 
 	/// <summary>
-	/// Draws a line along each of the boundary's edges.
+	/// Adds a line along each of the boundary's edges to a draw queue's batch of lines, which are all drawn together
+	/// later in the frame.
 	/// </summary>
-	void Draw();
+	/// <param name="a_pDrawQueue"> The queue that draws the boundary's lines. </param>
+	/// <param name="a_rColour"> The lines' red, green, and blue colour values, from zero to one. </param>
+	void Draw(DrawQueue* a_pDrawQueue,
+		const TVector& a_rColour = TVector(1.0f)) const;
 	/// <summary>
 	/// Returns true if the specified position is located within the boundary.
 	/// </summary>
@@ -44,25 +47,20 @@ public:
 	/// </summary>
 	/// <param name="a_otherBoundary"> The other boundary to check against this. </param>
 	/// <returns> True if the two boundaries overlap. </returns>
-	bool Overlaps(Boundary<TVector> a_otherBoundary) const;
+	bool Overlaps(const Boundary<TVector>& a_rOtherBoundary) const;
 
 	inline void SetPosition(TVector* a_pNewPosition);
 	inline void SetDimensions(TVector a_newDimensions);
 
 	inline const TVector* GetPosition() const;
 	inline const TVector GetDimensions() const;
-	const Framework* GetRenderingFramework() const;
-
-private:
 	/// <summary>
-	/// Calculates where a boundary's vertices would be positioned.
+	/// Returns a copy of the boundary's current position and dimensions that doesn't track any later movement.
 	/// </summary>
-	/// <param name="a_pBoundaryPosition"> The boundary's central position. </param>
-	/// <param name="a_pBoundaryDimensions"> The boundary's width, height, and depth. </param>
-	void FindVertexPositions(TVector* a_pBoundaryPosition, TVector* a_pBoundaryDimensions);
-	void GenerateRenderingBuffers();
-	void FillRenderingBuffers();
+	/// <returns> The volume of space that the boundary currently covers. </returns>
+	inline BoundingBox<TVector> GetBoundingBox() const;
 
+private:
 	/// <summary>
 	/// The position at the centre of the boundary.
 	/// </summary>
@@ -71,88 +69,30 @@ private:
 	/// The width, height, and depth of the boundary as measured outward from its central position.
 	/// </summary>
 	TVector m_dimensions;
-
-	bool m_bStationary = true;
-
-	// Each boundary is a cube which means there's a maximum of 24 coordinates per boundary (3 per vertex).
-	/// <summary>
-	/// A collection of coordinates that make up each vertex of the boundary.
-	/// </summary>
-	float m_fVertexCoordinates[51];
-	unsigned int m_uiCoordinatesPerVertex = 3;
-	unsigned int m_uiCoordinatesCount = 0;
-	/// <summary>
-	/// Specifies the number of lines to draw for the scene's bounds.
-	/// </summary>
-	GLsizei m_iLineDrawCount = 0;
-	unsigned int linesVAO = 0;
-	unsigned int linesVBO = 0;
-
-	Framework* m_pRenderingFramework;
 };
 
 template <typename TVector>
 Boundary<TVector>::Boundary() : m_pPosition(new TVector(1.0f)),
-	m_dimensions(1.0f),
-	m_pRenderingFramework(Framework::GetInstance()) {
-	GenerateRenderingBuffers();
-	FindVertexPositions(m_pPosition, &m_dimensions);
-	FillRenderingBuffers();
-}
+	m_dimensions(1.0f) {}
 
 template <typename TVector>
 Boundary<TVector>::Boundary(TVector a_pPositionToCopy,
 	TVector a_newDimensions) : m_pPosition(new TVector(a_pPositionToCopy)),
-	m_dimensions(a_newDimensions),
-	m_pRenderingFramework(Framework::GetInstance()) {
-	GenerateRenderingBuffers();
-	FindVertexPositions(m_pPosition, &m_dimensions);
-	FillRenderingBuffers();
-}
+	m_dimensions(a_newDimensions) {}
 
 template <typename TVector>
 Boundary<TVector>::Boundary(TVector* a_newPosition,
 	TVector a_newDimensions) : m_pPosition(a_newPosition),
-	m_dimensions(a_newDimensions),
-	m_pRenderingFramework(Framework::GetInstance()) {
-	GenerateRenderingBuffers();
-	FindVertexPositions(m_pPosition, &m_dimensions);
-	FillRenderingBuffers();
-}
-
-template <typename TVector>
-Boundary<TVector>::Boundary(TVector* a_newPosition,
-	TVector a_newDimensions,
-	bool a_stationary) : m_pPosition(a_newPosition),
-	m_dimensions(a_newDimensions),
-	m_bStationary(a_stationary),
-	m_pRenderingFramework(Framework::GetInstance()) {
-	GenerateRenderingBuffers();
-	FindVertexPositions(m_pPosition, &m_dimensions);
-	FillRenderingBuffers();
-}
-
-template <typename TVector>
-Boundary<TVector>::~Boundary() {
-	glDeleteVertexArrays(1, &linesVAO);
-	glDeleteBuffers(1, &linesVBO);
-}
+	m_dimensions(a_newDimensions) {}
 
 template <typename TVector>
-void Boundary<TVector>::Draw() {
-	if (!m_pRenderingFramework || !m_fVertexCoordinates || m_uiCoordinatesCount == 0 || m_iLineDrawCount == 0) {
+void Boundary<TVector>::Draw(DrawQueue* a_pDrawQueue,
+	const TVector& a_rColour) const {
+	if (!a_pDrawQueue || !m_pPosition) {
 		return;
 	}
 
-	if (!m_bStationary) {
-		FindVertexPositions(m_pPosition, &m_dimensions);
-		FillRenderingBuffers();
-	}
-
-	m_pRenderingFramework->UseLineShader();
-	glBindVertexArray(linesVAO);
-	glDrawArrays(GL_LINE_STRIP, 0, m_iLineDrawCount);
-	glBindVertexArray(0);
+	a_pDrawQueue->AddLineBox(&m_pPosition->x, &m_dimensions.x, &a_rColour.x);
 }
 
 template <typename TVector>
@@ -172,16 +112,16 @@ bool Boundary<TVector>::Contains(const TVector& a_position) const {
 }
 
 template <typename TVector>
-bool Boundary<TVector>::Overlaps(Boundary a_otherBoundary) const {
+bool Boundary<TVector>::Overlaps(const Boundary<TVector>& a_rOtherBoundary) const {
 	// If the left extent of this boundary is further left than the other boundary's right extent, and.
 	// if the right extent of this boundary is further right than the other boundary's left extent then the 
 	// boundaries must overlap along that axis.
-	return (a_otherBoundary.GetPosition()->x - a_otherBoundary.GetDimensions().x <= m_pPosition->x + m_dimensions.x &&
-		a_otherBoundary.GetPosition()->x + a_otherBoundary.GetDimensions().x >= m_pPosition->x - m_dimensions.x &&
-		a_otherBoundary.GetPosition()->y - a_otherBoundary.GetDimensions().y <= m_pPosition->y + m_dimensions.y &&
-		a_otherBoundary.GetPosition()->y + a_otherBoundary.GetDimensions().y >= m_pPosition->y - m_dimensions.y &&
-		a_otherBoundary.GetPosition()->z - a_otherBoundary.GetDimensions().z <= m_pPosition->z + m_dimensions.z &&
-		a_otherBoundary.GetPosition()->z + a_otherBoundary.GetDimensions().z >= m_pPosition->z - m_dimensions.z);
+	return (a_rOtherBoundary.GetPosition()->x - a_rOtherBoundary.GetDimensions().x <= m_pPosition->x + m_dimensions.x &&
+		a_rOtherBoundary.GetPosition()->x + a_rOtherBoundary.GetDimensions().x >= m_pPosition->x - m_dimensions.x &&
+		a_rOtherBoundary.GetPosition()->y - a_rOtherBoundary.GetDimensions().y <= m_pPosition->y + m_dimensions.y &&
+		a_rOtherBoundary.GetPosition()->y + a_rOtherBoundary.GetDimensions().y >= m_pPosition->y - m_dimensions.y &&
+		a_rOtherBoundary.GetPosition()->z - a_rOtherBoundary.GetDimensions().z <= m_pPosition->z + m_dimensions.z &&
+		a_rOtherBoundary.GetPosition()->z + a_rOtherBoundary.GetDimensions().z >= m_pPosition->z - m_dimensions.z);
 }
 
 template <typename TVector>
@@ -205,125 +145,8 @@ const TVector Boundary<TVector>::GetDimensions() const {
 }
 
 template <typename TVector>
-const Framework* Boundary<TVector>::GetRenderingFramework() const {
-	return m_pRenderingFramework;
-}
-
-template <typename TVector>
-void Boundary<TVector>::FindVertexPositions(TVector* a_pBoundaryPosition, TVector* a_pBoundaryDimensions) {
-	memset(m_fVertexCoordinates, 0, sizeof(m_fVertexCoordinates));
-
-	if (!a_pBoundaryPosition || !a_pBoundaryDimensions) {
-		return;
-	}
-
-	const float half = 0.5f;
-	unsigned int coordinateIndex = 0;
-	// Left face.
-	// Top back left vertex.
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->x - a_pBoundaryDimensions->x;
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->y + a_pBoundaryDimensions->y;
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->z - a_pBoundaryDimensions->z;
-	// Top front left vertex.
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->x - a_pBoundaryDimensions->x;
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->y + a_pBoundaryDimensions->y;
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->z + a_pBoundaryDimensions->z;
-	// Bottom front left vertex.
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->x - a_pBoundaryDimensions->x;
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->y - a_pBoundaryDimensions->y;
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->z + a_pBoundaryDimensions->z;
-	// Bottom back left vertex.
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->x - a_pBoundaryDimensions->x;
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->y - a_pBoundaryDimensions->y;
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->z - a_pBoundaryDimensions->z;
-	// Back face.
-	// Bottom back right vertex.
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->x + a_pBoundaryDimensions->x;
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->y - a_pBoundaryDimensions->y;
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->z - a_pBoundaryDimensions->z;
-	// Top back right vertex.
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->x + a_pBoundaryDimensions->x;
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->y + a_pBoundaryDimensions->y;
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->z - a_pBoundaryDimensions->z;
-	// Top back left vertex.
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->x - a_pBoundaryDimensions->x;
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->y + a_pBoundaryDimensions->y;
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->z - a_pBoundaryDimensions->z;
-	// Bottom back left vertex.
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->x - a_pBoundaryDimensions->x;
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->y - a_pBoundaryDimensions->y;
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->z - a_pBoundaryDimensions->z;
-
-	// Connecting line.
-	// Bottom front left vertex.
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->x - a_pBoundaryDimensions->x;
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->y - a_pBoundaryDimensions->y;
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->z + a_pBoundaryDimensions->z;
-
-	// Front face.
-	// Bottom front right vertex.
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->x + a_pBoundaryDimensions->x;
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->y - a_pBoundaryDimensions->y;
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->z + a_pBoundaryDimensions->z;
-	// Bottom back right vertex.
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->x + a_pBoundaryDimensions->x;
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->y - a_pBoundaryDimensions->y;
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->z - a_pBoundaryDimensions->z;
-	// Top back right vertex.
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->x + a_pBoundaryDimensions->x;
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->y + a_pBoundaryDimensions->y;
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->z - a_pBoundaryDimensions->z;
-	// Top front right vertex.
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->x + a_pBoundaryDimensions->x;
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->y + a_pBoundaryDimensions->y;
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->z + a_pBoundaryDimensions->z;
-	// Right face.
-	// Top front left vertex.
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->x - a_pBoundaryDimensions->x;
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->y + a_pBoundaryDimensions->y;
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->z + a_pBoundaryDimensions->z;
-	// Bottom front left vertex.
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->x - a_pBoundaryDimensions->x;
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->y - a_pBoundaryDimensions->y;
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->z + a_pBoundaryDimensions->z;
-	// Bottom front right vertex.
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->x + a_pBoundaryDimensions->x;
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->y - a_pBoundaryDimensions->y;
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->z + a_pBoundaryDimensions->z;
-	// Top front right vertex.
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->x + a_pBoundaryDimensions->x;
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->y + a_pBoundaryDimensions->y;
-	m_fVertexCoordinates[coordinateIndex++] = a_pBoundaryPosition->z + a_pBoundaryDimensions->z;
-
-	m_uiCoordinatesCount = sizeof(m_fVertexCoordinates) / sizeof(float);
-	m_iLineDrawCount = sizeof(m_fVertexCoordinates) / sizeof(float) / m_uiCoordinatesPerVertex;
-}
-
-template <typename TVector>
-void Boundary<TVector>::GenerateRenderingBuffers() {
-	// Generate buffer objects.
-	glGenVertexArrays(1, &linesVAO);
-	glGenBuffers(1, &linesVBO);
-}
-
-template <typename TVector>
-void Boundary<TVector>::FillRenderingBuffers() {
-	// Bind a buffer object to fill with data.
-	glBindVertexArray(linesVAO);
-	GLenum bufferType = GL_ARRAY_BUFFER;
-	glBindBuffer(bufferType, linesVBO);
-
-	// Fill the vertex buffer object with the line's vertex data.
-	glBufferData(bufferType, sizeof(m_fVertexCoordinates), m_fVertexCoordinates, m_bStationary ? GL_STATIC_DRAW : GL_DYNAMIC_DRAW);
-	int vertexAttributeIndex = 0;
-	// Sets what type of vertices will be passed to the relevant vertex shader.
-	glVertexAttribPointer(vertexAttributeIndex, m_uiCoordinatesPerVertex, GL_FLOAT, GL_FALSE, m_uiCoordinatesPerVertex * sizeof(float), (void*)0);
-	glEnableVertexAttribArray(vertexAttributeIndex);
-
-	// Unbinds the vertex buffer object.
-	glBindBuffer(bufferType, 0);
-	// Unbinds the vertex array object.
-	glBindVertexArray(0);
+BoundingBox<TVector> Boundary<TVector>::GetBoundingBox() const {
+	return m_pPosition ? BoundingBox<TVector>(*m_pPosition, m_dimensions) : BoundingBox<TVector>();
 }
 
 #endif // !BOUNDARY_H
@@ -0,0 +1,109 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 17/10/2026
+//////////////////////////////
+
+#ifndef BOUNDING_BOX_H
+#define BOUNDING_BOX_H
+
+/// <summary>
+/// An axis-aligned volume of space with a central position.
+/// Unlike a boundary it only stores its own position and dimensions, so it can be created, copied, and compared
+/// without allocating any memory or rendering resources.
+/// </summary>
+/// <typeparam name="TVector"> The type of vector that's used for storing the box's position and dimensions.
+/// Must be a complete type. </typeparam>
+template <typename TVector>
+class BoundingBox {
+public:
+	BoundingBox();
+	/// <summary>
+	/// Creates a new bounding box.
+	/// </summary>
+	/// <param name="a_position"> The box's central position. </param>
+	/// <param name="a_dimensions"> The box's width, height, and depth as measured outward from its central position. </param>
+	BoundingBox(const TVector& a_position,
+		const TVector& a_dimensions);
+	~BoundingBox() {}
+
+	/// <summary>
+	/// Returns true if the specified position is located within the box.
+	/// </summary>
+	/// <param name="a_rPosition"> A position. </param>
+	/// <returns> True if the position is located within the box's volume. </returns>
+	inline bool Contains(const TVector& a_rPosition) const;
+	/// <summary>
+	/// Returns true if two boxes share some of the same space.
+	/// </summary>
+	/// <param name="a_rOtherBox"> The other box to check against this. </param>
+	/// <returns> True if the two boxes overlap. </returns>
+	inline bool Overlaps(const BoundingBox<TVector>& a_rOtherBox) const;
+
+	inline void SetPosition(const TVector& a_rPosition);
+	inline void SetDimensions(const TVector& a_rDimensions);
+
+	inline const TVector& GetPosition() const;
+	inline const TVector& GetDimensions() const;
+
+private:
+	/// <summary>
+	/// The position at the centre of the box.
+	/// </summary>
+	TVector m_position;
+	/// <summary>
+	/// The width, height, and depth of the box as measured outward from its central position.
+	/// </summary>
+	TVector m_dimensions;
+};
+
+template <typename TVector>
+BoundingBox<TVector>::BoundingBox() : m_position(0.0f),
+	m_dimensions(0.0f) {}
+
+template <typename TVector>
+BoundingBox<TVector>::BoundingBox(const TVector& a_position,
+	const TVector& a_dimensions) : m_position(a_position),
+	m_dimensions(a_dimensions) {}
+
+template <typename TVector>
+bool BoundingBox<TVector>::Contains(const TVector& a_rPosition) const {
+	return (a_rPosition.x >= m_position.x - m_dimensions.x &&
+		a_rPosition.x <= m_position.x + m_dimensions.x &&
+		a_rPosition.y >= m_position.y - m_dimensions.y &&
+		a_rPosition.y <= m_position.y + m_dimensions.y &&
+		a_rPosition.z >= m_position.z - m_dimensions.z &&
+		a_rPosition.z <= m_position.z + m_dimensions.z);
+}
+
+template <typename TVector>
+bool BoundingBox<TVector>::Overlaps(const BoundingBox<TVector>& a_rOtherBox) const {
+	// The boxes overlap if, along every axis, each box's lower extent is below the other box's upper extent.
+	return (a_rOtherBox.m_position.x - a_rOtherBox.m_dimensions.x <= m_position.x + m_dimensions.x &&
+		a_rOtherBox.m_position.x + a_rOtherBox.m_dimensions.x >= m_position.x - m_dimensions.x &&
+		a_rOtherBox.m_position.y - a_rOtherBox.m_dimensions.y <= m_position.y + m_dimensions.y &&
+		a_rOtherBox.m_position.y + a_rOtherBox.m_dimensions.y >= m_position.y - m_dimensions.y &&
+		a_rOtherBox.m_position.z - a_rOtherBox.m_dimensions.z <= m_position.z + m_dimensions.z &&
+		a_rOtherBox.m_position.z + a_rOtherBox.m_dimensions.z >= m_position.z - m_dimensions.z);
+}
+
+template <typename TVector>
+void BoundingBox<TVector>::SetPosition(const TVector& a_rPosition) {
+	m_position = a_rPosition;
+}
+
+template <typename TVector>
+void BoundingBox<TVector>::SetDimensions(const TVector& a_rDimensions) {
+	m_dimensions = a_rDimensions;
+}
+
+template <typename TVector>
+const TVector& BoundingBox<TVector>::GetPosition() const {
+	return m_position;
+}
+
+template <typename TVector>
+const TVector& BoundingBox<TVector>::GetDimensions() const {
+	return m_dimensions;
+}
+
+#endif // !BOUNDING_BOX_H
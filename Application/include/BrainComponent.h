@@ -9,6 +9,8 @@
 // Header dependencies.
 #include "Component.h"
 #include "glm/glm.hpp"
+#include "OctTree.h"
+#include "SpatialIndex.h"
 #include <vector>
 
 // Forward declarations
@@ -24,8 +26,30 @@ typedef std::vector<Entity*> pEntityVector;
 /// <summary>
 /// Allows a boid to automatically move itself around a scene.
 /// </summary>
-class BrainComponent : public Component {
+class BrainComponent final : public Component {
 public:
+	/// <summary>
+	/// The type that the component is attached to entities as, which also picks the pool that scenes store it in.
+	/// </summary>
+	static const COMPONENT_TYPE msc_componentType = COMPONENT_TYPE_BRAIN;
+
+	/// <summary>
+	/// The ways in which a boid decides which entities are its neighbours.
+	/// </summary>
+	enum NEIGHBOURHOOD_TYPE {
+		/// <summary>
+		/// Every entity within a fixed distance, so boids in dense flocks have many neighbours and boids that stray
+		/// have none.
+		/// </summary>
+		NEIGHBOURHOOD_TYPE_METRIC,
+		/// <summary>
+		/// A fixed number of the nearest entities however far away they are, like real starlings. Each boid does the
+		/// same amount of work no matter how dense its flock is.
+		/// </summary>
+		NEIGHBOURHOOD_TYPE_TOPOLOGICAL,
+		NEIGHBOURHOOD_TYPE_COUNT
+	};
+
 	BrainComponent(Entity* a_pOwner,
 		Scene* a_pScene);
 	BrainComponent(Entity* a_pOwner,
@@ -34,24 +58,96 @@ public:
 	~BrainComponent() {}
 
 	virtual void Update(float a_fDeltaTime);
+	/// <summary>
+	/// Finds the boid's neighbours and steers it with its behavioural forces.
+	/// </summary>
+	virtual void Reevaluate();
 	virtual void Draw(Framework* a_pRenderingFramework) {}
+	virtual Component* Clone(Entity* a_pOwner,
+		Scene* a_pScene);
 
 	static inline void SetSeparationForce(float a_force);
 	static inline void SetAlignmentForce(float a_force);
 	static inline void SetCohesionForce(float a_force);
 	static inline void SetWanderForce(float a_force);
+	static inline void SetNeighbourhoodType(NEIGHBOURHOOD_TYPE a_neighbourhoodType);
+	/// <summary>
+	/// Sets how many of the nearest entities each boid steers by when using topological neighbourhoods.
+	/// </summary>
+	static inline void SetTopologicalNeighbourCount(unsigned int a_uiNeighbourCount);
+	/// <summary>
+	/// Sets how far boids perceive other boids when the scene sums up distant boids with cell aggregates.
+	/// </summary>
+	static inline void SetPerceptionDistance(float a_fPerceptionDistance);
+	/// <summary>
+	/// Sets the velocity that the boid moves at, and keeps moving at until it next reevaluates.
+	/// </summary>
+	inline void SetVelocity(const glm::vec3& a_rVelocity);
 
 	inline glm::vec3 GetVelocity() const;
+	/// <summary>
+	/// Returns how far the boid's neighbourhood reaches from it along each axis.
+	/// </summary>
+	inline float GetNeighbourDistance() const;
+	/// <summary>
+	/// Returns the number of entities that the boid perceived when it last reevaluated, including itself and those
+	/// summed up in aggregates.
+	/// </summary>
+	inline unsigned int GetNeighbourCount() const;
 	static inline float GetSeparationForce();
 	static inline float GetAlignmentForce();
 	static inline float GetCohesionForce();
 	static inline float GetWanderForce();
+	static inline NEIGHBOURHOOD_TYPE GetNeighbourhoodType();
+	static inline unsigned int GetTopologicalNeighbourCount();
+	static inline float GetPerceptionDistance();
 	/// <summary>
 	/// Gets a collection of all the nearby entities.
 	/// </summary>
 	/// <param name="a_currentPosition"> The entity's current world position. </param>
-	/// <returns> A collection of entity pointers. </returns>
-	pEntityVector GetNeighbouringEntities(glm::vec3 a_currentPosition) const;
+	/// <param name="a_rNearbyEntities"> Cleared and then filled with the nearby entities. With metric neighbourhoods
+	/// they're taken from the scene's neighbour lists when it's using them, rather than querying its spatial index.
+	/// With topological neighbourhoods they're the nearest entities other than the boid's own. </param>
+	/// <param name="a_rDistantBoids"> Cleared and then filled with the totals of the boids that are perceived
+	/// through the scene's cell aggregates, which reach out to the perception distance. Stays empty unless the scene
+	/// is using them. </param>
+	void GetNeighbouringEntities(glm::vec3 a_currentPosition,
+		pEntityVector& a_rNearbyEntities,
+		OctTree<Entity, glm::vec3>::Aggregate& a_rDistantBoids) const;
+	/// <summary>
+	/// Adds to the velocity that moves the entity away from collisions, for one of the entities it's in contact with.
+	/// The scene calls this for each of the entity's contacts before updating it.
+	/// </summary>
+	/// <param name="a_rEntityPosition"> The entity's current position. </param>
+	/// <param name="a_rCollidingEntityPosition"> The position of the entity that it's in contact with. </param>
+	void CalculateCollisionVelocity(const glm::vec3& a_rEntityPosition,
+		const glm::vec3& a_rCollidingEntityPosition);
+	/// <summary>
+	/// Calculates the velocity that steers the boid with its separation, alignment and cohesion forces. When the scene
+	/// sums up distant boids with cell aggregates, their totals are weighed by the number of boids they stand in for.
+	/// </summary>
+	/// <param name="a_rCurrentPosition"> The boid's current position. </param>
+	/// <param name="a_rNearbyEntities"> The boid's neighbours. </param>
+	/// <param name="a_rDistantBoids"> The totals of the distant boids that are perceived as a group. </param>
+	/// <returns> The sum of the boid's separation, alignment and cohesion velocities, scaled by their forces. </returns>
+	glm::vec3 CalculateFlockingVelocity(const glm::vec3& a_rCurrentPosition,
+		const pEntityVector& a_rNearbyEntities,
+		const OctTree<Entity, glm::vec3>::Aggregate& a_rDistantBoids) const;
+	/// <summary>
+	/// Adds up what each of the nearby boids contributes to the boid's steering.
+	/// </summary>
+	/// <param name="a_rCurrentPosition"> The boid's current position. </param>
+	/// <param name="a_rNearbyEntities"> The boid's neighbours. Entities that aren't boids, and the boid itself, are
+	/// skipped. </param>
+	/// <param name="a_rSeparationSum"> Has the direction away from each neighbour added to it. </param>
+	/// <param name="a_rVelocitySum"> Has each neighbour's velocity added to it. </param>
+	/// <param name="a_rPositionSum"> Has each neighbour's position added to it. </param>
+	/// <returns> The number of neighbours that were added up. </returns>
+	unsigned int AccumulateNeighbours(const glm::vec3& a_rCurrentPosition,
+		const pEntityVector& a_rNearbyEntities,
+		glm::vec3& a_rSeparationSum,
+		glm::vec3& a_rVelocitySum,
+		glm::vec3& a_rPositionSum) const;
 
 private:
 	/// <summary>
@@ -85,33 +181,46 @@ private:
 	/// </summary>
 	/// <param name="a_alignmentVelocity"> The boid's current alignment velocity. </param>
 	/// <param name="a_targetVector"> The amount to increase the boid's alignment velocity by. </param>
+	/// <param name="a_uiNeighbourCount"> The number of entities to align with. </param>
 	/// <returns> The boid's new alignment velocity. </returns>
 	glm::vec3 CalculateAlignmentVelocity(glm::vec3 a_alignmentVelocity,
-		glm::vec3 a_targetVector)const;
+		glm::vec3 a_targetVector,
+		unsigned int a_uiNeighbourCount) const;
 	/// <summary>
 	/// Generates a new cohesion velocity that moves the boid towards its neighbours.
 	/// </summary>
 	/// <param name="a_cohesionVelocity"> The boid's current cohesion velocity. </param>
 	/// <param name="a_cohesionChange"> The amount to change the boid's cohesion velocity by. </param>
 	/// <param name="a_currentPosition"> The boid's current position. </param>
+	/// <param name="a_uiNeighbourCount"> The number of entities to move towards. </param>
 	/// <returns> The boid's new cohesion velocity. </returns>
 	glm::vec3 CalculateCohesionVelocity(glm::vec3 a_cohesionVelocity,
 		glm::vec3 a_cohesionChange,
-		glm::vec3 a_currentPosition)const;
+		glm::vec3 a_currentPosition,
+		unsigned int a_uiNeighbourCount) const;
+	/// <summary>
+	/// Calculates the flocking velocity from the nearby boids and the distant boids' totals by adding up every
+	/// neighbour's contribution first, and only averaging and normalising each force once. Separation only pushes
+	/// away from the nearby boids.
+	/// </summary>
+	/// <param name="a_rCurrentPosition"> The boid's current position. </param>
+	/// <param name="a_rNearbyEntities"> The boid's neighbours. </param>
+	/// <param name="a_rDistantBoids"> The totals of the distant boids that are perceived as a group. </param>
+	/// <returns> The sum of the boid's separation, alignment and cohesion velocities, scaled by their forces. </returns>
+	glm::vec3 CalculateAggregateFlockingVelocity(const glm::vec3& a_rCurrentPosition,
+		const pEntityVector& a_rNearbyEntities,
+		const OctTree<Entity, glm::vec3>::Aggregate& a_rDistantBoids) const;
 	/// <summary>
 	/// Calculates the boid's overall movement.
 	/// </summary>
 	/// <param name="a_rEntityPosition"> The boid's current position. </param>
 	/// <param name="a_rEntityForward"> The boid's forward direction. </param>
+	/// <param name="a_rNearbyEntities"> The boid's neighbours. </param>
+	/// <param name="a_rDistantBoids"> The totals of the distant boids that are perceived as a group. </param>
 	glm::vec3 CalculateNewMovementVelocity(glm::vec3& a_rEntityPosition,
 		glm::vec3& a_rEntityForward,
-		pEntityVector nearbyEntities) const;
-	/// <summary>
-	/// Calculates a new velocity that moves the entity away from collisions.
-	/// </summary>
-	/// <param name="a_entityPosition"> The entity's current position. </param>
-	void CalculateCollisionVelocity(const glm::vec3 a_entityPosition);
-
+		const pEntityVector& a_rNearbyEntities,
+		const OctTree<Entity, glm::vec3>::Aggregate& a_rDistantBoids) const;
 	/// <summary>
 	/// Updates the entity's transform matrix with the entity's current position and rotation data.
 	/// </summary>
@@ -145,6 +254,16 @@ private:
 	/// The strength of the force that causes a boid to move to a random point in space.
 	/// </summary>
 	static float ms_fWanderForce;
+	static NEIGHBOURHOOD_TYPE ms_neighbourhoodType;
+	/// <summary>
+	/// The number of nearest entities that make up a topological neighbourhood, not counting the boid itself.
+	/// </summary>
+	static unsigned int ms_uiTopologicalNeighbourCount;
+	/// <summary>
+	/// How far boids perceive other boids when distant boids are summed up by cell, which can reach much further than
+	/// the neighbour distance because the number of areas grows far slower than the number of boids.
+	/// </summary>
+	static float ms_fPerceptionDistance;
 	/// <summary>
 	/// The number of nearby boids.
 	/// </summary>
@@ -159,11 +278,6 @@ private:
 	/// </summary>
 	const float mc_fMaximumNeighbourDistance;
 	/// <summary>
-	/// The timestamp for when this component was last updated.
-	/// Always starts at zero when the entity is created.
-	/// </summary>
-	float m_fLastUpdate;
-	/// <summary>
 	/// a velocity that describes the boids current movement.
 	/// </summary>
 	glm::vec3 m_currentMovementVelocity;
@@ -180,6 +294,19 @@ private:
 	/// </summary>
 	Scene* m_pScene;
 	ColliderComponent* m_pEntityCollider;
+	/// <summary>
+	/// The neighbours found by the boid's last query. Kept between updates so its memory can be reused.
+	/// </summary>
+	pEntityVector m_nearbyEntities;
+	/// <summary>
+	/// The totals of the distant boids found by the boid's last query.
+	/// </summary>
+	OctTree<Entity, glm::vec3>::Aggregate m_distantBoids;
+	/// <summary>
+	/// The nearest entities found by the boid's last topological query, along with their distances. Only used while
+	/// finding neighbours, but kept between updates so its memory can be reused.
+	/// </summary>
+	mutable std::vector<SpatialIndex<Entity, glm::vec3>::NearestObject> m_nearestEntities;
 };
 
 void BrainComponent::SetSeparationForce(float a_force) {
@@ -198,10 +325,35 @@ void BrainComponent::SetWanderForce(float a_force) {
 	ms_fWanderForce = a_force;
 }
 
+void BrainComponent::SetNeighbourhoodType(NEIGHBOURHOOD_TYPE a_neighbourhoodType) {
+	ms_neighbourhoodType = a_neighbourhoodType;
+}
+
+void BrainComponent::SetTopologicalNeighbourCount(unsigned int a_uiNeighbourCount) {
+	ms_uiTopologicalNeighbourCount = a_uiNeighbourCount;
+}
+
+void BrainComponent::SetPerceptionDistance(float a_fPerceptionDistance) {
+	ms_fPerceptionDistance = a_fPerceptionDistance;
+}
+
+void BrainComponent::SetVelocity(const glm::vec3& a_rVelocity) {
+	m_currentMovementVelocity = a_rVelocity;
+	m_newMovementVelocity = a_rVelocity;
+}
+
 glm::vec3 BrainComponent::GetVelocity() const {
 	return m_currentMovementVelocity;
 }
 
+float BrainComponent::GetNeighbourDistance() const {
+	return mc_fMaximumNeighbourDistance;
+}
+
+unsigned int BrainComponent::GetNeighbourCount() const {
+	return m_uiNeighbourCount;
+}
+
 float BrainComponent::GetSeparationForce() {
 	return ms_fSeparationForce;
 }
@@ -218,4 +370,16 @@ float BrainComponent::GetWanderForce() {
 	return ms_fWanderForce;
 }
 
+BrainComponent::NEIGHBOURHOOD_TYPE BrainComponent::GetNeighbourhoodType() {
+	return ms_neighbourhoodType;
+}
+
+unsigned int BrainComponent::GetTopologicalNeighbourCount() {
+	return ms_uiTopologicalNeighbourCount;
+}
+
+float BrainComponent::GetPerceptionDistance() {
+	return ms_fPerceptionDistance;
+}
+
 #endif // !BRAIN_COMPONENT_H
@@ -10,28 +10,36 @@
 #include "Component.h"
 #include "Boundary.h"
 #include "glm/glm.hpp"
-#include "Utilities.h"
-#include <vector>
 
 // Forward declarations.
 class Entity;
-template <typename TObject, typename TVector>
-class OctTree;
+class Scene;
 
 /// <summary>
-/// Allows an entity to trigger collisions with other colliders.
+/// Allows an entity to trigger collisions with other colliders. Collisions are found by the scene's broadphase and
+/// kept in the scene's contact cache, which tells each collider when its contacts begin and end.
 /// </summary>
-class ColliderComponent : public Component {
+class ColliderComponent final : public Component {
 public:
+	/// <summary>
+	/// The type that the component is attached to entities as, which also picks the pool that scenes store it in.
+	/// </summary>
+	static const COMPONENT_TYPE msc_componentType = COMPONENT_TYPE_COLLIDER;
+
+	ColliderComponent(Entity* a_pOwner);
 	ColliderComponent(Entity* a_pOwner,
-		const OctTree<Entity, glm::vec3>* a_pOctTree);
-	ColliderComponent(Entity* a_pOwner,
-		const OctTree<Entity, glm::vec3>* a_pOctTree,
 		ColliderComponent& a_rColliderToCopy);
 	~ColliderComponent();
 
 	void Update(float a_fDeltaTime);
 	void Draw(Framework* a_pRenderingFramework);
+	/// <summary>
+	/// Adds the collider's boundary to a snapshot, if colliders are being drawn.
+	/// </summary>
+	/// <param name="a_rSnapshot"> The snapshot to add the boundary to. </param>
+	void WriteSnapshot(SceneSnapshot& a_rSnapshot) const;
+	Component* Clone(Entity* a_pOwner,
+		Scene* a_pScene);
 
 	/// <summary>
 	/// Checks if the entity is in contact with another collider.
@@ -53,62 +61,45 @@ public:
 
 	inline Boundary<glm::vec3>* GetBoundary();
 	/// <summary>
-	/// Returns a collection of all the entities that are in contact with this entity.
+	/// Returns the number of entities that are in contact with this entity, as of the last time the scene's contact
+	/// cache was updated.
 	/// </summary>
-	/// <returns> All the colliding entities. </returns>
-	inline const std::vector<ColliderComponent*>& GetCollisions() const;
+	inline unsigned int GetContactCount() const;
 	inline static const bool GetColliderDrawState() { return m_bDrawColliders; }
 
 private:
-	/// <summary>
-	/// Detects if any new collisions have started with another entity.
-	/// </summary>
-	void RegisterCollisions();
-	/// <summary>
-	/// Removes all references to entities that are no longer colliding with this entity.
-	/// </summary>
-	void UnregisterCollisions();
+	// Only the scene passes on when contacts begin and end.
+	friend class Scene;
 
 	/// <summary>
-	/// True if there's a collision between this entity and at least one other entity.
+	/// Counts an entity that's come into contact with this one.
 	/// </summary>
-	bool m_bIsColliding;
+	inline void BeginContact();
 	/// <summary>
-	/// The timestamp for when this component was last updated.
-	/// Always starts at zero when the entity is created.
+	/// Stops counting an entity that's no longer in contact with this one.
 	/// </summary>
-	float m_fLastUpdate;
-	/// <summary>
-	/// The greatest distance between any two bounds of the collider.
-	/// </summary>
-	float m_fColliderRadius;
+	inline void EndContact();
+
 	/// <summary>
 	/// Stores the collider's position and dimensions.
 	/// </summary>
 	Boundary<glm::vec3> m_boundary;
 	static bool m_bDrawColliders;
 	/// <summary>
-	/// A collection of all the colliders that are in contact with this entity.
-	/// </summary>
-	std::vector<ColliderComponent*> m_collisionColldiers;
-	/// <summary>
-	/// A pointer to the scenes oct-tree.
+	/// The number of entities that are in contact with this entity.
 	/// </summary>
-	const OctTree<Entity, glm::vec3>* mc_pOctTree;
+	unsigned int m_uiContactCount;
 };
 
 const bool ColliderComponent::IsColliding() const {
-	return m_bIsColliding;
+	return m_uiContactCount > 0;
 }
 
 void ColliderComponent::SetDimensions(float a_dimensionScalar) {
-	m_fColliderRadius = a_dimensionScalar;
 	m_boundary.SetDimensions(glm::vec3(a_dimensionScalar));
 }
 
 void ColliderComponent::SetDimensions(glm::vec3 a_dimensionScalar) {
-	// Get the average length to make up for the collider potentially having different dimensions.
-	m_fColliderRadius = (a_dimensionScalar.x + a_dimensionScalar.y + a_dimensionScalar.z) * Utilities::Third;
 	m_boundary.SetDimensions(a_dimensionScalar);
 }
 
@@ -120,8 +111,18 @@ Boundary<glm::vec3>* ColliderComponent::GetBoundary() {
 	return &m_boundary;
 }
 
-const std::vector<ColliderComponent*>& ColliderComponent::GetCollisions() const {
-	return m_collisionColldiers;
+unsigned int ColliderComponent::GetContactCount() const {
+	return m_uiContactCount;
+}
+
+void ColliderComponent::BeginContact() {
+	++m_uiContactCount;
+}
+
+void ColliderComponent::EndContact() {
+	if (m_uiContactCount > 0) {
+		--m_uiContactCount;
+	}
 }
 
 #endif // !COLLIDER_COMPONENT_H
@@ -6,9 +6,14 @@
 #ifndef COMPONENT_H
 #define COMPONENT_H
 
+// Header includes.
+#include "ObjectPool.h"
+
 // Forwards declarations.
 class Entity;
 class Framework;
+class Scene;
+class SceneSnapshot;
 
 // An enum of all the possible component types.
 enum COMPONENT_TYPE {
@@ -20,6 +25,9 @@ enum COMPONENT_TYPE {
 	COMPONENT_TYPE_COUNT
 };
 
+// A set of component types, with a bit for each type that's in the set.
+typedef unsigned int ComponentSignature;
+
 /// <summary>
 /// The base class for all component classes used by entities.
 /// Provides a set of generic functions and properties that are used throughout all the component classes.
@@ -34,10 +42,29 @@ public:
 	/// <param name="a_deltaTime"> The amount of time that has passed between this frame and the last one. </param>
 	virtual void Update(float a_deltaTime) = 0;
 	/// <summary>
+	/// Recalculates the component's expensive decisions, such as which way to steer or what it's colliding with.
+	/// Called by the scene every few fixed steps, rather than on every one like Update.
+	/// </summary>
+	virtual void Reevaluate() {}
+	/// <summary>
 	/// Draws the component's elements on-screen.
 	/// </summary>
 	/// <param name="a_pRenderingFramework"> A pointer to the program that renders the object on-screen. </param>
 	virtual void Draw(Framework* a_pRenderingFramework) = 0;
+	/// <summary>
+	/// Copies anything that the component would draw into a snapshot, so it can be drawn on another thread.
+	/// Components that don't draw anything leave the snapshot as it is.
+	/// </summary>
+	/// <param name="a_rSnapshot"> The snapshot to add the component's elements to. </param>
+	virtual void WriteSnapshot(SceneSnapshot& /*a_rSnapshot*/) const {}
+	/// <summary>
+	/// Creates a copy of the component for another entity.
+	/// </summary>
+	/// <param name="a_pOwner"> The entity that the copy is attached to. </param>
+	/// <param name="a_pScene"> The scene that the copy's entity belongs to. </param>
+	/// <returns> A pointer to the new component. </returns>
+	virtual Component* Clone(Entity* a_pOwner,
+		Scene* a_pScene) = 0;
 
 	/// <summary>
 	/// Returns a pointer to the entity that the component is attached to.
@@ -49,10 +76,21 @@ public:
 	/// </summary>
 	/// <returns> The component type. </returns>
 	inline COMPONENT_TYPE GetComponentType() const;
+	/// <summary>
+	/// Returns the handle to the component within its scene's pool of components of the same type, or a null handle
+	/// if it wasn't created by a scene.
+	/// </summary>
+	inline PoolHandle GetPoolHandle() const;
+	inline void SetPoolHandle(PoolHandle a_handle);
+	/// <summary>
+	/// Returns the bit that stands for a component type in a signature.
+	/// </summary>
+	inline static ComponentSignature GetSignatureBit(COMPONENT_TYPE a_componentType);
 
 protected:
 	Entity* m_pAttachedEntity;
 	COMPONENT_TYPE m_componentType;
+	PoolHandle m_poolHandle;
 };
 
 inline Entity* Component::GetEntity() const {
@@ -63,4 +101,16 @@ inline COMPONENT_TYPE Component::GetComponentType() const {
 	return m_componentType;
 }
 
+inline PoolHandle Component::GetPoolHandle() const {
+	return m_poolHandle;
+}
+
+inline void Component::SetPoolHandle(PoolHandle a_handle) {
+	m_poolHandle = a_handle;
+}
+
+inline ComponentSignature Component::GetSignatureBit(COMPONENT_TYPE a_componentType) {
+	return 1u << a_componentType;
+}
+
 #endif // !COMPONENT_H.
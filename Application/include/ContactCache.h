@@ -0,0 +1,192 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+#ifndef CONTACT_CACHE_H
+#define CONTACT_CACHE_H
+
+// Header includes.
+#include "ObjectPool.h"
+#include <vector>
+
+// Forward declarations.
+class StaggeredSchedule;
+
+/// <summary>
+/// Keeps every contact between two entities' colliders in one place, stored once per pair of entities however many
+/// times the pair is found. Contacts persist between updates, so each update can report which contacts have begun,
+/// which have stayed, and which have ended since the last. Staggered updates only check the contacts of the entities
+/// that are due, and keep the rest as they were.
+/// </summary>
+class ContactCache {
+public:
+	/// <summary>
+	/// The ways that a contact can have changed during an update.
+	/// </summary>
+	enum CONTACT_EVENT_TYPE {
+		/// <summary>
+		/// The entities weren't in contact before the update.
+		/// </summary>
+		CONTACT_EVENT_TYPE_BEGIN,
+		/// <summary>
+		/// The entities were already in contact before the update.
+		/// </summary>
+		CONTACT_EVENT_TYPE_STAY,
+		/// <summary>
+		/// The entities were in contact before the update, but aren't any more. One of them may have been destroyed.
+		/// </summary>
+		CONTACT_EVENT_TYPE_END,
+		CONTACT_EVENT_TYPE_COUNT
+	};
+
+	/// <summary>
+	/// A contact between two entities and how it changed during the last update.
+	/// </summary>
+	struct ContactEvent {
+		CONTACT_EVENT_TYPE type;
+		/// <summary>
+		/// The handle of the entity that was stored in the lower slot of the scene's pool.
+		/// </summary>
+		PoolHandle first;
+		PoolHandle second;
+	};
+
+	ContactCache();
+	~ContactCache() {}
+
+	/// <summary>
+	/// Starts an update, after which every contact that's still touching must be added again or it ends.
+	/// </summary>
+	void BeginUpdate();
+	/// <summary>
+	/// Records that two entities are in contact during the current update. Adding the same pair more than once, in
+	/// either order, has no further effect.
+	/// </summary>
+	/// <param name="a_firstEntity"> The handle of one of the entities. </param>
+	/// <param name="a_secondEntity"> The handle of the other entity. </param>
+	void AddContact(PoolHandle a_firstEntity,
+		PoolHandle a_secondEntity);
+	/// <summary>
+	/// Finishes an update, ending every contact that was checked but wasn't added during it, and listing how every
+	/// checked contact changed.
+	/// </summary>
+	/// <param name="a_pSchedule"> Decides which entities' contacts were checked, by the entities' slots. Contacts
+	/// between two entities that weren't due are kept, and aren't listed. Null if every contact was checked. </param>
+	/// <param name="a_uiTick"> The step being taken, counting from zero. </param>
+	void EndUpdate(const StaggeredSchedule* a_pSchedule = nullptr,
+		unsigned int a_uiTick = 0);
+	/// <summary>
+	/// Ends every contact at once, such as when collisions are turned off. The ended contacts are listed as events.
+	/// </summary>
+	void Clear();
+
+	/// <summary>
+	/// Returns how each contact that was checked changed during the last update, including the ones that ended.
+	/// </summary>
+	inline const std::vector<ContactEvent>& GetEvents() const;
+	/// <summary>
+	/// Returns the number of events of one type from the last update.
+	/// </summary>
+	inline unsigned int GetEventCount(CONTACT_EVENT_TYPE a_eventType) const;
+	/// <summary>
+	/// Returns the number of pairs of entities that are in contact.
+	/// </summary>
+	inline unsigned int GetContactCount() const;
+
+private:
+	/// <summary>
+	/// A pair of entities in contact, ordered so that either order of the same two entities gives the same key.
+	/// </summary>
+	struct ContactKey {
+		inline bool operator==(const ContactKey& a_rOther) const;
+
+		PoolHandle first;
+		PoolHandle second;
+	};
+	struct Contact {
+		ContactKey key;
+		/// <summary>
+		/// The update that the contact began in.
+		/// </summary>
+		unsigned int uiBeginUpdate;
+		/// <summary>
+		/// The last update that the contact was added in.
+		/// </summary>
+		unsigned int uiLastUpdate;
+	};
+
+	/// <summary>
+	/// Mixes the slots and generations of both of a contact's entities into one hash.
+	/// </summary>
+	inline static unsigned int GetHash(const ContactKey& a_rKey);
+	/// <summary>
+	/// Finds the bucket that holds a contact, or the empty bucket that it would be put in.
+	/// </summary>
+	/// <returns> The bucket's index. </returns>
+	unsigned int FindBucket(const ContactKey& a_rKey) const;
+	/// <summary>
+	/// Removes a contact by filling its place with the last contact, and moves the contacts that were put further
+	/// along because of it back towards their own buckets, so no search for a contact is cut short.
+	/// </summary>
+	/// <param name="a_uiContact"> The contact's index. </param>
+	void RemoveContact(unsigned int a_uiContact);
+	/// <summary>
+	/// Empties every bucket, making sure there are enough for the contacts, and puts each contact back in one.
+	/// </summary>
+	void RebuildBuckets();
+
+	/// <summary>
+	/// How many times more buckets than are needed can be kept from a burst of contacts before they're given back.
+	/// </summary>
+	static const unsigned int msc_uiBucketShrinkRatio = 8;
+
+	/// <summary>
+	/// Every contact, stored contiguously so that updates can run through them quickly.
+	/// </summary>
+	std::vector<Contact> m_contacts;
+	/// <summary>
+	/// A hash table of where each contact is stored, one higher than its index so that empty buckets are zero.
+	/// Contacts whose hashes collide are put in the next empty bucket along. There are always a power of two buckets,
+	/// at least twice as many as there are contacts.
+	/// </summary>
+	std::vector<unsigned int> m_buckets;
+	std::vector<ContactEvent> m_events;
+	/// <summary>
+	/// Working space for the indices of the contacts that ended during an update.
+	/// </summary>
+	std::vector<unsigned int> m_endedContacts;
+	unsigned int m_eventCounts[CONTACT_EVENT_TYPE_COUNT];
+	/// <summary>
+	/// The number of updates that have been started.
+	/// </summary>
+	unsigned int m_uiUpdateCount;
+};
+
+const std::vector<ContactCache::ContactEvent>& ContactCache::GetEvents() const {
+	return m_events;
+}
+
+unsigned int ContactCache::GetEventCount(CONTACT_EVENT_TYPE a_eventType) const {
+	return m_eventCounts[a_eventType];
+}
+
+unsigned int ContactCache::GetContactCount() const {
+	return m_contacts.size();
+}
+
+bool ContactCache::ContactKey::operator==(const ContactKey& a_rOther) const {
+	return first == a_rOther.first && second == a_rOther.second;
+}
+
+unsigned int ContactCache::GetHash(const ContactKey& a_rKey) {
+	// Large odd multipliers spread the bits of each number across the whole hash, and the highest bits are the
+	// most mixed.
+	const unsigned long long firstHash = (static_cast<unsigned long long>(a_rKey.first.uiIndex) << 32 |
+		a_rKey.first.uiGeneration) * 0x9E3779B97F4A7C15ull;
+	const unsigned long long secondHash = (static_cast<unsigned long long>(a_rKey.second.uiIndex) << 32 |
+		a_rKey.second.uiGeneration) * 0xC2B2AE3D27D4EB4Full;
+	return static_cast<unsigned int>((firstHash ^ secondHash) >> 32);
+}
+
+#endif // !CONTACT_CACHE_H
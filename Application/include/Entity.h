@@ -8,17 +8,12 @@
 
 // Header includes.
 #include "Component.h"
-#include <map>
 #include <string>
-#include <vector>
 
 // Forward declarations.
 class Framework;
 class Scene;
-
-// Typedefs.
-typedef std::map<COMPONENT_TYPE, Component*> ComponentMap;
-typedef std::pair<COMPONENT_TYPE, Component*> ComponentPair;
+class SceneSnapshot;
 
 /// <summary>
 /// The base class from which all entity types should derive from to support the creation of a 'game object'.
@@ -41,18 +36,30 @@ public:
 	/// <param name="a_deltaTime"></param>
 	virtual void Update(float a_deltaTime);
 	/// <summary>
+	/// Recalculates the expensive decisions of the entity's components, before they're updated.
+	/// </summary>
+	void Reevaluate();
+	/// <summary>
 	/// Draws the entity on-screen.
 	/// </summary>
 	/// <param name="a_pRenderingFramework"> The custom program that handles drawing the entity. </param>
 	virtual void Draw(Framework* a_pRenderingFramework);
 	/// <summary>
-	/// Attaches a new component to the entity.
+	/// Copies everything that the entity's components would draw into a snapshot.
+	/// </summary>
+	/// <param name="a_rSnapshot"> The snapshot to add the entity's elements to. </param>
+	void WriteSnapshot(SceneSnapshot& a_rSnapshot) const;
+	/// <summary>
+	/// Attaches a new component to the entity, unless it already has one of the same type.
+	/// Scenes store their entities by which components they have, so components must be attached before the entity
+	/// is added to a scene.
 	/// </summary>
 	/// <param name="a_componentsType"> The component's type. </param>
 	/// <param name="a_pComponent"> A pointer to the component instance to attach to the entity. </param>
 	inline void AddComponent(COMPONENT_TYPE a_componentsType, Component* a_pComponent);
 
 	inline void SetTag(std::string a_newTag);
+	inline void SetHandle(PoolHandle a_handle);
 	/// <summary>
 	/// Toggles collisions between entities on/off.
 	/// </summary>
@@ -61,6 +68,15 @@ public:
 
 	inline Component* GetComponentOfType(COMPONENT_TYPE a_componentType) const;
 	inline const unsigned int GetID() const;
+	/// <summary>
+	/// Returns the handle to the entity within its scene's pool of entities, which goes stale once the entity is
+	/// destroyed.
+	/// </summary>
+	inline PoolHandle GetHandle() const;
+	/// <summary>
+	/// Returns the set of component types that are attached to the entity, which scenes group their entities by.
+	/// </summary>
+	inline ComponentSignature GetSignature() const;
 	inline const std::string GetTag() const;
 	inline static bool GetCollisionsState();
 
@@ -73,39 +89,52 @@ private:
 	/// A unique identifier for each entity.
 	/// </summary>
 	unsigned int m_uiEntityID;
+	PoolHandle m_handle;
 	/// <summary>
 	/// A string identifier that's usually used for finding an entity.
 	/// </summary>
 	std::string m_tag;
 	/// <summary>
-	/// A collection of all the components that are currently attached to the entity.
+	/// The component of each type that's attached to the entity, indexed by type, or null if there isn't one.
 	/// </summary>
-	ComponentMap m_components;
+	Component* m_components[COMPONENT_TYPE_COUNT];
+	ComponentSignature m_signature;
 	static bool ms_bCollisionsOn;
 };
 
 void Entity::AddComponent(COMPONENT_TYPE a_componentsType, Component* a_pComponent) {
-	m_components.insert(ComponentPair(a_componentsType, a_pComponent));
+	if (a_componentsType >= COMPONENT_TYPE_COUNT || !a_pComponent || m_components[a_componentsType]) {
+		return;
+	}
+
+	m_components[a_componentsType] = a_pComponent;
+	m_signature |= Component::GetSignatureBit(a_componentsType);
 }
 
 void Entity::SetTag(std::string a_newTag) {
 	m_tag = a_newTag;
 }
 
-Component* Entity::GetComponentOfType(COMPONENT_TYPE a_componentType) const {
-	ComponentMap::const_iterator component = m_components.find(a_componentType);
-
-	if (component != m_components.cend()) {
-		return component->second;
-	}
+void Entity::SetHandle(PoolHandle a_handle) {
+	m_handle = a_handle;
+}
 
-	return nullptr;
+Component* Entity::GetComponentOfType(COMPONENT_TYPE a_componentType) const {
+	return a_componentType < COMPONENT_TYPE_COUNT ? m_components[a_componentType] : nullptr;
 }
 
 const unsigned int Entity::GetID() const {
 	return m_uiEntityID;
 }
 
+PoolHandle Entity::GetHandle() const {
+	return m_handle;
+}
+
+ComponentSignature Entity::GetSignature() const {
+	return m_signature;
+}
+
 const std::string Entity::GetTag() const {
 	return m_tag;
 }
@@ -0,0 +1,105 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+#ifndef FIXED_TIMESTEP_H
+#define FIXED_TIMESTEP_H
+
+/// <summary>
+/// Splits the time between frames into steps of a fixed length, so that a simulation behaves and costs the same
+/// however quickly it's drawn.
+/// Time that's left over after the last whole step is carried over to the next frame.
+/// </summary>
+class FixedTimestep {
+public:
+	/// <summary>
+	/// Creates a clock that hasn't taken any steps yet.
+	/// </summary>
+	/// <param name="a_fTickRate"> The number of steps to take for every second that passes. </param>
+	/// <param name="a_uiMaximumStepCount"> The most steps to take in one frame. </param>
+	FixedTimestep(float a_fTickRate = 60.0f,
+		unsigned int a_uiMaximumStepCount = 5);
+	~FixedTimestep() {}
+
+	/// <summary>
+	/// Adds the time that passed during a frame to the time that's waiting to be stepped through.
+	/// Always call once per frame, before taking the frame's steps.
+	/// </summary>
+	/// <param name="a_fFrameTime"> The amount of time (in seconds) that has passed since the last frame. </param>
+	void Accumulate(float a_fFrameTime);
+	/// <summary>
+	/// Takes a step if a whole step's worth of time is waiting and the frame hasn't taken its maximum number of
+	/// steps yet. Once the maximum is reached, any whole steps that are still waiting are dropped so that a slow frame
+	/// can't make the next frame slower too.
+	/// </summary>
+	/// <returns> True if a step should be simulated. </returns>
+	bool Step();
+
+	/// <summary>
+	/// Sets how many steps are taken for every second that passes. Rates of zero or less are ignored.
+	/// </summary>
+	/// <param name="a_fTickRate"> The number of steps per second. </param>
+	void SetTickRate(float a_fTickRate);
+	/// <summary>
+	/// Sets the most steps to take in one frame. At least one step is always allowed.
+	/// </summary>
+	/// <param name="a_uiMaximumStepCount"> The most steps per frame. </param>
+	inline void SetMaximumStepCount(unsigned int a_uiMaximumStepCount);
+
+	inline float GetTickRate() const;
+	/// <summary>
+	/// Returns the amount of time (in seconds) that each step simulates.
+	/// </summary>
+	inline float GetStepDuration() const;
+	inline unsigned int GetMaximumStepCount() const;
+	/// <summary>
+	/// Returns the number of steps that have been taken since the clock was created, including the current one.
+	/// </summary>
+	inline unsigned int GetTickCount() const;
+	/// <summary>
+	/// Returns how far the waiting time has got towards the next step, from zero to one. Drawing each object this far
+	/// from where it was after the step before last to where it is now hides the steps from the viewer.
+	/// </summary>
+	inline float GetAlpha() const;
+
+private:
+	float m_fTickRate;
+	float m_fStepDuration;
+	/// <summary>
+	/// The time (in seconds) that's waiting to be stepped through.
+	/// </summary>
+	float m_fAccumulatedTime;
+	unsigned int m_uiMaximumStepCount;
+	/// <summary>
+	/// The number of steps taken since the last call to Accumulate.
+	/// </summary>
+	unsigned int m_uiFrameStepCount;
+	unsigned int m_uiTickCount;
+};
+
+void FixedTimestep::SetMaximumStepCount(unsigned int a_uiMaximumStepCount) {
+	m_uiMaximumStepCount = a_uiMaximumStepCount > 0 ? a_uiMaximumStepCount : 1;
+}
+
+float FixedTimestep::GetTickRate() const {
+	return m_fTickRate;
+}
+
+float FixedTimestep::GetStepDuration() const {
+	return m_fStepDuration;
+}
+
+unsigned int FixedTimestep::GetMaximumStepCount() const {
+	return m_uiMaximumStepCount;
+}
+
+unsigned int FixedTimestep::GetTickCount() const {
+	return m_uiTickCount;
+}
+
+float FixedTimestep::GetAlpha() const {
+	return m_fAccumulatedTime / m_fStepDuration;
+}
+
+#endif // !FIXED_TIMESTEP_H
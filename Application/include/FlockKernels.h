@@ -0,0 +1,143 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+#ifndef FLOCK_KERNELS_H
+#define FLOCK_KERNELS_H
+
+// Header includes.
+#include "glm/glm.hpp"
+
+/// <summary>
+/// Adds up the contributions that a run of a flock's boids make to one boid's steering, several boids at a time.
+/// The widest instruction set that the processor supports is picked the first time the kernels are used.
+/// </summary>
+class FlockKernels {
+public:
+	enum INSTRUCTION_SET {
+		/// <summary>
+		/// One boid at a time, which works on any processor.
+		/// </summary>
+		INSTRUCTION_SET_SCALAR,
+		/// <summary>
+		/// Four boids at a time.
+		/// </summary>
+		INSTRUCTION_SET_SSE2,
+		/// <summary>
+		/// Eight boids at a time.
+		/// </summary>
+		INSTRUCTION_SET_AVX2,
+		INSTRUCTION_SET_COUNT
+	};
+
+	/// <summary>
+	/// Describes the boid that's looking for its neighbours.
+	/// </summary>
+	struct Neighbourhood {
+		glm::vec3 position;
+		/// <summary>
+		/// The distance from the boid's position to the edge of its neighbourhood along each axis.
+		/// </summary>
+		glm::vec3 dimensions;
+		/// <summary>
+		/// The boid's width, height, and depth as measured outward from its position.
+		/// </summary>
+		glm::vec3 boidDimensions;
+		/// <summary>
+		/// The boid's index, so it isn't counted as its own neighbour.
+		/// </summary>
+		unsigned int uiBoid;
+	};
+
+	/// <summary>
+	/// Adds the velocities of, and the directions towards, every boid in a run that overlaps a neighbourhood, and
+	/// lists the boids that are touching the neighbourhood's boid.
+	/// </summary>
+	/// <param name="a_rNeighbourhood"> The neighbourhood to search. </param>
+	/// <param name="a_pPositions"> Every boid's position. </param>
+	/// <param name="a_pVelocities"> Every boid's velocity. </param>
+	/// <param name="a_pDimensions"> Every boid's width, height, and depth as measured outward from its position. </param>
+	/// <param name="a_uiFirstBoid"> The index of the run's first boid. </param>
+	/// <param name="a_uiLastBoid"> The index of the boid after the run's last boid. </param>
+	/// <param name="a_rAlignmentVelocity"> Has each neighbour's velocity added to it. </param>
+	/// <param name="a_rCohesionVelocity"> Has the direction towards each neighbour added to it. </param>
+	/// <param name="a_pTouchingBoids"> Filled with the indices of the neighbours that are touching the
+	/// neighbourhood's boid, in increasing order. Must have room for every boid in the run. </param>
+	/// <returns> The number of touching neighbours. </returns>
+	static unsigned int AccumulateNeighbours(const Neighbourhood& a_rNeighbourhood,
+		const glm::vec3* a_pPositions,
+		const glm::vec3* a_pVelocities,
+		const glm::vec3* a_pDimensions,
+		unsigned int a_uiFirstBoid,
+		unsigned int a_uiLastBoid,
+		glm::vec3& a_rAlignmentVelocity,
+		glm::vec3& a_rCohesionVelocity,
+		unsigned int* a_pTouchingBoids);
+	/// <summary>
+	/// Does the same as the other overload, using a specific instruction set.
+	/// The instruction set must be supported by the processor.
+	/// </summary>
+	static unsigned int AccumulateNeighbours(INSTRUCTION_SET a_instructionSet,
+		const Neighbourhood& a_rNeighbourhood,
+		const glm::vec3* a_pPositions,
+		const glm::vec3* a_pVelocities,
+		const glm::vec3* a_pDimensions,
+		unsigned int a_uiFirstBoid,
+		unsigned int a_uiLastBoid,
+		glm::vec3& a_rAlignmentVelocity,
+		glm::vec3& a_rCohesionVelocity,
+		unsigned int* a_pTouchingBoids);
+
+	/// <summary>
+	/// Returns true if the processor, and the operating system, can run an instruction set.
+	/// </summary>
+	static bool IsSupported(INSTRUCTION_SET a_instructionSet);
+	/// <summary>
+	/// Returns the widest instruction set that the processor supports.
+	/// </summary>
+	static INSTRUCTION_SET GetInstructionSet();
+	static const char* GetInstructionSetName(INSTRUCTION_SET a_instructionSet);
+
+private:
+	typedef unsigned int (*Kernel)(const Neighbourhood& a_rNeighbourhood,
+		const glm::vec3* a_pPositions,
+		const glm::vec3* a_pVelocities,
+		const glm::vec3* a_pDimensions,
+		unsigned int a_uiFirstBoid,
+		unsigned int a_uiLastBoid,
+		glm::vec3& a_rAlignmentVelocity,
+		glm::vec3& a_rCohesionVelocity,
+		unsigned int* a_pTouchingBoids);
+
+	static Kernel GetKernel(INSTRUCTION_SET a_instructionSet);
+	static unsigned int AccumulateNeighboursScalar(const Neighbourhood& a_rNeighbourhood,
+		const glm::vec3* a_pPositions,
+		const glm::vec3* a_pVelocities,
+		const glm::vec3* a_pDimensions,
+		unsigned int a_uiFirstBoid,
+		unsigned int a_uiLastBoid,
+		glm::vec3& a_rAlignmentVelocity,
+		glm::vec3& a_rCohesionVelocity,
+		unsigned int* a_pTouchingBoids);
+	static unsigned int AccumulateNeighboursSse2(const Neighbourhood& a_rNeighbourhood,
+		const glm::vec3* a_pPositions,
+		const glm::vec3* a_pVelocities,
+		const glm::vec3* a_pDimensions,
+		unsigned int a_uiFirstBoid,
+		unsigned int a_uiLastBoid,
+		glm::vec3& a_rAlignmentVelocity,
+		glm::vec3& a_rCohesionVelocity,
+		unsigned int* a_pTouchingBoids);
+	static unsigned int AccumulateNeighboursAvx2(const Neighbourhood& a_rNeighbourhood,
+		const glm::vec3* a_pPositions,
+		const glm::vec3* a_pVelocities,
+		const glm::vec3* a_pDimensions,
+		unsigned int a_uiFirstBoid,
+		unsigned int a_uiLastBoid,
+		glm::vec3& a_rAlignmentVelocity,
+		glm::vec3& a_rCohesionVelocity,
+		unsigned int* a_pTouchingBoids);
+};
+
+#endif // !FLOCK_KERNELS_H
@@ -0,0 +1,343 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+#ifndef FLOCK_SYSTEM_H
+#define FLOCK_SYSTEM_H
+
+// Header includes.
+#include "BoundingBox.h"
+#include "glm/glm.hpp"
+#include "ThreadPool.h"
+#include <vector>
+
+// Forward declarations.
+class Entity;
+class StaggeredSchedule;
+
+/// <summary>
+/// Moves a whole flock of boids at once, in place of each boid's brain component.
+/// Every property of the boids is kept in its own contiguous array, which is sorted by the boids' positions each
+/// update so that boids that are near each other are also near each other in memory.
+/// Boids are updated in parallel. Each boid reads its neighbours' positions and velocities from the last frame and
+/// writes its own into a second set of arrays, and each boid draws random numbers from its own generator, so the
+/// flock moves identically for a given seed no matter how many threads update it.
+/// </summary>
+class FlockSystem {
+public:
+	/// <summary>
+	/// Stands in for the ID of a boid that isn't in the flock.
+	/// </summary>
+	static const unsigned int msc_uiNoBoid = ~0u;
+
+	/// <summary>
+	/// Creates a new, empty flock.
+	/// </summary>
+	/// <param name="a_rArea"> The volume of space that the boids are kept inside of. </param>
+	/// <param name="a_fNeighbourDistance"> Any boid beyond this distance is not considered to be a neighbour. </param>
+	/// <param name="a_uiSeed"> Seeds the random numbers that each boid uses to wander. </param>
+	/// <param name="a_uiThreadCount"> The number of threads that update the boids. Zero uses one thread for every
+	/// hardware thread. </param>
+	FlockSystem(const BoundingBox<glm::vec3>& a_rArea,
+		float a_fNeighbourDistance,
+		unsigned int a_uiSeed,
+		unsigned int a_uiThreadCount = 0);
+	~FlockSystem() {}
+
+	/// <summary>
+	/// Moves every boid in the flock, after steering the ones that are due to choose new steering velocities.
+	/// Always call once per step, unless its stages are being called separately.
+	/// </summary>
+	/// <param name="a_fDeltaTime"> The amount of time (in seconds) to move the boids for. </param>
+	/// <param name="a_rObstacles"> The bounds of everything besides the boids that the boids can collide with. </param>
+	/// <param name="a_pSteeringSchedule"> Decides which boids choose a new steering velocity and check what they're
+	/// colliding with before moving, by the order they were added in. Null to steer none of them. </param>
+	/// <param name="a_uiTick"> The step being taken, counting from zero. </param>
+	void Update(float a_fDeltaTime,
+		const std::vector<BoundingBox<glm::vec3>>& a_rObstacles,
+		const StaggeredSchedule* a_pSteeringSchedule,
+		unsigned int a_uiTick);
+	/// <summary>
+	/// Sorts the boids by the grid cell that they're positioned in, and finds where each cell's boids start. The first
+	/// of the three stages that Update runs, which must be run before the other two.
+	/// </summary>
+	void SortBoids();
+	/// <summary>
+	/// Chooses a new steering velocity for each boid that's due to, and checks what it's colliding with. The second
+	/// stage that Update runs.
+	/// </summary>
+	/// <param name="a_rObstacles"> The bounds of everything besides the boids that the boids can collide with. </param>
+	/// <param name="a_pSteeringSchedule"> Decides which boids are steered, by the order they were added in. Null to
+	/// steer none of them. </param>
+	/// <param name="a_uiTick"> The step being taken, counting from zero. </param>
+	void SteerBoids(const std::vector<BoundingBox<glm::vec3>>& a_rObstacles,
+		const StaggeredSchedule* a_pSteeringSchedule,
+		unsigned int a_uiTick);
+	/// <summary>
+	/// Moves every boid along its velocity and makes the boids' new positions and velocities current. The last stage
+	/// that Update runs.
+	/// </summary>
+	/// <param name="a_fDeltaTime"> The amount of time (in seconds) to move the boids for. </param>
+	void MoveBoids(float a_fDeltaTime);
+	/// <summary>
+	/// Adds a boid to the flock.
+	/// </summary>
+	/// <param name="a_pEntity"> The entity that's drawn in place of the boid. Can be null. </param>
+	/// <param name="a_position"> The boid's starting position. </param>
+	/// <param name="a_velocity"> The boid's starting velocity. </param>
+	/// <param name="a_dimensions"> The boid's width, height, and depth as measured outward from its position. </param>
+	/// <returns> The boid's ID, which stays the same while the boids are sorted and removed, until the boid itself is
+	/// removed. </returns>
+	unsigned int AddBoid(Entity* a_pEntity,
+		glm::vec3 a_position,
+		glm::vec3 a_velocity,
+		glm::vec3 a_dimensions);
+	/// <summary>
+	/// Removes a boid from the flock by filling its place with the last boid, without searching for it.
+	/// </summary>
+	/// <param name="a_uiBoidID"> The ID that the boid was given when it was added. </param>
+	/// <returns> True if the boid was found and removed from the flock. </returns>
+	bool RemoveBoid(unsigned int a_uiBoidID);
+
+	inline void SetSeparationForce(float a_fForce);
+	inline void SetAlignmentForce(float a_fForce);
+	inline void SetCohesionForce(float a_fForce);
+	inline void SetWanderForce(float a_fForce);
+	/// <summary>
+	/// Toggles collisions between the boids, and between the boids and obstacles, on/off.
+	/// </summary>
+	/// <param name="a_bCollisionsOn"> The new collision state. </param>
+	inline void SetCollisionsState(bool a_bCollisionsOn);
+
+	inline unsigned int GetBoidCount() const;
+	inline unsigned int GetThreadCount() const;
+	/// <summary>
+	/// Returns the entity that's drawn in place of a boid.
+	/// Boids are reordered every update, so indices only stay the same until the flock is next updated.
+	/// </summary>
+	/// <param name="a_uiBoid"> The boid's index within the flock. </param>
+	/// <returns> The boid's entity, which may be null. </returns>
+	inline Entity* GetEntity(unsigned int a_uiBoid) const;
+	inline const glm::vec3& GetPosition(unsigned int a_uiBoid) const;
+	/// <summary>
+	/// Returns a boid's current velocity, which is also the direction that it's facing.
+	/// </summary>
+	/// <param name="a_uiBoid"> The boid's index within the flock. </param>
+	/// <returns> The boid's velocity. </returns>
+	inline const glm::vec3& GetVelocity(unsigned int a_uiBoid) const;
+
+private:
+	/// <summary>
+	/// Calculates a new steering velocity for a boid from its neighbours, and checks what it's colliding with.
+	/// </summary>
+	/// <param name="a_uiBoid"> The index of the boid to steer. </param>
+	/// <param name="a_rObstacles"> The bounds of everything besides the boids that the boid can collide with. </param>
+	void SteerBoid(unsigned int a_uiBoid,
+		const std::vector<BoundingBox<glm::vec3>>& a_rObstacles);
+	/// <summary>
+	/// Moves a boid along its velocity, turning it around if it's about to leave the flock's area. The boid's new
+	/// position and velocity are written to the next frame's arrays.
+	/// </summary>
+	/// <param name="a_uiBoid"> The index of the boid to move. </param>
+	/// <param name="a_fDeltaTime"> The amount of time (in seconds) to move the boid for. </param>
+	void MoveBoid(unsigned int a_uiBoid,
+		float a_fDeltaTime);
+	/// <summary>
+	/// Generates a new wander velocity for a boid relative to its current forward direction.
+	/// </summary>
+	/// <param name="a_rPosition"> The boid's current position. </param>
+	/// <param name="a_rVelocity"> The boid's current velocity, which is also its forward direction. </param>
+	/// <param name="a_rRandomState"> The boid's random number generator. </param>
+	/// <returns> The boid's new wander velocity. </returns>
+	glm::vec3 CalculateWanderVelocity(const glm::vec3& a_rPosition,
+		const glm::vec3& a_rVelocity,
+		unsigned int& a_rRandomState) const;
+	/// <summary>
+	/// Returns the grid coordinates of the cell that contains a position. Positions outside of the flock's area are
+	/// placed in the nearest cell.
+	/// </summary>
+	inline glm::ivec3 GetCellCoordinates(const glm::vec3& a_rPosition) const;
+	inline unsigned int GetCellIndex(const glm::ivec3& a_rCellCoordinates) const;
+	/// <summary>
+	/// Returns a semi-random direction that's used to push apart boids which share the same position.
+	/// </summary>
+	/// <param name="a_rRandomState"> The boid's random number generator. </param>
+	static glm::vec3 GetRandomDirection(unsigned int& a_rRandomState);
+	/// <summary>
+	/// Returns a random point on the surface of a sphere.
+	/// </summary>
+	/// <param name="a_fRadius"> The sphere's radius. </param>
+	/// <param name="a_rRandomState"> The boid's random number generator. </param>
+	static glm::vec3 GetRandomPointOnSphere(float a_fRadius,
+		unsigned int& a_rRandomState);
+	/// <summary>
+	/// Advances a random number generator and returns a random number between zero and one.
+	/// </summary>
+	/// <param name="a_rRandomState"> The generator's state, which must never be zero. </param>
+	static inline float GetRandomNumber(unsigned int& a_rRandomState);
+
+	/// <summary>
+	/// The strength of the force that pulls two or more boids apart.
+	/// </summary>
+	float m_fSeparationForce;
+	/// <summary>
+	/// The strength of the force that causes a boid to move in the same direction as its neighbours.
+	/// </summary>
+	float m_fAlignmentForce;
+	/// <summary>
+	/// The strength of the force that brings two or more boids together.
+	/// </summary>
+	float m_fCohesionForce;
+	/// <summary>
+	/// The strength of the force that causes a boid to move to a random point in space.
+	/// </summary>
+	float m_fWanderForce;
+	bool m_bCollisionsOn;
+	/// <summary>
+	/// Seeds the random number generator of each boid that's added to the flock.
+	/// </summary>
+	unsigned int m_uiSeed;
+	/// <summary>
+	/// The number of boids that have ever been added to the flock, which gives each new boid its own random numbers.
+	/// </summary>
+	unsigned int m_uiAddedBoidCount;
+	const float mc_fSpeed;
+	/// <summary>
+	/// The limit for each boid's velocity components i.e. x, y, and z.
+	/// </summary>
+	const float mc_fMaximumVelocity;
+	const float mc_fMaximumNeighbourDistance;
+	/// <summary>
+	/// The volume of space that the boids are kept inside of.
+	/// </summary>
+	BoundingBox<glm::vec3> m_area;
+	/// <summary>
+	/// The number of grid cells along each axis. Cells are as large as a boid's neighbourhood, so each boid's
+	/// neighbours are found within the cells that surround it.
+	/// </summary>
+	glm::ivec3 m_cellCounts;
+	/// <summary>
+	/// The largest width, height, and depth of any boid in the flock.
+	/// </summary>
+	glm::vec3 m_boidDimensions;
+	// The boids' properties. Each boid has the same index within every array.
+	std::vector<glm::vec3> m_positions;
+	/// <summary>
+	/// The velocity that each boid last moved along, which is also the direction it's facing.
+	/// </summary>
+	std::vector<glm::vec3> m_velocities;
+	/// <summary>
+	/// Each boid's position and velocity at the end of the frame that's being updated. Swapped with the current
+	/// positions and velocities once every boid has been updated.
+	/// </summary>
+	std::vector<glm::vec3> m_nextPositions;
+	std::vector<glm::vec3> m_nextVelocities;
+	/// <summary>
+	/// The velocity that each boid's behavioural forces are steering it along.
+	/// </summary>
+	std::vector<glm::vec3> m_steeringVelocities;
+	/// <summary>
+	/// The velocity that moves each boid away from whatever it's colliding with.
+	/// </summary>
+	std::vector<glm::vec3> m_collisionVelocities;
+	std::vector<glm::vec3> m_dimensions;
+	/// <summary>
+	/// True for each boid that's colliding with something, stored as a byte to avoid std::vector's bit packing.
+	/// </summary>
+	std::vector<unsigned char> m_colliding;
+	/// <summary>
+	/// The state of each boid's random number generator.
+	/// </summary>
+	std::vector<unsigned int> m_randomStates;
+	/// <summary>
+	/// The order that each boid was added to the flock in, which decides when it steers.
+	/// </summary>
+	std::vector<unsigned int> m_phases;
+	std::vector<Entity*> m_entities;
+	/// <summary>
+	/// The ID of each boid, stored in the same order as the boids.
+	/// </summary>
+	std::vector<unsigned int> m_boidIDs;
+	/// <summary>
+	/// Where each boid is currently stored, indexed by its ID, or msc_uiNoBoid for IDs that aren't in use.
+	/// </summary>
+	std::vector<unsigned int> m_boidIndices;
+	/// <summary>
+	/// The IDs of removed boids, which are given to the next boids that are added.
+	/// </summary>
+	std::vector<unsigned int> m_freeBoidIDs;
+	// Working space for sorting the boids.
+	std::vector<unsigned int> m_boidCells;
+	/// <summary>
+	/// The index of the first boid in each cell once sorted, followed by the total number of boids.
+	/// </summary>
+	std::vector<unsigned int> m_cellStarts;
+	std::vector<unsigned int> m_sortedOrder;
+	std::vector<glm::vec3> m_sortingVectors;
+	std::vector<unsigned char> m_sortingBytes;
+	std::vector<unsigned int> m_sortingIntegers;
+	std::vector<Entity*> m_sortingEntities;
+	ThreadPool m_threadPool;
+};
+
+void FlockSystem::SetSeparationForce(float a_fForce) {
+	m_fSeparationForce = a_fForce;
+}
+
+void FlockSystem::SetAlignmentForce(float a_fForce) {
+	m_fAlignmentForce = a_fForce;
+}
+
+void FlockSystem::SetCohesionForce(float a_fForce) {
+	m_fCohesionForce = a_fForce;
+}
+
+void FlockSystem::SetWanderForce(float a_fForce) {
+	m_fWanderForce = a_fForce;
+}
+
+void FlockSystem::SetCollisionsState(bool a_bCollisionsOn) {
+	m_bCollisionsOn = a_bCollisionsOn;
+}
+
+unsigned int FlockSystem::GetBoidCount() const {
+	return m_positions.size();
+}
+
+unsigned int FlockSystem::GetThreadCount() const {
+	return m_threadPool.GetThreadCount();
+}
+
+Entity* FlockSystem::GetEntity(unsigned int a_uiBoid) const {
+	return m_entities[a_uiBoid];
+}
+
+const glm::vec3& FlockSystem::GetPosition(unsigned int a_uiBoid) const {
+	return m_positions[a_uiBoid];
+}
+
+const glm::vec3& FlockSystem::GetVelocity(unsigned int a_uiBoid) const {
+	return m_velocities[a_uiBoid];
+}
+
+glm::ivec3 FlockSystem::GetCellCoordinates(const glm::vec3& a_rPosition) const {
+	const glm::vec3 areaMinimum = m_area.GetPosition() - m_area.GetDimensions();
+	const glm::ivec3 cell = glm::ivec3(glm::floor((a_rPosition - areaMinimum) / mc_fMaximumNeighbourDistance));
+	return glm::clamp(cell, glm::ivec3(0), m_cellCounts - 1);
+}
+
+unsigned int FlockSystem::GetCellIndex(const glm::ivec3& a_rCellCoordinates) const {
+	return (a_rCellCoordinates.z * m_cellCounts.y + a_rCellCoordinates.y) * m_cellCounts.x + a_rCellCoordinates.x;
+}
+
+float FlockSystem::GetRandomNumber(unsigned int& a_rRandomState) {
+	// A xorshift generator, which is small enough to give every boid its own.
+	a_rRandomState ^= a_rRandomState << 13;
+	a_rRandomState ^= a_rRandomState >> 17;
+	a_rRandomState ^= a_rRandomState << 5;
+	// Use the top 24 bits, which a float can store exactly.
+	return (a_rRandomState >> 8) * (1.0f / 16777216.0f);
+}
+
+#endif // !FLOCK_SYSTEM_H
@@ -0,0 +1,88 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+#ifndef FRAME_TIME_HISTOGRAM_H
+#define FRAME_TIME_HISTOGRAM_H
+
+// Header includes.
+#include <cstdio>
+#include <vector>
+
+/// <summary>
+/// Counts how many frames took each range of times, so that occasional slow frames stand out from the average.
+/// </summary>
+class FrameTimeHistogram {
+public:
+	/// <summary>
+	/// Creates an empty histogram.
+	/// </summary>
+	/// <param name="a_fBinWidth"> The range of times (in milliseconds) that each bin counts. </param>
+	/// <param name="a_uiBinCount"> The number of bins. The last bin also counts every frame that's slower than the
+	/// bins cover. </param>
+	FrameTimeHistogram(float a_fBinWidth = 0.5f,
+		unsigned int a_uiBinCount = 64);
+	~FrameTimeHistogram() {}
+
+	/// <summary>
+	/// Counts a frame.
+	/// </summary>
+	/// <param name="a_fMilliseconds"> The time that the frame took. </param>
+	void Add(float a_fMilliseconds);
+	/// <summary>
+	/// Forgets every frame that's been counted.
+	/// </summary>
+	void Clear();
+	/// <summary>
+	/// Returns the time that a percentage of frames were no slower than, rounded up to the end of its bin.
+	/// </summary>
+	/// <param name="a_fPercentile"> The percentage of frames, from zero to one hundred. </param>
+	float GetPercentile(float a_fPercentile) const;
+	/// <summary>
+	/// Writes the histogram as a table of bins with a bar for each, leaving out the empty bins at either end.
+	/// </summary>
+	/// <param name="a_pFile"> The file to write to, such as stdout. </param>
+	void Print(std::FILE* a_pFile) const;
+
+	/// <summary>
+	/// Returns the number of frames in each bin.
+	/// </summary>
+	inline const std::vector<unsigned int>& GetBins() const;
+	inline float GetBinWidth() const;
+	inline unsigned int GetFrameCount() const;
+	inline float GetMeanTime() const;
+	inline float GetMaximumTime() const;
+
+private:
+	float m_fBinWidth;
+	std::vector<unsigned int> m_bins;
+	unsigned int m_uiFrameCount;
+	/// <summary>
+	/// The sum of every frame's time (in milliseconds).
+	/// </summary>
+	double m_dTotalTime;
+	float m_fMaximumTime;
+};
+
+const std::vector<unsigned int>& FrameTimeHistogram::GetBins() const {
+	return m_bins;
+}
+
+float FrameTimeHistogram::GetBinWidth() const {
+	return m_fBinWidth;
+}
+
+unsigned int FrameTimeHistogram::GetFrameCount() const {
+	return m_uiFrameCount;
+}
+
+float FrameTimeHistogram::GetMeanTime() const {
+	return m_uiFrameCount > 0 ? static_cast<float>(m_dTotalTime / m_uiFrameCount) : 0.0f;
+}
+
+float FrameTimeHistogram::GetMaximumTime() const {
+	return m_fMaximumTime;
+}
+
+#endif // !FRAME_TIME_HISTOGRAM_H
@@ -0,0 +1,68 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+#ifndef FRUSTUM_H
+#define FRUSTUM_H
+
+// Header includes.
+#include "BoundingBox.h"
+#include "glm/glm.hpp"
+
+/// <summary>
+/// The volume of space that a camera can see, bounded by six planes.
+/// Used to skip drawing anything that's off-screen.
+/// </summary>
+class Frustum {
+public:
+	/// <summary>
+	/// How much of a volume of space lies within the frustum.
+	/// </summary>
+	enum CONTAINMENT {
+		CONTAINMENT_OUTSIDE,
+		/// <summary>
+		/// The volume is partly inside the frustum, or close enough to one of its corners that it can't be ruled out.
+		/// </summary>
+		CONTAINMENT_INTERSECTING,
+		CONTAINMENT_INSIDE,
+		CONTAINMENT_COUNT
+	};
+
+	/// <summary>
+	/// Creates a frustum that can see everything.
+	/// </summary>
+	Frustum();
+	/// <summary>
+	/// Creates a new frustum from the planes of a camera's clip space.
+	/// </summary>
+	/// <param name="a_rViewProjectionMatrix"> The camera's projection matrix multiplied by its view matrix. </param>
+	Frustum(const glm::mat4& a_rViewProjectionMatrix);
+	~Frustum() {}
+
+	/// <summary>
+	/// Works out whether a box is outside, partly inside, or entirely inside the frustum.
+	/// </summary>
+	/// <param name="a_rBox"> The box to test. </param>
+	/// <returns> How much of the box lies within the frustum. </returns>
+	CONTAINMENT Classify(const BoundingBox<glm::vec3>& a_rBox) const;
+
+private:
+	// Near and far are defined as macros on Windows, so every plane is prefixed.
+	enum PLANE {
+		PLANE_LEFT,
+		PLANE_RIGHT,
+		PLANE_BOTTOM,
+		PLANE_TOP,
+		PLANE_NEAR,
+		PLANE_FAR,
+		PLANE_COUNT
+	};
+
+	/// <summary>
+	/// Each plane's normal, which points into the frustum, and its signed distance from the origin.
+	/// </summary>
+	glm::vec4 m_planes[PLANE_COUNT];
+};
+
+#endif // !FRUSTUM_H
@@ -0,0 +1,80 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+#ifndef HEADLESS_APPLICATION_H
+#define HEADLESS_APPLICATION_H
+
+// Header includes.
+#include "Scene.h"
+
+// Forward declarations.
+class Entity;
+
+/// <summary>
+/// Simulates boids without a window, rendering context, user interface, or models, for running batches of
+/// simulations on machines that can't draw them.
+/// </summary>
+class HeadlessApplication {
+public:
+	/// <summary>
+	/// Creates the application and fills its scene with boids.
+	/// </summary>
+	/// <param name="a_spatialIndexType"> The kind of spatial index that the scene uses to keep track of its
+	/// entities. </param>
+	/// <param name="a_bUseFlockSystem"> True if the boids should be moved together by a flock system, rather than
+	/// each one by its own brain component. </param>
+	/// <param name="a_uiBoidCount"> The number of boids to simulate. </param>
+	/// <param name="a_fDensity"> The number of boids in every 1,000 cubic units, which the scene is sized to fit.
+	/// </param>
+	/// <param name="a_uiSeed"> Seeds the boids' starting positions and random movements. </param>
+	/// <param name="a_uiReevaluationBucketCount"> The number of groups that the boids are split into for steering
+	/// on different steps. Zero uses the scene's default. </param>
+	/// <param name="a_bUseNeighbourLists"> True if boids that are moved by their brain components should find their
+	/// neighbours from the scene's neighbour lists. </param>
+	/// <param name="a_bUseCellAggregates"> True if boids that are moved by their brain components should perceive
+	/// distant boids through the totals kept by each area of the scene's oct-tree. </param>
+	/// <param name="a_fOpeningAngle"> The widest that an area can be, divided by its distance from a boid, for its
+	/// boids to be perceived through their totals. </param>
+	HeadlessApplication(Scene::SPATIAL_INDEX_TYPE a_spatialIndexType,
+		bool a_bUseFlockSystem,
+		unsigned int a_uiBoidCount,
+		float a_fDensity,
+		unsigned int a_uiSeed,
+		unsigned int a_uiReevaluationBucketCount = 0,
+		bool a_bUseNeighbourLists = false,
+		bool a_bUseCellAggregates = false,
+		float a_fOpeningAngle = 0.5f);
+	~HeadlessApplication();
+
+	/// <summary>
+	/// Updates the scene a number of times by one of its fixed steps each, then prints how quickly the boids were
+	/// updated and a histogram of how long each step took.
+	/// </summary>
+	/// <param name="a_uiFrameCount"> The number of times to update the scene. </param>
+	void Run(unsigned int a_uiFrameCount);
+
+private:
+	/// <summary>
+	/// Returns how far the scene should reach out from its centre along each axis to fit a number of boids at a
+	/// density.
+	/// </summary>
+	/// <param name="a_uiBoidCount"> The number of boids that the scene has to fit. </param>
+	/// <param name="a_fDensity"> The number of boids in every 1,000 cubic units. </param>
+	static float GetSceneExtent(unsigned int a_uiBoidCount,
+		float a_fDensity);
+	/// <summary>
+	/// Creates a new boid entity, which has no model so that nothing needs to be loaded.
+	/// </summary>
+	/// <returns> A pointer to the newly created boid entity. </returns>
+	Entity* CreateBoid();
+
+	unsigned int m_uiBoidCount;
+	/// <summary>
+	/// A pointer to a program that handles creating, updating, and destroying entities.
+	/// </summary>
+	Scene* m_pScene;
+};
+
+#endif // !HEADLESS_APPLICATION_H
@@ -0,0 +1,578 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+#ifndef LINEAR_OCT_TREE_H
+#define LINEAR_OCT_TREE_H
+
+// Header includes.
+#include "Boundary.h"
+#include "BoundingBox.h"
+#include "glm/glm.hpp"
+#include "SpatialIndex.h"
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+/// <summary>
+/// An oct-tree that's stored in a few contiguous arrays instead of a hierarchy of separately allocated areas.
+/// Every update the objects are sorted along a Morton (Z-order) curve, which places the objects of each area, at
+/// every level of subdivision, next to each other. The areas are then stored in one array, where each area refers to
+/// a range of the sorted objects and a range of the areas that subdivide it.
+/// </summary>
+/// <typeparam name="TObject"> The type of object to keep track of. Can be an incomplete type. </typeparam>
+/// <typeparam name="TVector"> The type of vector that stores each object's position. Must be a complete type. </typeparam>
+template <typename TObject, typename TVector>
+class LinearOctTree : public SpatialIndex<TObject, TVector> {
+public:
+	typedef typename SpatialIndex<TObject, TVector>::QueryCallback QueryCallback;
+	typedef typename SpatialIndex<TObject, TVector>::NearestObject NearestObject;
+
+	/// <summary>
+	/// An object that's registered with the oct-tree.
+	/// </summary>
+	struct ObjectEntry {
+		TObject* pObject;
+		/// <summary>
+		/// The object's boundary, which follows the object as it moves.
+		/// </summary>
+		const Boundary<TVector>* pBoundary;
+		/// <summary>
+		/// A copy of the object's bounds from when the oct-tree was last updated.
+		/// </summary>
+		BoundingBox<TVector> bounds;
+		/// <summary>
+		/// Where the object was placed within the sorted objects during the last update, or msc_uiUnsortedIndex if
+		/// it was registered after that.
+		/// </summary>
+		unsigned int uiSortedIndex;
+	};
+
+	/// <summary>
+	/// Creates a new oct-tree.
+	/// </summary>
+	/// <param name="a_capacity"> The maximum number of objects that can exist within a single area of the
+	/// oct-tree before it's subdivided. </param>
+	/// <param name="a_position"> The oct-tree's central position. </param>
+	/// <param name="a_dimensions"> The oct-tree's width, height, and depth as measured outward from its central
+	/// position. </param>
+	LinearOctTree(unsigned int a_capacity,
+		TVector a_position,
+		TVector a_dimensions);
+	virtual ~LinearOctTree() {}
+
+	/// <summary>
+	/// Sorts the objects by their current position and rebuilds the oct-tree's areas.
+	/// Always call once per frame, before the oct-tree is queried.
+	/// </summary>
+	virtual void Update();
+
+	/// <summary>
+	/// Registers an object with the oct-tree. The object can be found by queries once the oct-tree has been updated.
+	/// </summary>
+	/// <param name="a_pObject"> The object to register. </param>
+	/// <param name="a_rBoundary"> The object's boundary. </param>
+	/// <returns> True the object was successfully added to the oct-tree. </returns>
+	virtual bool InsertObject(TObject* a_pObject,
+		const Boundary<TVector>& a_rBoundary);
+	/// <summary>
+	/// Unregisters an object from the oct-tree. Its sorted copy is blanked out straight away so that queries can't
+	/// find the object afterwards, and the gap is closed when the oct-tree is next updated.
+	/// </summary>
+	/// <param name="a_pObject"> The object to unregister. </param>
+	/// <returns> True if the object was found and removed from the oct-tree. </returns>
+	virtual bool RemoveObject(TObject* a_pObject);
+	/// <summary>
+	/// Finds every object within a volume of the oct-tree and passes each one to a visitor.
+	/// Objects are tested against their bounds from when the oct-tree was last updated.
+	/// </summary>
+	/// <typeparam name="TVisitor"> A callable type that accepts a TObject pointer. </typeparam>
+	/// <param name="a_rQueryVolume"> The space within the oct-tree that will be searched. </param>
+	/// <param name="a_rVisitor"> Called once for every object that's found within the space to search. </param>
+	template <typename TVisitor>
+	void Query(const BoundingBox<TVector>& a_rQueryVolume,
+		TVisitor&& a_rVisitor) const;
+	virtual void Query(const BoundingBox<TVector>& a_rQueryVolume,
+		std::vector<TObject*>& a_rContainedEntities) const;
+	virtual void Query(const BoundingBox<TVector>& a_rQueryVolume,
+		QueryCallback a_callback,
+		void* a_pUserData) const;
+	/// <summary>
+	/// Finds the objects whose positions are nearest to a position. Areas are searched nearest first, and any area
+	/// that's further away than every object already found is skipped along with its subdivided areas.
+	/// </summary>
+	/// <param name="a_rPosition"> The position to search around. </param>
+	/// <param name="a_uiCount"> The most objects to find. </param>
+	/// <param name="a_rNearestObjects"> Cleared, then filled with the found objects from nearest to furthest. </param>
+	virtual void QueryNearest(const TVector& a_rPosition,
+		unsigned int a_uiCount,
+		std::vector<NearestObject>& a_rNearestObjects) const;
+
+	virtual const BoundingBox<TVector>& GetArea() const;
+	virtual unsigned int GetObjectCount() const;
+	/// <summary>
+	/// Returns the number of areas that the oct-tree was divided into during its last update.
+	/// </summary>
+	inline unsigned int GetNodeCount() const;
+
+private:
+	/// <summary>
+	/// An area of the oct-tree.
+	/// </summary>
+	struct Node {
+		/// <summary>
+		/// The volume of space that the area covers, before being widened by the size of the largest object.
+		/// </summary>
+		BoundingBox<TVector> area;
+		/// <summary>
+		/// The index of the area's first object within the sorted objects.
+		/// </summary>
+		unsigned int uiFirstObject;
+		unsigned int uiObjectCount;
+		/// <summary>
+		/// The index of the area's first subdivided area. Subdivided areas are stored next to each other.
+		/// </summary>
+		unsigned int uiFirstChild;
+		/// <summary>
+		/// The number of subdivided areas that contain objects. Zero if the area hasn't been subdivided.
+		/// </summary>
+		unsigned int uiChildCount;
+	};
+
+	/// <summary>
+	/// The number of bits used to store each axis of a Morton code, giving a 1024 x 1024 x 1024 grid of cells.
+	/// </summary>
+	static const unsigned int msc_uiBitsPerAxis = 10;
+	/// <summary>
+	/// The deepest that the oct-tree can be subdivided, where each area is a single cell of the Morton grid.
+	/// </summary>
+	static const unsigned int msc_uiMaximumDepth = msc_uiBitsPerAxis;
+	/// <summary>
+	/// Marks objects that haven't been sorted yet.
+	/// </summary>
+	static const unsigned int msc_uiUnsortedIndex = ~0u;
+
+	/// <summary>
+	/// Sorts the registered objects by Morton code and divides them into areas.
+	/// </summary>
+	void Rebuild();
+	/// <summary>
+	/// Sorts the Morton codes, along with the index of each code's object, from lowest to highest.
+	/// </summary>
+	void RadixSort();
+	/// <summary>
+	/// Spreads the lowest 10 bits of a value out so that there are two zero bits between each of them.
+	/// </summary>
+	/// <param name="a_uiValue"> The value to spread out. </param>
+	/// <returns> The spread out value. </returns>
+	static inline unsigned int SpreadBits(unsigned int a_uiValue);
+
+	/// <summary>
+	/// The maximum number of objects that can exist within a single area of an oct-tree before it's subdivided.
+	/// </summary>
+	unsigned int m_uiCapacity;
+	/// <summary>
+	/// Represents the area that the oct-tree covers.
+	/// </summary>
+	BoundingBox<TVector> m_area;
+	/// <summary>
+	/// The volume of space that was divided into the Morton grid during the last update. Covers the oct-tree's area
+	/// and any objects that have moved outside of it.
+	/// </summary>
+	BoundingBox<TVector> m_sortedArea;
+	/// <summary>
+	/// The largest width, height, and depth of any object that's registered with the oct-tree. Areas are widened by
+	/// this much when they're queried because objects are only sorted by their position.
+	/// </summary>
+	TVector m_objectDimensions;
+	/// <summary>
+	/// Every object that's registered with the oct-tree, in the order they were registered.
+	/// </summary>
+	std::vector<ObjectEntry> m_objects;
+	/// <summary>
+	/// Where each registered object is stored within the registered objects, so objects can be removed without
+	/// searching for them.
+	/// </summary>
+	std::unordered_map<TObject*, unsigned int> m_objectSlots;
+	/// <summary>
+	/// The registered objects, sorted by Morton code. Objects that have been removed since the last update are left
+	/// in place with a null object pointer.
+	/// </summary>
+	std::vector<ObjectEntry> m_sortedObjects;
+	/// <summary>
+	/// Every area of the oct-tree, starting with the area that covers everything.
+	/// </summary>
+	std::vector<Node> m_nodes;
+	/// <summary>
+	/// The Morton code of each sorted object.
+	/// </summary>
+	std::vector<unsigned int> m_mortonCodes;
+	/// <summary>
+	/// The index within the registered objects of each sorted object.
+	/// </summary>
+	std::vector<unsigned int> m_objectIndices;
+	/// <summary>
+	/// Working space for the radix sort.
+	/// </summary>
+	std::vector<unsigned int> m_sortingCodes;
+	std::vector<unsigned int> m_sortingIndices;
+};
+
+template <typename TObject, typename TVector>
+LinearOctTree<TObject, TVector>::LinearOctTree(unsigned int a_capacity,
+	TVector a_position,
+	TVector a_dimensions) : m_uiCapacity(a_capacity > 0 ? a_capacity : 1),
+	m_area(a_position, a_dimensions),
+	m_sortedArea(a_position, a_dimensions),
+	m_objectDimensions(0.0f),
+	m_objects(),
+	m_objectSlots(),
+	m_sortedObjects(),
+	m_nodes(),
+	m_mortonCodes(),
+	m_objectIndices(),
+	m_sortingCodes(),
+	m_sortingIndices() {}
+
+template <typename TObject, typename TVector>
+void LinearOctTree<TObject, TVector>::Update() {
+	Rebuild();
+}
+
+template <typename TObject, typename TVector>
+bool LinearOctTree<TObject, TVector>::InsertObject(TObject* a_pObject,
+	const Boundary<TVector>& a_rBoundary) {
+	if (!a_pObject || !a_rBoundary.GetPosition()) {
+		return false;
+	}
+
+	ObjectEntry entry;
+	entry.pObject = a_pObject;
+	entry.pBoundary = &a_rBoundary;
+	entry.bounds = a_rBoundary.GetBoundingBox();
+	entry.uiSortedIndex = msc_uiUnsortedIndex;
+	m_objectSlots[a_pObject] = m_objects.size();
+	m_objects.push_back(entry);
+	return true;
+}
+
+template <typename TObject, typename TVector>
+bool LinearOctTree<TObject, TVector>::RemoveObject(TObject* a_pObject) {
+	typename std::unordered_map<TObject*, unsigned int>::iterator slot = m_objectSlots.find(a_pObject);
+
+	if (slot == m_objectSlots.end()) {
+		return false;
+	}
+
+	const unsigned int i = slot->second;
+	m_objectSlots.erase(slot);
+
+	// Rebuilding here would make removing many objects at once take quadratic time, so the sorted objects are only
+	// fixed up when the oct-tree is next updated.
+	if (m_objects[i].uiSortedIndex != msc_uiUnsortedIndex) {
+		m_sortedObjects[m_objects[i].uiSortedIndex].pObject = nullptr;
+	}
+
+	// The order of the objects doesn't matter, so fill the gap with the last object.
+	m_objects[i] = m_objects.back();
+	m_objects.pop_back();
+
+	if (i < m_objects.size()) {
+		m_objectSlots[m_objects[i].pObject] = i;
+	}
+
+	return true;
+}
+
+template <typename TObject, typename TVector>
+void LinearOctTree<TObject, TVector>::Rebuild() {
+	const unsigned int objectCount = m_objects.size();
+	m_nodes.clear();
+	m_mortonCodes.resize(objectCount);
+	m_objectIndices.resize(objectCount);
+	// Objects that have left the oct-tree's area are still sorted, so grow the sorted area to cover them.
+	TVector minimum = m_area.GetPosition() - m_area.GetDimensions();
+	TVector maximum = m_area.GetPosition() + m_area.GetDimensions();
+
+	for (ObjectEntry& rObject : m_objects) {
+		if (rObject.pBoundary && rObject.pBoundary->GetPosition()) {
+			rObject.bounds = rObject.pBoundary->GetBoundingBox();
+		}
+
+		m_objectDimensions = glm::max(m_objectDimensions, rObject.bounds.GetDimensions());
+		minimum = glm::min(minimum, rObject.bounds.GetPosition());
+		maximum = glm::max(maximum, rObject.bounds.GetPosition());
+	}
+
+	m_sortedArea = BoundingBox<TVector>((minimum + maximum) * 0.5f, (maximum - minimum) * 0.5f);
+	const float cellsPerAxis = static_cast<float>(1 << msc_uiBitsPerAxis);
+	const TVector sortedSize = maximum - minimum;
+	// Guard against a flat area, which would otherwise divide by zero.
+	const TVector cellScale(sortedSize.x > 0.0f ? cellsPerAxis / sortedSize.x : 0.0f,
+		sortedSize.y > 0.0f ? cellsPerAxis / sortedSize.y : 0.0f,
+		sortedSize.z > 0.0f ? cellsPerAxis / sortedSize.z : 0.0f);
+
+	for (unsigned int i = 0; i < objectCount; ++i) {
+		const TVector cell = glm::clamp((m_objects[i].bounds.GetPosition() - minimum) * cellScale,
+			TVector(0.0f),
+			TVector(cellsPerAxis - 1.0f));
+		m_mortonCodes[i] = SpreadBits(static_cast<unsigned int>(cell.x)) |
+			(SpreadBits(static_cast<unsigned int>(cell.y)) << 1) |
+			(SpreadBits(static_cast<unsigned int>(cell.z)) << 2);
+		m_objectIndices[i] = i;
+	}
+
+	RadixSort();
+	m_sortedObjects.resize(objectCount);
+
+	for (unsigned int i = 0; i < objectCount; ++i) {
+		m_objects[m_objectIndices[i]].uiSortedIndex = i;
+		m_sortedObjects[i] = m_objects[m_objectIndices[i]];
+	}
+
+	if (objectCount == 0) {
+		return;
+	}
+
+	Node root;
+	root.area = m_sortedArea;
+	root.uiFirstObject = 0;
+	root.uiObjectCount = objectCount;
+	root.uiFirstChild = 0;
+	root.uiChildCount = 0;
+	m_nodes.push_back(root);
+	// The depth of the areas that are currently being subdivided, and where the next depth's areas start.
+	unsigned int depth = 0;
+	unsigned int nextDepthStart = 1;
+
+	// Areas are subdivided in the order they were created, so each depth is stored after the one above it and the
+	// subdivided areas of each area are stored next to each other.
+	for (unsigned int nodeIndex = 0; nodeIndex < m_nodes.size(); ++nodeIndex) {
+		if (nodeIndex == nextDepthStart) {
+			++depth;
+			nextDepthStart = m_nodes.size();
+		}
+
+		if (m_nodes[nodeIndex].uiObjectCount <= m_uiCapacity || depth >= msc_uiMaximumDepth) {
+			continue;
+		}
+
+		const Node node = m_nodes[nodeIndex];
+		// The three bits of the Morton code that choose a subdivided area at the next depth.
+		const unsigned int shift = 3 * (msc_uiMaximumDepth - depth - 1);
+		const TVector childDimensions = node.area.GetDimensions() * 0.5f;
+		const TVector areaMinimum = node.area.GetPosition() - node.area.GetDimensions();
+		m_nodes[nodeIndex].uiFirstChild = m_nodes.size();
+		unsigned int objectIndex = node.uiFirstObject;
+		const unsigned int lastObject = node.uiFirstObject + node.uiObjectCount;
+
+		// Objects within the area are already sorted, so each subdivided area's objects follow the previous one's.
+		while (objectIndex < lastObject) {
+			const unsigned int octant = (m_mortonCodes[objectIndex] >> shift) & 7;
+			Node child;
+			child.uiFirstObject = objectIndex;
+
+			while (objectIndex < lastObject && ((m_mortonCodes[objectIndex] >> shift) & 7) == octant) {
+				++objectIndex;
+			}
+
+			child.uiObjectCount = objectIndex - child.uiFirstObject;
+			child.uiFirstChild = 0;
+			child.uiChildCount = 0;
+			const TVector offset(static_cast<float>(octant & 1),
+				static_cast<float>((octant >> 1) & 1),
+				static_cast<float>((octant >> 2) & 1));
+			child.area = BoundingBox<TVector>(areaMinimum + childDimensions + offset * childDimensions * 2.0f,
+				childDimensions);
+			m_nodes.push_back(child);
+			++m_nodes[nodeIndex].uiChildCount;
+		}
+	}
+}
+
+template <typename TObject, typename TVector>
+void LinearOctTree<TObject, TVector>::RadixSort() {
+	const unsigned int objectCount = m_mortonCodes.size();
+	const unsigned int bitsPerPass = 8;
+	const unsigned int bucketCount = 1 << bitsPerPass;
+	const unsigned int codeBits = 3 * msc_uiBitsPerAxis;
+	m_sortingCodes.resize(objectCount);
+	m_sortingIndices.resize(objectCount);
+
+	for (unsigned int shift = 0; shift < codeBits; shift += bitsPerPass) {
+		unsigned int bucketStarts[bucketCount] = {};
+
+		for (unsigned int i = 0; i < objectCount; ++i) {
+			++bucketStarts[(m_mortonCodes[i] >> shift) & (bucketCount - 1)];
+		}
+
+		// Turn the counts into each bucket's starting index.
+		unsigned int total = 0;
+
+		for (unsigned int bucket = 0; bucket < bucketCount; ++bucket) {
+			const unsigned int count = bucketStarts[bucket];
+			bucketStarts[bucket] = total;
+			total += count;
+		}
+
+		// Placing the codes in order within each bucket keeps the sort stable, so earlier passes aren't undone.
+		for (unsigned int i = 0; i < objectCount; ++i) {
+			const unsigned int destination = bucketStarts[(m_mortonCodes[i] >> shift) & (bucketCount - 1)]++;
+			m_sortingCodes[destination] = m_mortonCodes[i];
+			m_sortingIndices[destination] = m_objectIndices[i];
+		}
+
+		m_mortonCodes.swap(m_sortingCodes);
+		m_objectIndices.swap(m_sortingIndices);
+	}
+}
+
+template <typename TObject, typename TVector>
+template <typename TVisitor>
+void LinearOctTree<TObject, TVector>::Query(const BoundingBox<TVector>& a_rQueryVolume,
+	TVisitor&& a_rVisitor) const {
+	if (m_nodes.empty()) {
+		return;
+	}
+
+	// Each subdivided area is pushed at most once for every depth, so the stack never needs to grow.
+	unsigned int nodeStack[8 * msc_uiMaximumDepth + 1];
+	unsigned int stackSize = 0;
+	nodeStack[stackSize++] = 0;
+
+	while (stackSize > 0) {
+		const Node& rNode = m_nodes[nodeStack[--stackSize]];
+
+		// Objects are sorted by their position alone, so widen the area to reach any object that pokes into the
+		// queried volume from a neighbouring area.
+		if (!a_rQueryVolume.Overlaps(BoundingBox<TVector>(rNode.area.GetPosition(),
+			rNode.area.GetDimensions() + m_objectDimensions))) {
+			continue;
+		}
+
+		if (rNode.uiChildCount > 0) {
+			for (unsigned int i = 0; i < rNode.uiChildCount; ++i) {
+				nodeStack[stackSize++] = rNode.uiFirstChild + i;
+			}
+
+			continue;
+		}
+
+		for (unsigned int i = rNode.uiFirstObject; i < rNode.uiFirstObject + rNode.uiObjectCount; ++i) {
+			const ObjectEntry& rObject = m_sortedObjects[i];
+
+			if (rObject.pObject && a_rQueryVolume.Overlaps(rObject.bounds)) {
+				a_rVisitor(rObject.pObject);
+			}
+		}
+	}
+}
+
+template <typename TObject, typename TVector>
+void LinearOctTree<TObject, TVector>::Query(const BoundingBox<TVector>& a_rQueryVolume,
+	std::vector<TObject*>& a_rContainedEntities) const {
+	Query(a_rQueryVolume, [&a_rContainedEntities](TObject* a_pObject) {
+		a_rContainedEntities.push_back(a_pObject);
+	});
+}
+
+template <typename TObject, typename TVector>
+void LinearOctTree<TObject, TVector>::Query(const BoundingBox<TVector>& a_rQueryVolume,
+	QueryCallback a_callback,
+	void* a_pUserData) const {
+	Query(a_rQueryVolume, [a_callback, a_pUserData](TObject* a_pObject) {
+		a_callback(a_pObject, a_pUserData);
+	});
+}
+
+template <typename TObject, typename TVector>
+void LinearOctTree<TObject, TVector>::QueryNearest(const TVector& a_rPosition,
+	unsigned int a_uiCount,
+	std::vector<NearestObject>& a_rNearestObjects) const {
+	a_rNearestObjects.clear();
+
+	if (m_nodes.empty() || a_uiCount == 0) {
+		return;
+	}
+
+	// Each area's distance is kept alongside it so that it can be skipped when it's popped, if enough nearer objects
+	// have been found since it was pushed.
+	unsigned int nodeStack[8 * msc_uiMaximumDepth + 1];
+	float distanceStack[8 * msc_uiMaximumDepth + 1];
+	unsigned int stackSize = 0;
+	nodeStack[stackSize] = 0;
+	distanceStack[stackSize++] = 0.0f;
+
+	while (stackSize > 0) {
+		--stackSize;
+
+		if (!this->CanBeNearer(a_rNearestObjects, a_uiCount, distanceStack[stackSize])) {
+			continue;
+		}
+
+		const Node& rNode = m_nodes[nodeStack[stackSize]];
+
+		if (rNode.uiChildCount > 0) {
+			// Pushes the subdivided areas furthest first, so the nearest is searched first.
+			const unsigned int firstChild = stackSize;
+
+			for (unsigned int i = 0; i < rNode.uiChildCount; ++i) {
+				const unsigned int childIndex = rNode.uiFirstChild + i;
+				const float childDistance = this->GetSquaredDistance(m_nodes[childIndex].area, a_rPosition);
+				unsigned int j = stackSize++;
+
+				for (; j > firstChild && distanceStack[j - 1] < childDistance; --j) {
+					nodeStack[j] = nodeStack[j - 1];
+					distanceStack[j] = distanceStack[j - 1];
+				}
+
+				nodeStack[j] = childIndex;
+				distanceStack[j] = childDistance;
+			}
+
+			continue;
+		}
+
+		for (unsigned int i = rNode.uiFirstObject; i < rNode.uiFirstObject + rNode.uiObjectCount; ++i) {
+			const ObjectEntry& rObject = m_sortedObjects[i];
+
+			if (!rObject.pObject) {
+				continue;
+			}
+
+			const TVector offset = rObject.bounds.GetPosition() - a_rPosition;
+			const NearestObject nearestObject = { glm::dot(offset, offset), rObject.pObject };
+			this->AddNearestObject(a_rNearestObjects, a_uiCount, nearestObject);
+		}
+	}
+
+	std::sort_heap(a_rNearestObjects.begin(), a_rNearestObjects.end());
+}
+
+template <typename TObject, typename TVector>
+unsigned int LinearOctTree<TObject, TVector>::SpreadBits(unsigned int a_uiValue) {
+	a_uiValue &= 0x000003ff;
+	a_uiValue = (a_uiValue | (a_uiValue << 16)) & 0x030000ff;
+	a_uiValue = (a_uiValue | (a_uiValue << 8)) & 0x0300f00f;
+	a_uiValue = (a_uiValue | (a_uiValue << 4)) & 0x030c30c3;
+	a_uiValue = (a_uiValue | (a_uiValue << 2)) & 0x09249249;
+	return a_uiValue;
+}
+
+template <typename TObject, typename TVector>
+const BoundingBox<TVector>& LinearOctTree<TObject, TVector>::GetArea() const {
+	return m_area;
+}
+
+template <typename TObject, typename TVector>
+unsigned int LinearOctTree<TObject, TVector>::GetObjectCount() const {
+	return m_objects.size();
+}
+
+template <typename TObject, typename TVector>
+unsigned int LinearOctTree<TObject, TVector>::GetNodeCount() const {
+	return m_nodes.size();
+}
+
+#endif // !LINEAR_OCT_TREE_H
@@ -19,8 +19,13 @@ class Model;
 /// <summary>
 /// Renders a 3D model on-screen for an entity.
 /// </summary>
-class ModelComponent : public Component {
+class ModelComponent final : public Component {
 public:
+	/// <summary>
+	/// The type that the component is attached to entities as, which also picks the pool that scenes store it in.
+	/// </summary>
+	static const COMPONENT_TYPE msc_componentType = COMPONENT_TYPE_MODEL;
+
 	ModelComponent(Entity* a_owner);
 	ModelComponent(Entity* a_owner,
 		ModelComponent& a_rModelToCopy);
@@ -29,6 +34,13 @@ public:
 	virtual void Update(float a_fDeltaTime);
 	virtual void Draw(Framework* a_pRenderingFramework);
 	/// <summary>
+	/// Adds the model to a snapshot, sized by the entity's collider for culling if it has one.
+	/// </summary>
+	/// <param name="a_rSnapshot"> The snapshot to add the model to. </param>
+	virtual void WriteSnapshot(SceneSnapshot& a_rSnapshot) const;
+	virtual Component* Clone(Entity* a_pOwner,
+		Scene* a_pScene);
+	/// <summary>
 	/// Loads a model to represent the entity.
 	/// </summary>
 	/// <param name="a_pFilepath"></param>
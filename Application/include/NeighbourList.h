@@ -0,0 +1,165 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+#ifndef NEIGHBOUR_LIST_H
+#define NEIGHBOUR_LIST_H
+
+// Header includes.
+#include "BoundingBox.h"
+#include "glm/glm.hpp"
+#include "SpatialIndex.h"
+#include <vector>
+
+// Forward declarations.
+class Entity;
+
+/// <summary>
+/// Remembers the entities around each boid, found by querying a spatial index with a neighbourhood that's widened by
+/// a skin distance. Boids only move a little each step, so the lists stay complete until some entity has moved
+/// further than half of the skin, and most steps find each boid's neighbours from its list without a query.
+/// Entities report where they've moved to as they're integrated, so finding out whether the lists are out-of-date
+/// doesn't take a pass over every entity. Every list is stored back-to-back in one array, with the lists' starts in
+/// another.
+/// </summary>
+class NeighbourList {
+public:
+	/// <param name="a_fSkinDistance"> How much further than its neighbour distance each boid's list reaches. Wider
+	/// skins need rebuilding less often, but hold more entities that have to be filtered out. </param>
+	NeighbourList(float a_fSkinDistance);
+	~NeighbourList() {}
+
+	/// <summary>
+	/// Rebuilds the lists if they're stale, or if any entity has reported moving more than half of the skin distance
+	/// since they were last built.
+	/// </summary>
+	/// <param name="a_rSpatialIndex"> The spatial index that the lists are built from, which must be up-to-date.
+	/// </param>
+	/// <param name="a_rEntities"> Every entity, indexed by the slot that it's stored in. Entities with a brain
+	/// component get a list. </param>
+	void Update(const SpatialIndex<Entity, glm::vec3>& a_rSpatialIndex,
+		const std::vector<Entity*>& a_rEntities);
+	/// <summary>
+	/// Marks the lists as stale, such as when entities are added or destroyed, so none are used until they've been
+	/// rebuilt.
+	/// </summary>
+	inline void Invalidate();
+	/// <summary>
+	/// Notes whether an entity has moved more than half of the skin distance since the lists were built, so that
+	/// they're rebuilt on their next update.
+	/// </summary>
+	/// <param name="a_uiSlot"> The slot that the entity is stored in. </param>
+	/// <param name="a_rPosition"> Where the entity has moved to. </param>
+	inline void CheckMovement(unsigned int a_uiSlot,
+		const glm::vec3& a_rPosition);
+
+	/// <summary>
+	/// Finds the entities in a boid's list whose colliders overlap a volume, which are the same entities that
+	/// querying the spatial index with the volume would find.
+	/// </summary>
+	/// <param name="a_uiSlot"> The slot that the boid's entity is stored in. </param>
+	/// <param name="a_rVolume"> The boid's neighbourhood, which mustn't reach beyond the one its list was built
+	/// with. </param>
+	/// <param name="a_rNeighbours"> The found entities are added to the end of this collection. </param>
+	/// <returns> False if the boid has no list, or the lists are stale, in which case nothing is added. </returns>
+	bool GetNeighbours(unsigned int a_uiSlot,
+		const BoundingBox<glm::vec3>& a_rVolume,
+		std::vector<Entity*>& a_rNeighbours) const;
+
+	inline float GetSkinDistance() const;
+	/// <summary>
+	/// Returns the number of times that the lists have been checked for being out-of-date.
+	/// </summary>
+	inline unsigned int GetUpdateCount() const;
+	/// <summary>
+	/// Returns the number of times that the lists have been rebuilt.
+	/// </summary>
+	inline unsigned int GetBuildCount() const;
+	/// <summary>
+	/// Returns the fraction of updates that rebuilt the lists, from zero to one.
+	/// </summary>
+	inline float GetRebuildRate() const;
+	/// <summary>
+	/// Returns the number of entities in every list put together.
+	/// </summary>
+	inline unsigned int GetNeighbourCount() const;
+
+private:
+	/// <summary>
+	/// Queries the spatial index for every boid's widened neighbourhood and records where each entity is.
+	/// </summary>
+	void Rebuild(const SpatialIndex<Entity, glm::vec3>& a_rSpatialIndex,
+		const std::vector<Entity*>& a_rEntities);
+
+	const float mc_fSkinDistance;
+	/// <summary>
+	/// Where each slot's list starts in the neighbour array, plus one more for where the last list ends. Slots
+	/// without a boid have empty lists.
+	/// </summary>
+	std::vector<unsigned int> m_listStarts;
+	/// <summary>
+	/// Every list, one after another.
+	/// </summary>
+	std::vector<Entity*> m_neighbours;
+	/// <summary>
+	/// Where the entity in each slot was when the lists were built.
+	/// </summary>
+	std::vector<glm::vec3> m_buildPositions;
+	/// <summary>
+	/// Which slots held an entity when the lists were built.
+	/// </summary>
+	std::vector<bool> m_builtSlots;
+	unsigned int m_uiUpdateCount;
+	unsigned int m_uiBuildCount;
+	/// <summary>
+	/// True if the lists may hold entities that no longer exist, or be missing ones that do.
+	/// </summary>
+	bool m_bIsStale;
+	/// <summary>
+	/// True if some entity has moved far enough since the lists were built that they may be missing neighbours.
+	/// </summary>
+	bool m_bHasMovedTooFar;
+};
+
+void NeighbourList::Invalidate() {
+	m_bIsStale = true;
+}
+
+void NeighbourList::CheckMovement(unsigned int a_uiSlot,
+	const glm::vec3& a_rPosition) {
+	// Entities added since the lists were built have already made them stale.
+	if (m_bIsStale || a_uiSlot >= m_buildPositions.size()) {
+		return;
+	}
+
+	// Two entities that each move half of the skin can close the whole skin between them, but no more.
+	const float maximumDistance = mc_fSkinDistance * 0.5f;
+	const glm::vec3 movement = a_rPosition - m_buildPositions[a_uiSlot];
+
+	if (glm::dot(movement, movement) > maximumDistance * maximumDistance) {
+		m_bHasMovedTooFar = true;
+	}
+}
+
+float NeighbourList::GetSkinDistance() const {
+	return mc_fSkinDistance;
+}
+
+unsigned int NeighbourList::GetUpdateCount() const {
+	return m_uiUpdateCount;
+}
+
+unsigned int NeighbourList::GetBuildCount() const {
+	return m_uiBuildCount;
+}
+
+float NeighbourList::GetRebuildRate() const {
+	return m_uiUpdateCount > 0 ? static_cast<float>(m_uiBuildCount) / m_uiUpdateCount : 0.0f;
+}
+
+unsigned int NeighbourList::GetNeighbourCount() const {
+	return m_neighbours.size();
+}
+
+#endif // !NEIGHBOUR_LIST_H
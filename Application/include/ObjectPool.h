@@ -0,0 +1,203 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+#ifndef OBJECT_POOL_H
+#define OBJECT_POOL_H
+
+// Header includes.
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/// <summary>
+/// Refers to an object in a pool by the slot it's stored in and how many times that slot has been reused, so that a
+/// handle to an object that's been destroyed can be told apart from one to whatever replaced it.
+/// </summary>
+struct PoolHandle {
+	PoolHandle() : uiIndex(0),
+		uiGeneration(0) {}
+	PoolHandle(unsigned int a_uiIndex,
+		unsigned int a_uiGeneration) : uiIndex(a_uiIndex),
+		uiGeneration(a_uiGeneration) {}
+
+	inline bool operator==(const PoolHandle& a_rOther) const;
+	inline bool operator!=(const PoolHandle& a_rOther) const;
+
+	unsigned int uiIndex;
+	/// <summary>
+	/// Never zero for an object that's been created, so a default handle never refers to anything.
+	/// </summary>
+	unsigned int uiGeneration;
+};
+
+bool PoolHandle::operator==(const PoolHandle& a_rOther) const {
+	return uiIndex == a_rOther.uiIndex && uiGeneration == a_rOther.uiGeneration;
+}
+
+bool PoolHandle::operator!=(const PoolHandle& a_rOther) const {
+	return !(*this == a_rOther);
+}
+
+/// <summary>
+/// Lets pools of different types of object be destroyed and have their objects destroyed without knowing the types.
+/// </summary>
+class ObjectPoolBase {
+public:
+	virtual ~ObjectPoolBase() {}
+
+	/// <summary>
+	/// Destroys an object and frees its slot to be reused.
+	/// </summary>
+	/// <param name="a_handle"> The handle to the object. </param>
+	/// <returns> False if the handle doesn't refer to a live object, such as one that's already been destroyed.
+	/// </returns>
+	virtual bool Destroy(PoolHandle a_handle) = 0;
+};
+
+/// <summary>
+/// Stores objects of one type in fixed-size chunks of contiguous memory, reusing the slots of destroyed objects so
+/// that creating and destroying objects is constant time and doesn't touch the heap once the pool has grown.
+/// Objects never move once they've been created, so pointers to them stay valid until they're destroyed.
+/// </summary>
+/// <typeparam name="T"> The type of object to store. </typeparam>
+template <typename T>
+class ObjectPool : public ObjectPoolBase {
+public:
+	/// <summary>
+	/// Creates an empty pool.
+	/// </summary>
+	/// <param name="a_uiChunkSize"> The number of objects that each chunk of memory holds. </param>
+	ObjectPool(unsigned int a_uiChunkSize = 256);
+	ObjectPool(const ObjectPool&) = delete;
+	ObjectPool& operator=(const ObjectPool&) = delete;
+	/// <summary>
+	/// Destroys every object that's still alive.
+	/// </summary>
+	~ObjectPool();
+
+	/// <summary>
+	/// Constructs an object in a free slot, growing the pool by a chunk if there isn't one.
+	/// </summary>
+	/// <param name="a_rHandle"> Set to the new object's handle. </param>
+	/// <param name="a_rArguments"> Passed to the object's constructor. </param>
+	/// <returns> A pointer to the new object. </returns>
+	template <typename... TArguments>
+	T* Create(PoolHandle& a_rHandle,
+		TArguments&&... a_rArguments);
+	bool Destroy(PoolHandle a_handle) override;
+	/// <summary>
+	/// Returns the object that a handle refers to, or null if the object has been destroyed.
+	/// </summary>
+	inline T* Get(PoolHandle a_handle) const;
+
+	/// <summary>
+	/// Returns the number of live objects.
+	/// </summary>
+	inline unsigned int GetCount() const;
+	/// <summary>
+	/// Returns the number of objects that the pool can hold before it needs another chunk.
+	/// </summary>
+	inline unsigned int GetCapacity() const;
+
+private:
+	typedef typename std::aligned_storage<sizeof(T), alignof(T)>::type Storage;
+
+	const unsigned int mc_uiChunkSize;
+	std::vector<std::unique_ptr<Storage[]>> m_chunks;
+	/// <summary>
+	/// The live object in each slot, or null if the slot is free.
+	/// </summary>
+	std::vector<T*> m_objects;
+	/// <summary>
+	/// The number of times that each slot has been filled.
+	/// </summary>
+	std::vector<unsigned int> m_generations;
+	/// <summary>
+	/// The slots that are free to reuse, the most recently freed last.
+	/// </summary>
+	std::vector<unsigned int> m_freeSlots;
+	unsigned int m_uiCount;
+};
+
+template <typename T>
+ObjectPool<T>::ObjectPool(unsigned int a_uiChunkSize) : mc_uiChunkSize(a_uiChunkSize > 0 ? a_uiChunkSize : 1),
+	m_chunks(),
+	m_objects(),
+	m_generations(),
+	m_freeSlots(),
+	m_uiCount(0) {}
+
+template <typename T>
+ObjectPool<T>::~ObjectPool() {
+	for (T* pObject : m_objects) {
+		if (pObject) {
+			pObject->~T();
+		}
+	}
+}
+
+template <typename T>
+template <typename... TArguments>
+T* ObjectPool<T>::Create(PoolHandle& a_rHandle,
+	TArguments&&... a_rArguments) {
+	if (m_freeSlots.empty()) {
+		// Free slots are taken from the back, so push the new chunk's slots in reverse to fill it from the front.
+		const unsigned int firstSlot = m_objects.size();
+		m_chunks.push_back(std::unique_ptr<Storage[]>(new Storage[mc_uiChunkSize]));
+		m_objects.resize(firstSlot + mc_uiChunkSize, nullptr);
+		m_generations.resize(firstSlot + mc_uiChunkSize, 0);
+
+		for (unsigned int i = mc_uiChunkSize; i > 0; --i) {
+			m_freeSlots.push_back(firstSlot + i - 1);
+		}
+	}
+
+	const unsigned int slot = m_freeSlots.back();
+	Storage* pStorage = &m_chunks[slot / mc_uiChunkSize][slot % mc_uiChunkSize];
+	T* pObject = new (pStorage) T(std::forward<TArguments>(a_rArguments)...);
+	m_freeSlots.pop_back();
+	m_objects[slot] = pObject;
+	++m_uiCount;
+	a_rHandle = PoolHandle(slot, ++m_generations[slot]);
+	return pObject;
+}
+
+template <typename T>
+bool ObjectPool<T>::Destroy(PoolHandle a_handle) {
+	T* pObject = Get(a_handle);
+
+	if (!pObject) {
+		return false;
+	}
+
+	pObject->~T();
+	m_objects[a_handle.uiIndex] = nullptr;
+	m_freeSlots.push_back(a_handle.uiIndex);
+	--m_uiCount;
+	return true;
+}
+
+template <typename T>
+T* ObjectPool<T>::Get(PoolHandle a_handle) const {
+	if (a_handle.uiIndex >= m_objects.size() || m_generations[a_handle.uiIndex] != a_handle.uiGeneration) {
+		return nullptr;
+	}
+
+	return m_objects[a_handle.uiIndex];
+}
+
+template <typename T>
+unsigned int ObjectPool<T>::GetCount() const {
+	return m_uiCount;
+}
+
+template <typename T>
+unsigned int ObjectPool<T>::GetCapacity() const {
+	return m_objects.size();
+}
+
+#endif // !OBJECT_POOL_H
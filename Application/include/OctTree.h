@@ -8,7 +8,10 @@
 
 // Header includes.
 #include "Boundary.h"
-#include <map>
+#include "BoundingBox.h"
+#include "SpatialIndex.h"
+#include <algorithm>
+#include <unordered_map>
 #include <vector>
 
 /// <summary>
@@ -18,9 +21,54 @@
 /// <typeparam name="TObject"> The type of object to keep track of. Can be an incomplete type. </typeparam>
 /// <typeparam name="TVector"> The type of vector that stores each object's position. Must be a complete type. </typeparam>
 template <typename TObject, typename TVector>
-class OctTree {
+class OctTree : public SpatialIndex<TObject, TVector> {
 public:
-	typedef std::pair<TObject*, const Boundary<TVector>*> ObjectPair;
+	typedef typename SpatialIndex<TObject, TVector>::QueryCallback QueryCallback;
+	typedef typename SpatialIndex<TObject, TVector>::NearestObject NearestObject;
+
+	/// <summary>
+	/// An object that's registered with the oct-tree.
+	/// </summary>
+	struct ObjectEntry {
+		TObject* pObject;
+		/// <summary>
+		/// The object's boundary, which follows the object as it moves.
+		/// </summary>
+		const Boundary<TVector>* pBoundary;
+		/// <summary>
+		/// A copy of the object's bounds from when the oct-tree was last updated. Queries test against this instead of
+		/// the boundary so they never have to follow its position pointer.
+		/// </summary>
+		BoundingBox<TVector> bounds;
+	};
+
+	/// <summary>
+	/// The ways in which the oct-tree can bring itself up-to-date with the positions of its objects.
+	/// </summary>
+	enum UPDATE_MODE {
+		/// <summary>
+		/// Discards every subdivided area and inserts all of the objects again from scratch.
+		/// </summary>
+		UPDATE_MODE_REBUILD,
+		/// <summary>
+		/// Only reinserts the objects that have moved outside of their area and collapses any empty subdivided areas.
+		/// </summary>
+		UPDATE_MODE_REFIT,
+		UPDATE_MODE_COUNT
+	};
+
+	/// <summary>
+	/// Totals over the objects in an area of the oct-tree and its subdivided areas, which can stand in for all of
+	/// those objects once they're far enough away. Kept up-to-date by UpdateAggregates.
+	/// </summary>
+	struct Aggregate {
+		unsigned int uiCount;
+		TVector positionSum;
+		/// <summary>
+		/// The sum of a value that's read from each object when the aggregates are updated, such as its velocity.
+		/// </summary>
+		TVector valueSum;
+	};
 
 	// The digit suffix represents the x, y and z coordinates for a subdivided area within the oct-tree.
 	// E.g. 101 = (x = 1, y = 0, and z = 1).
@@ -46,9 +94,13 @@ public:
 	OctTree(unsigned int a_capacity,
 		TVector a_position,
 		TVector a_dimensions);
-	~OctTree() {}
+	virtual ~OctTree();
 
-	void Draw();
+	/// <summary>
+	/// Moves each object into the area of the oct-tree that matches its current position.
+	/// Always call once per frame, before the oct-tree is queried.
+	/// </summary>
+	virtual void Update();
 
 	/// <summary>
 	/// Registers an object with the oct-tree.
@@ -56,33 +108,200 @@ public:
 	/// <param name="a_pObject"> The object to register. </param>
 	/// <param name="a_rPosition"> The object's position. </param>
 	/// <returns> True the object was successfully added to the oct-tree. </returns>
-	bool InsertObject(TObject* a_pObject,
+	virtual bool InsertObject(TObject* a_pObject,
 		const Boundary<TVector>& a_rPosition);
 	/// <summary>
-	/// Finds an object within the oct-tree.
+	/// Unregisters an object from the oct-tree.
+	/// </summary>
+	/// <param name="a_pObject"> The object to unregister. </param>
+	/// <returns> True if the object was found and removed from the oct-tree. </returns>
+	virtual bool RemoveObject(TObject* a_pObject);
+	/// <summary>
+	/// Finds every object within a volume of the oct-tree and passes each one to a visitor.
+	/// Objects are tested against their bounds from when the oct-tree was last updated.
+	/// </summary>
+	/// <typeparam name="TVisitor"> A callable type that accepts a TObject pointer. </typeparam>
+	/// <param name="a_rQueryVolume"> The space within the oct-tree that will be searched. </param>
+	/// <param name="a_rVisitor"> Called once for every object that's found within the space to search. </param>
+	template <typename TVisitor>
+	void Query(const BoundingBox<TVector>& a_rQueryVolume,
+		TVisitor&& a_rVisitor) const;
+	/// <summary>
+	/// Finds every object within a volume of the oct-tree.
 	/// </summary>
-	/// <param name="a_queryVolume"> The space within the oct-tree that will be searched. </param>
-	/// <param name="a_rContainedEntities"> A collection of all the objects that are found within the space to search. </param>
-	void Query(Boundary<TVector> a_queryVolume,
+	/// <param name="a_rQueryVolume"> The space within the oct-tree that will be searched. </param>
+	/// <param name="a_rContainedEntities"> The found objects are added to the end of this collection, which isn't
+	/// cleared first so that its memory can be reused between queries. </param>
+	virtual void Query(const BoundingBox<TVector>& a_rQueryVolume,
 		std::vector<TObject*>& a_rContainedEntities) const;
+	virtual void Query(const BoundingBox<TVector>& a_rQueryVolume,
+		QueryCallback a_callback,
+		void* a_pUserData) const;
+	/// <summary>
+	/// Finds the objects whose positions are nearest to a position. Areas are searched nearest first, and any area
+	/// that's further away than every object already found is skipped along with its subdivided areas.
+	/// </summary>
+	/// <param name="a_rPosition"> The position to search around. </param>
+	/// <param name="a_uiCount"> The most objects to find. </param>
+	/// <param name="a_rNearestObjects"> Cleared, then filled with the found objects from nearest to furthest. </param>
+	virtual void QueryNearest(const TVector& a_rPosition,
+		unsigned int a_uiCount,
+		std::vector<NearestObject>& a_rNearestObjects) const;
+	/// <summary>
+	/// Adds the edges of every area of the oct-tree to a draw queue's batch of lines, coloured by how many times the
+	/// oct-tree was subdivided to reach them.
+	/// </summary>
+	/// <param name="a_pDrawQueue"> The queue that draws the oct-tree's lines. </param>
+	virtual void Draw(DrawQueue* a_pDrawQueue) const;
+	virtual void WriteSnapshot(SceneSnapshot& a_rSnapshot) const;
+	/// <summary>
+	/// Finds every object that a volume, such as a camera's frustum, can't rule out and passes each one to a visitor.
+	/// Areas that lie outside the volume are skipped whole, and every object in an area that lies entirely inside it
+	/// is visited without being tested. Objects kept by the top level are always tested one by one, as some of them
+	/// may have left the oct-tree's area.
+	/// </summary>
+	/// <typeparam name="TVolume"> Has a Classify function that takes a bounding box and returns TVolume::CONTAINMENT,
+	/// like a frustum. </typeparam>
+	/// <typeparam name="TVisitor"> A callable type that accepts a TObject pointer. </typeparam>
+	/// <param name="a_rVolume"> The volume of space to search. </param>
+	/// <param name="a_rVisitor"> Called once for every object that's found within the volume. </param>
+	template <typename TVolume, typename TVisitor>
+	void QueryVolume(const TVolume& a_rVolume,
+		TVisitor&& a_rVisitor) const;
+	/// <summary>
+	/// Recalculates every area's aggregate from the positions that its objects had when the oct-tree was last
+	/// updated, along with a value that's read from each object. Call after each update, before querying aggregates.
+	/// </summary>
+	/// <typeparam name="TValueGetter"> A callable type that accepts a TObject pointer and a TVector reference to
+	/// write the object's value to, and returns false if the object should be left out of the aggregates. </typeparam>
+	/// <param name="a_rGetValue"> Called once for every object. </param>
+	template <typename TValueGetter>
+	void UpdateAggregates(TValueGetter&& a_rGetValue);
+	/// <summary>
+	/// Finds the objects within a volume like Query, except that subdivided areas which lie entirely inside the volume
+	/// are passed to an aggregate visitor in place of their objects, once they're narrow enough compared to how far
+	/// their objects' average position is from the volume's centre (the Barnes-Hut opening angle).
+	/// The area that contains the volume's centre is always searched object by object.
+	/// </summary>
+	/// <typeparam name="TVisitor"> A callable type that accepts a TObject pointer. </typeparam>
+	/// <typeparam name="TAggregateVisitor"> A callable type that accepts a const Aggregate reference. </typeparam>
+	/// <param name="a_rQueryVolume"> The space within the oct-tree that will be searched. </param>
+	/// <param name="a_fOpeningAngle"> The widest that an area can be, divided by its distance, to be aggregated.
+	/// Zero never aggregates, and wider angles aggregate nearer areas for less accurate but faster queries. </param>
+	/// <param name="a_rVisitor"> Called once for every object that's found outside of an aggregated area. </param>
+	/// <param name="a_rAggregateVisitor"> Called once for every aggregated area. </param>
+	template <typename TVisitor, typename TAggregateVisitor>
+	void QueryAggregates(const BoundingBox<TVector>& a_rQueryVolume,
+		float a_fOpeningAngle,
+		TVisitor&& a_rVisitor,
+		TAggregateVisitor&& a_rAggregateVisitor) const;
+
+	inline void SetUpdateMode(UPDATE_MODE a_updateMode);
 
-	inline const Boundary<TVector>& GetBoundary() const;
+	/// <summary>
+	/// Returns the volume of space that the oct-tree covers.
+	/// </summary>
+	virtual const BoundingBox<TVector>& GetArea() const;
+	inline UPDATE_MODE GetUpdateMode() const;
+	/// <summary>
+	/// Returns the number of objects that are registered with the oct-tree and its subdivided areas.
+	/// </summary>
+	/// <returns> The number of registered objects. </returns>
+	virtual unsigned int GetObjectCount() const;
 
 private:
 	/// <summary>
-	/// Private because the boundary will be copied and lose the ability to render its bounds, which is only okay
-	/// for an oct-tree's subdivided areas.
+	/// Creates one of an oct-tree's subdivided areas.
 	/// </summary>
 	/// <param name="a_capacity"> The maximum number of elements than can exist within a single area of the
 	/// oct-tree before it's subdivided. </param>
-	/// <param name="a_boundary"> The oct-tree's area of coverage. </param>
+	/// <param name="a_rArea"> The oct-tree's area of coverage. </param>
 	OctTree(unsigned int a_capacity,
-		Boundary<TVector> a_boundary);
+		const BoundingBox<TVector>& a_rArea);
+	// Oct-trees own their subdivided areas, so they can't be copied.
+	OctTree(const OctTree&) = delete;
+	OctTree& operator=(const OctTree&) = delete;
+
+	/// <summary>
+	/// Adds an object to the area, or one of its subdivided areas, that contains its position.
+	/// </summary>
+	/// <param name="a_rEntry"> The object to add. </param>
+	/// <returns> The area that the object was added to, or null if it's positioned outside of this area. </returns>
+	OctTree* InsertEntry(const ObjectEntry& a_rEntry);
 
 	/// <summary>
 	/// Splits an area of the oct-tree in half across its x, y, and z axes, creating several smaller areas.
 	/// </summary>
 	void SubDivide();
+	/// <summary>
+	/// Deletes the oct-tree's subdivided areas. Any objects registered to them are unregistered, not deleted.
+	/// </summary>
+	void DeleteSubTrees();
+	/// <summary>
+	/// Removes every object from the oct-tree and its subdivided areas.
+	/// </summary>
+	/// <param name="a_rObjects"> A collection to store the removed objects in. </param>
+	void RemoveAllObjects(std::vector<ObjectEntry>& a_rObjects);
+	/// <summary>
+	/// Removes the objects that are no longer positioned within the area they're registered to.
+	/// Subdivided areas that no longer contain any objects are collapsed.
+	/// </summary>
+	/// <param name="a_rObjects"> A collection to store the removed objects in. </param>
+	/// <returns> The number of objects that remain within the area and its subdivided areas. </returns>
+	unsigned int RemoveMovedObjects(std::vector<ObjectEntry>& a_rObjects);
+	/// <summary>
+	/// Returns true if a volume of space reaches any object that's registered with this area of the oct-tree.
+	/// Objects are placed by their position alone, so the area is widened by the largest object it has been given.
+	/// </summary>
+	/// <param name="a_rVolume"> The volume of space to check against the oct-tree's area. </param>
+	/// <returns> True if the volume overlaps the oct-tree's widened area. </returns>
+	bool AreaOverlaps(const BoundingBox<TVector>& a_rVolume) const;
+	/// <summary>
+	/// Passes every object that's registered with this area and its subdivided areas to a visitor.
+	/// </summary>
+	/// <param name="a_rVisitor"> Called once for every object. </param>
+	template <typename TVisitor>
+	void VisitAllObjects(TVisitor&& a_rVisitor) const;
+	/// <summary>
+	/// Finds the objects in this area and its subdivided areas that a volume can't rule out, skipping the area whole
+	/// if it lies outside the volume.
+	/// </summary>
+	/// <param name="a_rVolume"> The volume of space to search. </param>
+	/// <param name="a_rVisitor"> Called once for every object that's found within the volume. </param>
+	template <typename TVolume, typename TVisitor>
+	void QueryAreaVolume(const TVolume& a_rVolume,
+		TVisitor&& a_rVisitor) const;
+	/// <summary>
+	/// Offers the objects in this area and its subdivided areas to a heap of the nearest objects found so far.
+	/// </summary>
+	/// <param name="a_rPosition"> The position to search around. </param>
+	/// <param name="a_uiCount"> The most objects the heap can hold. </param>
+	/// <param name="a_rNearestObjects"> A max-heap of the nearest objects found so far, ordered by distance. </param>
+	void FindNearestObjects(const TVector& a_rPosition,
+		unsigned int a_uiCount,
+		std::vector<NearestObject>& a_rNearestObjects) const;
+	/// <summary>
+	/// Returns true if the area's aggregate can stand in for its objects in a query, because every one of them is
+	/// inside the queried volume and the area is far enough away for its opening angle.
+	/// </summary>
+	/// <param name="a_rQueryVolume"> The queried volume of space. </param>
+	/// <param name="a_fOpeningAngle"> The widest that the area can be, divided by its distance. </param>
+	bool CanAggregate(const BoundingBox<TVector>& a_rQueryVolume,
+		float a_fOpeningAngle) const;
+	/// <summary>
+	/// Adds the edges of this area and its subdivided areas to a draw queue's batch of lines.
+	/// </summary>
+	/// <param name="a_pDrawQueue"> The queue that draws the oct-tree's lines. </param>
+	/// <param name="a_uiDepth"> The number of times the oct-tree was subdivided to reach this area. </param>
+	void DrawArea(DrawQueue* a_pDrawQueue,
+		unsigned int a_uiDepth) const;
+	void WriteAreaSnapshot(SceneSnapshot& a_rSnapshot,
+		unsigned int a_uiDepth) const;
+	/// <summary>
+	/// Returns the colour that an area's lines are drawn in.
+	/// </summary>
+	/// <param name="a_uiDepth"> The number of times the oct-tree was subdivided to reach the area. </param>
+	static TVector GetDepthColour(unsigned int a_uiDepth);
 
 	/// <summary>
 	/// The maximum number of objects that can exist within a single area of an oct-tree before it's subdivided.
@@ -92,12 +311,36 @@ private:
 	/// <summary>
 	/// Represents the area that an oct-tree covers.
 	/// </summary>
-	Boundary<TVector> m_boundary;
-	std::map<TObject*, const Boundary<TVector>*> m_objects;
+	BoundingBox<TVector> m_area;
+	/// <summary>
+	/// The objects that are registered with this area, stored contiguously so queries can scan through them quickly.
+	/// </summary>
+	std::vector<ObjectEntry> m_objects;
+	/// <summary>
+	/// The largest width, height, and depth of any object that has been registered with the area or its subdivided
+	/// areas.
+	/// </summary>
+	TVector m_objectDimensions;
 	/// <summary>
 	/// Additional oct-trees for creating the subdivided areas across the volume of space that a larger oct-tree covers.
 	/// </summary>
 	OctTree* m_pSubTrees[8];
+	/// <summary>
+	/// The totals over this area's objects and those of its subdivided areas, from the last time the aggregates were
+	/// updated.
+	/// </summary>
+	Aggregate m_aggregate;
+	UPDATE_MODE m_updateMode;
+	/// <summary>
+	/// The area that each object is registered with, so objects can be removed without searching every area. Only
+	/// kept by the top level of the oct-tree.
+	/// </summary>
+	std::unordered_map<TObject*, OctTree*> m_objectAreas;
+	/// <summary>
+	/// Objects that have been taken out of the oct-tree during an update and are waiting to be reinserted.
+	/// Kept between updates to avoid reallocating its memory every frame.
+	/// </summary>
+	std::vector<ObjectEntry> m_objectsToReinsert;
 };
 
 template <typename TObject, typename TVector>
@@ -105,59 +348,133 @@ OctTree<TObject, TVector>::OctTree(unsigned int a_capacity,
 	TVector a_position,
 	TVector a_dimensions) : m_uiCapacity(a_capacity),
 	m_bSubdivided(false),
-	m_boundary(Boundary<TVector>(a_position, a_dimensions)),
+	m_area(a_position, a_dimensions),
 	m_objects(),
-	m_pSubTrees() {}
+	m_objectDimensions(0.0f),
+	m_pSubTrees(),
+	m_aggregate(),
+	m_updateMode(UPDATE_MODE_REFIT),
+	m_objectAreas(),
+	m_objectsToReinsert() {}
 
 template <typename TObject, typename TVector>
 OctTree<TObject, TVector>::OctTree(unsigned int a_capacity,
-	Boundary<TVector> a_boundary) : m_uiCapacity(a_capacity),
+	const BoundingBox<TVector>& a_rArea) : m_uiCapacity(a_capacity),
 	m_bSubdivided(false),
-	m_boundary(a_boundary),
+	m_area(a_rArea),
 	m_objects(),
-	m_pSubTrees() {}
+	m_objectDimensions(0.0f),
+	m_pSubTrees(),
+	m_aggregate(),
+	m_updateMode(UPDATE_MODE_REFIT),
+	m_objectAreas(),
+	m_objectsToReinsert() {}
 
 template <typename TObject, typename TVector>
-void OctTree<TObject, TVector>::Draw() {
-	m_boundary.Draw();
+OctTree<TObject, TVector>::~OctTree() {
+	DeleteSubTrees();
+}
+
+template <typename TObject, typename TVector>
+void OctTree<TObject, TVector>::Update() {
+	m_objectsToReinsert.clear();
+
+	if (m_updateMode == UPDATE_MODE_REBUILD) {
+		RemoveAllObjects(m_objectsToReinsert);
+	} else {
+		RemoveMovedObjects(m_objectsToReinsert);
+	}
+
+	for (ObjectEntry& rObject : m_objectsToReinsert) {
+		if (rObject.pBoundary && rObject.pBoundary->GetPosition()) {
+			rObject.bounds = rObject.pBoundary->GetBoundingBox();
+		}
+
+		OctTree* pArea = InsertEntry(rObject);
+
+		if (!pArea) {
+			// The object has left the oct-tree's area, so keep it with the top level of the oct-tree. This way it
+			// can still be found and removed, and is reinserted once it moves back inside.
+			m_objects.push_back(rObject);
+			pArea = this;
+		}
+
+		m_objectAreas[rObject.pObject] = pArea;
+	}
 }
 
 template <typename TObject, typename TVector>
 bool OctTree<TObject, TVector>::InsertObject(TObject* a_pObject,
 	const Boundary<TVector>& a_rBoundary) {
-	if (!a_pObject) {
+	if (!a_pObject || !a_rBoundary.GetPosition()) {
 		return false;
 	}
 
-	// Checks if the object is positioned within the area covered by the oct-tree.
-	if (!m_boundary.Contains(*a_rBoundary.GetPosition())) {
+	ObjectEntry entry;
+	entry.pObject = a_pObject;
+	entry.pBoundary = &a_rBoundary;
+	entry.bounds = a_rBoundary.GetBoundingBox();
+	OctTree* pArea = InsertEntry(entry);
+
+	if (!pArea) {
 		return false;
 	}
 
+	m_objectAreas[a_pObject] = pArea;
+	return true;
+}
+
+template <typename TObject, typename TVector>
+OctTree<TObject, TVector>* OctTree<TObject, TVector>::InsertEntry(const ObjectEntry& a_rEntry) {
+	// Checks if the object is positioned within the area covered by the oct-tree.
+	if (!m_area.Contains(a_rEntry.bounds.GetPosition())) {
+		return nullptr;
+	}
+
+	m_objectDimensions.x = glm::max(m_objectDimensions.x, a_rEntry.bounds.GetDimensions().x);
+	m_objectDimensions.y = glm::max(m_objectDimensions.y, a_rEntry.bounds.GetDimensions().y);
+	m_objectDimensions.z = glm::max(m_objectDimensions.z, a_rEntry.bounds.GetDimensions().z);
+
 	if (m_objects.size() < m_uiCapacity) {
-		m_objects.insert(ObjectPair(a_pObject, &a_rBoundary));
-		return true;
-	} else {
-		if (!m_bSubdivided) {
-			SubDivide();
+		m_objects.push_back(a_rEntry);
+		return this;
+	}
+
+	if (!m_bSubdivided) {
+		SubDivide();
+	}
+
+	// Adds the object to the subdivided area that overlaps with its position.
+	for (unsigned int i = 0; i < SUB_TREE_POSITIONS_COUNT; ++i) {
+		OctTree* pArea = m_pSubTrees[i]->InsertEntry(a_rEntry);
+
+		if (pArea) {
+			return pArea;
 		}
+	}
 
-		// Adds the object to the subdivided area that overlaps with its position.
-		if (m_pSubTrees[SUB_TREE_POSITIONS_000]->InsertObject(a_pObject, a_rBoundary)) {
-			return true;
-		} else if (m_pSubTrees[SUB_TREE_POSITIONS_001]->InsertObject(a_pObject, a_rBoundary)) {
-			return true;
-		} else if (m_pSubTrees[SUB_TREE_POSITIONS_101]->InsertObject(a_pObject, a_rBoundary)) {
-			return true;
-		} else if (m_pSubTrees[SUB_TREE_POSITIONS_100]->InsertObject(a_pObject, a_rBoundary)) {
-			return true;
-		} else if (m_pSubTrees[SUB_TREE_POSITIONS_010]->InsertObject(a_pObject, a_rBoundary)) {
-			return true;
-		} else if (m_pSubTrees[SUB_TREE_POSITIONS_011]->InsertObject(a_pObject, a_rBoundary)) {
-			return true;
-		} else if (m_pSubTrees[SUB_TREE_POSITIONS_111]->InsertObject(a_pObject, a_rBoundary)) {
-			return true;
-		} else if (m_pSubTrees[SUB_TREE_POSITIONS_110]->InsertObject(a_pObject, a_rBoundary)) {
+	return nullptr;
+}
+
+template <typename TObject, typename TVector>
+bool OctTree<TObject, TVector>::RemoveObject(TObject* a_pObject) {
+	typename std::unordered_map<TObject*, OctTree*>::iterator area = m_objectAreas.find(a_pObject);
+
+	if (area == m_objectAreas.end()) {
+		return false;
+	}
+
+	// Only the object's own area is searched, which holds no more objects than the oct-tree's capacity unless it's
+	// the top level keeping objects that have left the oct-tree's area.
+	std::vector<ObjectEntry>& rObjects = area->second->m_objects;
+	m_objectAreas.erase(area);
+
+	for (unsigned int i = 0; i < rObjects.size(); ++i) {
+		if (rObjects[i].pObject == a_pObject) {
+			// The order of the objects doesn't matter, so fill the gap with the last object instead of shifting
+			// every object after it.
+			rObjects[i] = rObjects.back();
+			rObjects.pop_back();
 			return true;
 		}
 	}
@@ -168,114 +485,475 @@ bool OctTree<TObject, TVector>::InsertObject(TObject* a_pObject,
 template <typename TObject, typename TVector>
 void OctTree<TObject, TVector>::SubDivide() {
 	// Bottom left back.
-	glm::vec3 subTreePosition000(m_boundary.GetPosition()->x - m_boundary.GetDimensions().x / 2,
-		m_boundary.GetPosition()->y - m_boundary.GetDimensions().y / 2,
-		m_boundary.GetPosition()->z - m_boundary.GetDimensions().z / 2);
+	glm::vec3 subTreePosition000(m_area.GetPosition().x - m_area.GetDimensions().x / 2,
+		m_area.GetPosition().y - m_area.GetDimensions().y / 2,
+		m_area.GetPosition().z - m_area.GetDimensions().z / 2);
 	OctTree* subTree000 = new OctTree(m_uiCapacity,
-		Boundary<TVector>(subTreePosition000,
-			glm::vec3(m_boundary.GetDimensions() * 0.5f)));
+		BoundingBox<TVector>(subTreePosition000,
+			glm::vec3(m_area.GetDimensions() * 0.5f)));
 	m_pSubTrees[SUB_TREE_POSITIONS_000] = subTree000;
 	// Bottom left forward.
-	glm::vec3 subTreePosition001(m_boundary.GetPosition()->x - m_boundary.GetDimensions().x / 2,
-		m_boundary.GetPosition()->y - m_boundary.GetDimensions().y / 2,
-		m_boundary.GetPosition()->z + m_boundary.GetDimensions().z / 2);
+	glm::vec3 subTreePosition001(m_area.GetPosition().x - m_area.GetDimensions().x / 2,
+		m_area.GetPosition().y - m_area.GetDimensions().y / 2,
+		m_area.GetPosition().z + m_area.GetDimensions().z / 2);
 	OctTree* subTree001 = new OctTree(m_uiCapacity,
-		Boundary<TVector>(subTreePosition001,
-			glm::vec3(m_boundary.GetDimensions() * 0.5f)));
+		BoundingBox<TVector>(subTreePosition001,
+			glm::vec3(m_area.GetDimensions() * 0.5f)));
 	m_pSubTrees[SUB_TREE_POSITIONS_001] = subTree001;
 	// Bottom right forward.
-	glm::vec3 subTreePosition101(m_boundary.GetPosition()->x + m_boundary.GetDimensions().x / 2,
-		m_boundary.GetPosition()->y - m_boundary.GetDimensions().y / 2,
-		m_boundary.GetPosition()->z + m_boundary.GetDimensions().z / 2);
+	glm::vec3 subTreePosition101(m_area.GetPosition().x + m_area.GetDimensions().x / 2,
+		m_area.GetPosition().y - m_area.GetDimensions().y / 2,
+		m_area.GetPosition().z + m_area.GetDimensions().z / 2);
 	OctTree* subTree101 = new OctTree(m_uiCapacity,
-		Boundary<TVector>(subTreePosition101,
-			glm::vec3(m_boundary.GetDimensions() * 0.5f)));
+		BoundingBox<TVector>(subTreePosition101,
+			glm::vec3(m_area.GetDimensions() * 0.5f)));
 	m_pSubTrees[SUB_TREE_POSITIONS_101] = subTree101;
 	// Bottom right back.
-	glm::vec3 subTreePosition100(m_boundary.GetPosition()->x + m_boundary.GetDimensions().x / 2,
-		m_boundary.GetPosition()->y - m_boundary.GetDimensions().y / 2,
-		m_boundary.GetPosition()->z - m_boundary.GetDimensions().z / 2);
+	glm::vec3 subTreePosition100(m_area.GetPosition().x + m_area.GetDimensions().x / 2,
+		m_area.GetPosition().y - m_area.GetDimensions().y / 2,
+		m_area.GetPosition().z - m_area.GetDimensions().z / 2);
 	OctTree* subTree100 = new OctTree(m_uiCapacity,
-		Boundary<TVector>(subTreePosition100,
-			glm::vec3(m_boundary.GetDimensions() * 0.5f)));
+		BoundingBox<TVector>(subTreePosition100,
+			glm::vec3(m_area.GetDimensions() * 0.5f)));
 	m_pSubTrees[SUB_TREE_POSITIONS_100] = subTree100;
 
 	// Top left back.
-	glm::vec3 subTreePosition010(m_boundary.GetPosition()->x - m_boundary.GetDimensions().x / 2,
-		m_boundary.GetPosition()->y + m_boundary.GetDimensions().y / 2,
-		m_boundary.GetPosition()->z - m_boundary.GetDimensions().z / 2);
+	glm::vec3 subTreePosition010(m_area.GetPosition().x - m_area.GetDimensions().x / 2,
+		m_area.GetPosition().y + m_area.GetDimensions().y / 2,
+		m_area.GetPosition().z - m_area.GetDimensions().z / 2);
 	OctTree* subTree010 = new OctTree(m_uiCapacity,
-		Boundary<TVector>(subTreePosition010,
-			glm::vec3(m_boundary.GetDimensions() * 0.5f)));
+		BoundingBox<TVector>(subTreePosition010,
+			glm::vec3(m_area.GetDimensions() * 0.5f)));
 	m_pSubTrees[SUB_TREE_POSITIONS_010] = subTree010;
 	// Top left forward.
-	glm::vec3 subTreePosition011(m_boundary.GetPosition()->x - m_boundary.GetDimensions().x / 2,
-		m_boundary.GetPosition()->y + m_boundary.GetDimensions().y / 2,
-		m_boundary.GetPosition()->z + m_boundary.GetDimensions().z / 2);
+	glm::vec3 subTreePosition011(m_area.GetPosition().x - m_area.GetDimensions().x / 2,
+		m_area.GetPosition().y + m_area.GetDimensions().y / 2,
+		m_area.GetPosition().z + m_area.GetDimensions().z / 2);
 	OctTree* subTree011 = new OctTree(m_uiCapacity,
-		Boundary<TVector>(subTreePosition011,
-			glm::vec3(m_boundary.GetDimensions() * 0.5f)));
+		BoundingBox<TVector>(subTreePosition011,
+			glm::vec3(m_area.GetDimensions() * 0.5f)));
 	m_pSubTrees[SUB_TREE_POSITIONS_011] = subTree011;
 	// Top right forward.
-	glm::vec3 subTreePosition111(m_boundary.GetPosition()->x + m_boundary.GetDimensions().x / 2,
-		m_boundary.GetPosition()->y + m_boundary.GetDimensions().y / 2,
-		m_boundary.GetPosition()->z + m_boundary.GetDimensions().z / 2);
+	glm::vec3 subTreePosition111(m_area.GetPosition().x + m_area.GetDimensions().x / 2,
+		m_area.GetPosition().y + m_area.GetDimensions().y / 2,
+		m_area.GetPosition().z + m_area.GetDimensions().z / 2);
 	OctTree* subTree111 = new OctTree(m_uiCapacity,
-		Boundary<TVector>(subTreePosition111,
-			glm::vec3(m_boundary.GetDimensions() * 0.5f)));
+		BoundingBox<TVector>(subTreePosition111,
+			glm::vec3(m_area.GetDimensions() * 0.5f)));
 	m_pSubTrees[SUB_TREE_POSITIONS_111] = subTree111;
 	// Top right back.
-	glm::vec3 subTreePosition110(m_boundary.GetPosition()->x + m_boundary.GetDimensions().x / 2,
-		m_boundary.GetPosition()->y + m_boundary.GetDimensions().y / 2,
-		m_boundary.GetPosition()->z - m_boundary.GetDimensions().z / 2);
+	glm::vec3 subTreePosition110(m_area.GetPosition().x + m_area.GetDimensions().x / 2,
+		m_area.GetPosition().y + m_area.GetDimensions().y / 2,
+		m_area.GetPosition().z - m_area.GetDimensions().z / 2);
 	OctTree* subTree110 = new OctTree(m_uiCapacity,
-		Boundary<TVector>(subTreePosition110,
-			glm::vec3(m_boundary.GetDimensions() * 0.5f)));
+		BoundingBox<TVector>(subTreePosition110,
+			glm::vec3(m_area.GetDimensions() * 0.5f)));
 	m_pSubTrees[SUB_TREE_POSITIONS_110] = subTree110;
 	m_bSubdivided = true;
 }
 
 template <typename TObject, typename TVector>
-void OctTree<TObject, TVector>::Query(Boundary<TVector> a_queryVolume,
+void OctTree<TObject, TVector>::DeleteSubTrees() {
+	if (!m_bSubdivided) {
+		return;
+	}
+
+	for (unsigned int i = 0; i < SUB_TREE_POSITIONS_COUNT; ++i) {
+		delete m_pSubTrees[i];
+		m_pSubTrees[i] = nullptr;
+	}
+
+	m_bSubdivided = false;
+}
+
+template <typename TObject, typename TVector>
+void OctTree<TObject, TVector>::RemoveAllObjects(std::vector<ObjectEntry>& a_rObjects) {
+	a_rObjects.insert(a_rObjects.end(), m_objects.begin(), m_objects.end());
+	m_objects.clear();
+
+	if (m_bSubdivided) {
+		for (unsigned int i = 0; i < SUB_TREE_POSITIONS_COUNT; ++i) {
+			m_pSubTrees[i]->RemoveAllObjects(a_rObjects);
+		}
+
+		DeleteSubTrees();
+	}
+}
+
+template <typename TObject, typename TVector>
+unsigned int OctTree<TObject, TVector>::RemoveMovedObjects(std::vector<ObjectEntry>& a_rObjects) {
+	for (unsigned int i = 0; i < m_objects.size();) {
+		ObjectEntry& rObject = m_objects[i];
+
+		// Objects without a position can't be placed, so leave them where they are.
+		if (!rObject.pBoundary || !rObject.pBoundary->GetPosition()) {
+			++i;
+			continue;
+		}
+
+		// Bring the object's bounds up-to-date for the next round of queries.
+		rObject.bounds = rObject.pBoundary->GetBoundingBox();
+
+		if (m_area.Contains(rObject.bounds.GetPosition())) {
+			++i;
+			continue;
+		}
+
+		a_rObjects.push_back(rObject);
+		// Fill the gap with the last object, which is checked on the next iteration.
+		m_objects[i] = m_objects.back();
+		m_objects.pop_back();
+	}
+
+	if (!m_bSubdivided) {
+		return m_objects.size();
+	}
+
+	unsigned int subTreeObjectCount = 0;
+
+	for (unsigned int i = 0; i < SUB_TREE_POSITIONS_COUNT; ++i) {
+		subTreeObjectCount += m_pSubTrees[i]->RemoveMovedObjects(a_rObjects);
+	}
+
+	// Collapse the subdivided areas once every object has left them so the oct-tree doesn't stay divided around
+	// where the objects used to be.
+	if (subTreeObjectCount == 0) {
+		DeleteSubTrees();
+	}
+
+	return m_objects.size() + subTreeObjectCount;
+}
+
+template <typename TObject, typename TVector>
+template <typename TVisitor>
+void OctTree<TObject, TVector>::Query(const BoundingBox<TVector>& a_rQueryVolume,
+	TVisitor&& a_rVisitor) const {
+	// Ensures the queried volume of space overlaps the oct-tree's area. Checking only the query's centre would miss
+	// objects in neighbouring areas that the queried volume reaches into.
+	if (!AreaOverlaps(a_rQueryVolume)) {
+		return;
+	}
+
+	for (const ObjectEntry& rObject : m_objects) {
+		// Checks if the object is positioned inside the queried volume of space.
+		if (a_rQueryVolume.Overlaps(rObject.bounds)) {
+			a_rVisitor(rObject.pObject);
+		}
+	}
+
+	if (m_bSubdivided) {
+		// Searches through the oct-tree's subdivided areas for additional objects.
+		for (unsigned int i = 0; i < SUB_TREE_POSITIONS_COUNT; ++i) {
+			m_pSubTrees[i]->Query(a_rQueryVolume, a_rVisitor);
+		}
+	}
+}
+
+template <typename TObject, typename TVector>
+void OctTree<TObject, TVector>::Query(const BoundingBox<TVector>& a_rQueryVolume,
 	std::vector<TObject*>& a_rContainedEntities) const {
-	// Ensures the queried volume of space has a position to read from.
-	if (!a_queryVolume.GetPosition()) {
+	Query(a_rQueryVolume, [&a_rContainedEntities](TObject* a_pObject) {
+		a_rContainedEntities.push_back(a_pObject);
+	});
+}
+
+template <typename TObject, typename TVector>
+void OctTree<TObject, TVector>::Query(const BoundingBox<TVector>& a_rQueryVolume,
+	QueryCallback a_callback,
+	void* a_pUserData) const {
+	Query(a_rQueryVolume, [a_callback, a_pUserData](TObject* a_pObject) {
+		a_callback(a_pObject, a_pUserData);
+	});
+}
+
+template <typename TObject, typename TVector>
+void OctTree<TObject, TVector>::QueryNearest(const TVector& a_rPosition,
+	unsigned int a_uiCount,
+	std::vector<NearestObject>& a_rNearestObjects) const {
+	a_rNearestObjects.clear();
+
+	if (a_uiCount == 0) {
 		return;
 	}
 
-	// Ensures the queried volume of space is positioned inside the oct-tree's area.
-	if (!m_boundary.Contains(*a_queryVolume.GetPosition())) {
+	FindNearestObjects(a_rPosition, a_uiCount, a_rNearestObjects);
+	std::sort_heap(a_rNearestObjects.begin(), a_rNearestObjects.end());
+}
+
+template <typename TObject, typename TVector>
+template <typename TVolume, typename TVisitor>
+void OctTree<TObject, TVector>::QueryVolume(const TVolume& a_rVolume,
+	TVisitor&& a_rVisitor) const {
+	// The top level also keeps the objects that have left the oct-tree's area, so its area can't rule them out.
+	for (const ObjectEntry& rObject : m_objects) {
+		if (a_rVolume.Classify(rObject.bounds) != TVolume::CONTAINMENT_OUTSIDE) {
+			a_rVisitor(rObject.pObject);
+		}
+	}
+
+	if (m_bSubdivided) {
+		for (unsigned int i = 0; i < SUB_TREE_POSITIONS_COUNT; ++i) {
+			m_pSubTrees[i]->QueryAreaVolume(a_rVolume, a_rVisitor);
+		}
+	}
+}
+
+template <typename TObject, typename TVector>
+template <typename TVolume, typename TVisitor>
+void OctTree<TObject, TVector>::QueryAreaVolume(const TVolume& a_rVolume,
+	TVisitor&& a_rVisitor) const {
+	// Objects are placed by their position alone, so the area is widened by the largest object it has been given.
+	const typename TVolume::CONTAINMENT containment = a_rVolume.Classify(BoundingBox<TVector>(m_area.GetPosition(),
+		m_area.GetDimensions() + m_objectDimensions));
+
+	if (containment == TVolume::CONTAINMENT_OUTSIDE) {
 		return;
-	} else {
-		for (ObjectPair object : m_objects) {
-			// Checks if the data has been initialised.
-			if (!object.second || !object.second->GetPosition()) {
-				continue;
-			}
-
-			// Checks if the object is positioned inside the queried volume of space.
-			if (a_queryVolume.Overlaps(*object.second)) {
-				a_rContainedEntities.push_back(object.first);
-			}
+	} else if (containment == TVolume::CONTAINMENT_INSIDE) {
+		VisitAllObjects(a_rVisitor);
+		return;
+	}
+
+	for (const ObjectEntry& rObject : m_objects) {
+		if (a_rVolume.Classify(rObject.bounds) != TVolume::CONTAINMENT_OUTSIDE) {
+			a_rVisitor(rObject.pObject);
+		}
+	}
+
+	if (m_bSubdivided) {
+		for (unsigned int i = 0; i < SUB_TREE_POSITIONS_COUNT; ++i) {
+			m_pSubTrees[i]->QueryAreaVolume(a_rVolume, a_rVisitor);
+		}
+	}
+}
+
+template <typename TObject, typename TVector>
+template <typename TValueGetter>
+void OctTree<TObject, TVector>::UpdateAggregates(TValueGetter&& a_rGetValue) {
+	m_aggregate.uiCount = 0;
+	m_aggregate.positionSum = TVector(0.0f);
+	m_aggregate.valueSum = TVector(0.0f);
+
+	for (const ObjectEntry& rObject : m_objects) {
+		TVector value(0.0f);
+
+		if (a_rGetValue(rObject.pObject, value)) {
+			++m_aggregate.uiCount;
+			m_aggregate.positionSum += rObject.bounds.GetPosition();
+			m_aggregate.valueSum += value;
+		}
+	}
+
+	if (!m_bSubdivided) {
+		return;
+	}
+
+	for (unsigned int i = 0; i < SUB_TREE_POSITIONS_COUNT; ++i) {
+		m_pSubTrees[i]->UpdateAggregates(a_rGetValue);
+		const Aggregate& rSubTreeAggregate = m_pSubTrees[i]->m_aggregate;
+		m_aggregate.uiCount += rSubTreeAggregate.uiCount;
+		m_aggregate.positionSum += rSubTreeAggregate.positionSum;
+		m_aggregate.valueSum += rSubTreeAggregate.valueSum;
+	}
+}
+
+template <typename TObject, typename TVector>
+template <typename TVisitor, typename TAggregateVisitor>
+void OctTree<TObject, TVector>::QueryAggregates(const BoundingBox<TVector>& a_rQueryVolume,
+	float a_fOpeningAngle,
+	TVisitor&& a_rVisitor,
+	TAggregateVisitor&& a_rAggregateVisitor) const {
+	if (!AreaOverlaps(a_rQueryVolume)) {
+		return;
+	}
+
+	// Only subdivided areas are ever aggregated, as the top level also keeps the objects that have left the
+	// oct-tree's area, which the queried volume might not reach.
+	for (const ObjectEntry& rObject : m_objects) {
+		if (a_rQueryVolume.Overlaps(rObject.bounds)) {
+			a_rVisitor(rObject.pObject);
+		}
+	}
+
+	if (!m_bSubdivided) {
+		return;
+	}
+
+	for (unsigned int i = 0; i < SUB_TREE_POSITIONS_COUNT; ++i) {
+		const OctTree* pSubTree = m_pSubTrees[i];
+
+		if (pSubTree->CanAggregate(a_rQueryVolume, a_fOpeningAngle)) {
+			a_rAggregateVisitor(pSubTree->m_aggregate);
+		} else {
+			pSubTree->QueryAggregates(a_rQueryVolume, a_fOpeningAngle, a_rVisitor, a_rAggregateVisitor);
+		}
+	}
+}
+
+template <typename TObject, typename TVector>
+void OctTree<TObject, TVector>::Draw(DrawQueue* a_pDrawQueue) const {
+	if (!a_pDrawQueue) {
+		return;
+	}
+
+	DrawArea(a_pDrawQueue, 0);
+}
+
+template <typename TObject, typename TVector>
+void OctTree<TObject, TVector>::WriteSnapshot(SceneSnapshot& a_rSnapshot) const {
+	WriteAreaSnapshot(a_rSnapshot, 0);
+}
+
+template <typename TObject, typename TVector>
+void OctTree<TObject, TVector>::DrawArea(DrawQueue* a_pDrawQueue,
+	unsigned int a_uiDepth) const {
+	const TVector colour = GetDepthColour(a_uiDepth);
+	a_pDrawQueue->AddLineBox(&m_area.GetPosition().x, &m_area.GetDimensions().x, &colour.x);
+
+	if (m_bSubdivided) {
+		for (unsigned int i = 0; i < SUB_TREE_POSITIONS_COUNT; ++i) {
+			m_pSubTrees[i]->DrawArea(a_pDrawQueue, a_uiDepth + 1);
+		}
+	}
+}
+
+template <typename TObject, typename TVector>
+void OctTree<TObject, TVector>::WriteAreaSnapshot(SceneSnapshot& a_rSnapshot,
+	unsigned int a_uiDepth) const {
+	a_rSnapshot.AddLineBox(m_area, GetDepthColour(a_uiDepth));
+
+	if (m_bSubdivided) {
+		for (unsigned int i = 0; i < SUB_TREE_POSITIONS_COUNT; ++i) {
+			m_pSubTrees[i]->WriteAreaSnapshot(a_rSnapshot, a_uiDepth + 1);
+		}
+	}
+}
+
+template <typename TObject, typename TVector>
+TVector OctTree<TObject, TVector>::GetDepthColour(unsigned int a_uiDepth) {
+	// Deeper areas are drawn in the next colour along, starting again after the last one.
+	const unsigned int depthColourCount = 6;
+	const TVector depthColours[depthColourCount] = {
+		TVector(1.0f, 1.0f, 1.0f),
+		TVector(1.0f, 0.0f, 0.0f),
+		TVector(1.0f, 1.0f, 0.0f),
+		TVector(0.0f, 1.0f, 0.0f),
+		TVector(0.0f, 1.0f, 1.0f),
+		TVector(0.0f, 0.0f, 1.0f)
+	};
+	return depthColours[a_uiDepth % depthColourCount];
+}
+
+template <typename TObject, typename TVector>
+bool OctTree<TObject, TVector>::AreaOverlaps(const BoundingBox<TVector>& a_rVolume) const {
+	return a_rVolume.Overlaps(BoundingBox<TVector>(m_area.GetPosition(), m_area.GetDimensions() + m_objectDimensions));
+}
+
+template <typename TObject, typename TVector>
+bool OctTree<TObject, TVector>::CanAggregate(const BoundingBox<TVector>& a_rQueryVolume,
+	float a_fOpeningAngle) const {
+	// Areas that gained objects since the aggregates were last updated have nothing to stand in for them yet.
+	if (m_aggregate.uiCount == 0) {
+		return false;
+	}
+
+	// Each object is positioned within its area, so an area inside the volume only holds objects that the volume
+	// would have found. The area around the volume's centre is searched in full, so whoever is querying is never
+	// counted in an aggregate.
+	if (!a_rQueryVolume.Contains(m_area.GetPosition() - m_area.GetDimensions()) ||
+		!a_rQueryVolume.Contains(m_area.GetPosition() + m_area.GetDimensions()) ||
+		m_area.Contains(a_rQueryVolume.GetPosition())) {
+		return false;
+	}
+
+	const TVector averagePosition = m_aggregate.positionSum / static_cast<float>(m_aggregate.uiCount);
+	const TVector offset = averagePosition - a_rQueryVolume.GetPosition();
+	const float width = 2.0f * glm::max(m_area.GetDimensions().x, glm::max(m_area.GetDimensions().y,
+		m_area.GetDimensions().z));
+	// Compares squared lengths to avoid a square root.
+	return width * width < a_fOpeningAngle * a_fOpeningAngle * glm::dot(offset, offset);
+}
+
+template <typename TObject, typename TVector>
+template <typename TVisitor>
+void OctTree<TObject, TVector>::VisitAllObjects(TVisitor&& a_rVisitor) const {
+	for (const ObjectEntry& rObject : m_objects) {
+		a_rVisitor(rObject.pObject);
+	}
+
+	if (m_bSubdivided) {
+		for (unsigned int i = 0; i < SUB_TREE_POSITIONS_COUNT; ++i) {
+			m_pSubTrees[i]->VisitAllObjects(a_rVisitor);
 		}
+	}
+}
+
+template <typename TObject, typename TVector>
+void OctTree<TObject, TVector>::FindNearestObjects(const TVector& a_rPosition,
+	unsigned int a_uiCount,
+	std::vector<NearestObject>& a_rNearestObjects) const {
+	// Objects outside of the oct-tree's area are kept by the root, so every area's own objects are always checked.
+	for (const ObjectEntry& rObject : m_objects) {
+		const TVector offset = rObject.bounds.GetPosition() - a_rPosition;
+		const NearestObject nearestObject = { glm::dot(offset, offset), rObject.pObject };
+		this->AddNearestObject(a_rNearestObjects, a_uiCount, nearestObject);
+	}
+
+	if (!m_bSubdivided) {
+		return;
+	}
 
-		if (m_bSubdivided) {
-			// Searches through the oct-tree's subdivided areas for additional objects.
-			m_pSubTrees[SUB_TREE_POSITIONS_000]->Query(a_queryVolume, a_rContainedEntities);
-			m_pSubTrees[SUB_TREE_POSITIONS_001]->Query(a_queryVolume, a_rContainedEntities);
-			m_pSubTrees[SUB_TREE_POSITIONS_101]->Query(a_queryVolume, a_rContainedEntities);
-			m_pSubTrees[SUB_TREE_POSITIONS_100]->Query(a_queryVolume, a_rContainedEntities);
-			m_pSubTrees[SUB_TREE_POSITIONS_010]->Query(a_queryVolume, a_rContainedEntities);
-			m_pSubTrees[SUB_TREE_POSITIONS_011]->Query(a_queryVolume, a_rContainedEntities);
-			m_pSubTrees[SUB_TREE_POSITIONS_111]->Query(a_queryVolume, a_rContainedEntities);
-			m_pSubTrees[SUB_TREE_POSITIONS_110]->Query(a_queryVolume, a_rContainedEntities);
+	// Searching the nearest subdivided areas first fills the heap with close objects, so more of the further areas
+	// can be skipped.
+	float areaDistances[SUB_TREE_POSITIONS_COUNT];
+	unsigned int areaOrder[SUB_TREE_POSITIONS_COUNT];
+
+	for (unsigned int i = 0; i < SUB_TREE_POSITIONS_COUNT; ++i) {
+		areaDistances[i] = this->GetSquaredDistance(m_pSubTrees[i]->m_area, a_rPosition);
+		unsigned int j = i;
+
+		for (; j > 0 && areaDistances[areaOrder[j - 1]] > areaDistances[i]; --j) {
+			areaOrder[j] = areaOrder[j - 1];
 		}
+
+		areaOrder[j] = i;
 	}
+
+	for (unsigned int i = 0; i < SUB_TREE_POSITIONS_COUNT; ++i) {
+		// The remaining areas are even further away, so none of them can hold a nearer object either.
+		if (!this->CanBeNearer(a_rNearestObjects, a_uiCount, areaDistances[areaOrder[i]])) {
+			break;
+		}
+
+		m_pSubTrees[areaOrder[i]]->FindNearestObjects(a_rPosition, a_uiCount, a_rNearestObjects);
+	}
+}
+
+template <typename TObject, typename TVector>
+void OctTree<TObject, TVector>::SetUpdateMode(UPDATE_MODE a_updateMode) {
+	m_updateMode = a_updateMode;
+}
+
+template <typename TObject, typename TVector>
+const BoundingBox<TVector>& OctTree<TObject, TVector>::GetArea() const {
+	return m_area;
 }
 
-template<typename TObject, typename TVector>
-const Boundary<TVector>& OctTree<TObject, TVector>::GetBoundary() const {
-	return m_boundary;
+template <typename TObject, typename TVector>
+typename OctTree<TObject, TVector>::UPDATE_MODE OctTree<TObject, TVector>::GetUpdateMode() const {
+	return m_updateMode;
+}
+
+template <typename TObject, typename TVector>
+unsigned int OctTree<TObject, TVector>::GetObjectCount() const {
+	unsigned int objectCount = m_objects.size();
+
+	if (m_bSubdivided) {
+		for (unsigned int i = 0; i < SUB_TREE_POSITIONS_COUNT; ++i) {
+			objectCount += m_pSubTrees[i]->GetObjectCount();
+		}
+	}
+
+	return objectCount;
 }
 
 #endif // !OCT_TREE_H
@@ -8,12 +8,26 @@
 
 // Header includes.
 #include "Entity.h"
+#include "Archetype.h"
+#include "BoundingBox.h"
+#include "FixedTimestep.h"
+#include "FrameTimeHistogram.h"
+#include "Frustum.h"
 #include "glm/glm.hpp"
-#include <map>
+#include "NeighbourList.h"
+#include "ObjectPool.h"
 #include "OctTree.h"
+#include "SpatialIndex.h"
+#include "StaggeredSchedule.h"
+#include "ContactCache.h"
+#include "SweepAndPrune.h"
 #include <string>
+#include <utility>
+#include <vector>
 
 // Forward declarations.
+class FlockSystem;
+class SceneSnapshot;
 class Shader;
 class Framework;
 
@@ -22,27 +36,131 @@ class Framework;
 /// </summary>
 class Scene {
 public:
-	Scene();
+	/// <summary>
+	/// The kinds of spatial index that the scene can use to keep track of its entities.
+	/// </summary>
+	enum SPATIAL_INDEX_TYPE {
+		/// <summary>
+		/// Subdivides the scene wherever entities are crowded together.
+		/// </summary>
+		SPATIAL_INDEX_TYPE_OCT_TREE,
+		/// <summary>
+		/// Divides the scene into a uniform grid of cells that are as large as a boid's neighbourhood.
+		/// </summary>
+		SPATIAL_INDEX_TYPE_HASH_GRID,
+		/// <summary>
+		/// An oct-tree that's rebuilt every frame from entities sorted along a Morton curve, and stored contiguously.
+		/// </summary>
+		SPATIAL_INDEX_TYPE_LINEAR_OCT_TREE,
+		SPATIAL_INDEX_TYPE_COUNT
+	};
+	/// <summary>
+	/// The stages that each of the scene's steps is split into, in the order that they run. Each stage runs over every
+	/// entity that it concerns before the next stage starts.
+	/// </summary>
+	enum UPDATE_STAGE {
+		/// <summary>
+		/// Brings the spatial index, and the flock system's grid, up-to-date with where the entities moved to. The
+		/// neighbour lists are checked for being out-of-date here too, if the scene is using them.
+		/// </summary>
+		UPDATE_STAGE_SPATIAL_INDEX,
+		/// <summary>
+		/// Updates the broadphase on steps that reevaluate, which finds every contact between colliders for the contact
+		/// cache, tells every collider whose contacts have begun or ended, and gathers the obstacles that boids avoid.
+		/// </summary>
+		UPDATE_STAGE_COLLISION_DETECTION,
+		/// <summary>
+		/// Chooses a new steering velocity for each boid that's due to reevaluate. The flock system checks its boids'
+		/// collisions here too, as it does so while it finds their neighbours.
+		/// </summary>
+		UPDATE_STAGE_STEERING,
+		/// <summary>
+		/// On steps that reevaluate, steers each entity that's in contact with others away from them. Then moves every
+		/// entity along its velocity.
+		/// </summary>
+		UPDATE_STAGE_INTEGRATION,
+		/// <summary>
+		/// Rebuilds the matrices that the entities' models are drawn with from where the entities moved to.
+		/// </summary>
+		UPDATE_STAGE_RENDER_MATRICES,
+		UPDATE_STAGE_COUNT
+	};
+
+	/// <summary>
+	/// Creates a new scene.
+	/// </summary>
+	/// <param name="a_spatialIndexType"> The kind of spatial index used to keep track of the scene's entities. </param>
+	/// <param name="a_bUseFlockSystem"> True if boids should be moved together by a flock system, rather than each
+	/// one by its own brain component. </param>
+	/// <param name="a_fExtent"> The scene's width, height, and depth as measured outward from its centre. </param>
+	Scene(SPATIAL_INDEX_TYPE a_spatialIndexType = SPATIAL_INDEX_TYPE_OCT_TREE,
+		bool a_bUseFlockSystem = true,
+		float a_fExtent = 10.0f);
 	~Scene();
 
 	/// <summary>
-	/// Updates all of the scene's entities.
+	/// Steps the scene forward by as many fixed steps as fit into the time that has passed, carrying any time that's
+	/// left over to the next frame. Only the steps that a reevaluation bucket is due on reevaluate, so the others
+	/// skip the broadphase as well as steering.
 	/// Always call once per frame.
 	/// </summary>
-	/// <param name="a_deltaTime"> The amount of time (in seconds) that has passed since the last frame and current frame. </param>
-	void Update(float a_deltaTime);
+	/// <param name="a_fFrameTime"> The amount of time (in seconds) that has passed since the last frame and current
+	/// frame. </param>
+	void Update(float a_fFrameTime);
+	/// <summary>
+	/// Updates all of the scene's entities by a single step, regardless of the scene's clock.
+	/// </summary>
+	/// <param name="a_fStepDuration"> The amount of time (in seconds) to move the entities for. </param>
+	/// <param name="a_bReevaluate"> True if the entities that are due to recalculate their expensive decisions, such
+	/// as which way to steer and what they're colliding with, should do so before moving. </param>
+	void Step(float a_fStepDuration,
+		bool a_bReevaluate);
 	/// <summary>
 	/// Draws all of the scene's elements on-screen.
+	/// While frustum culling is on, entities outside of the camera's view aren't drawn.
 	/// </summary>
 	/// <param name="a_pRenderingFramework"> The program that handles drawing the scene's elements. </param>
-	void Draw(Framework* a_pRenderingFramework);
+	/// <param name="a_rViewFrustum"> The volume of space that the camera can see. </param>
+	void Draw(Framework* a_pRenderingFramework,
+		const Frustum& a_rViewFrustum = Frustum());
+	/// <summary>
+	/// Replaces the contents of a snapshot with everything that Draw would draw, so the scene can be drawn on another
+	/// thread while it's updated. Culling is left to whoever draws the snapshot.
+	/// </summary>
+	/// <param name="a_rSnapshot"> The snapshot to fill. </param>
+	void WriteSnapshot(SceneSnapshot& a_rSnapshot) const;
+	/// <summary>
+	/// Creates an entity in the scene's pool of entities, ready to have components attached before it's added to the
+	/// scene. The scene owns the entity, and frees it when it's destroyed.
+	/// </summary>
+	/// <returns> A pointer to the new entity. </returns>
+	Entity* CreateEntity();
+	/// <summary>
+	/// Creates an entity in the scene's pool of entities with a copy of each of another entity's components.
+	/// </summary>
+	/// <param name="a_rEntityToCopy"> The entity to copy. </param>
+	/// <returns> A pointer to the new entity, which hasn't been added to the scene yet. </returns>
+	Entity* CloneEntity(Entity& a_rEntityToCopy);
 	/// <summary>
-	/// Registers a single entity with the scene.
+	/// Creates a component in the scene's pool of components of the same type. The component still needs attaching
+	/// to its entity, and is freed along with the entity.
+	/// </summary>
+	/// <typeparam name="TComponent"> The type of component to create. </typeparam>
+	/// <param name="a_rArguments"> Passed to the component's constructor. </param>
+	/// <returns> A pointer to the new component. </returns>
+	template <typename TComponent, typename... TArguments>
+	TComponent* CreateComponent(TArguments&&... a_rArguments);
+	/// <summary>
+	/// Registers a single entity with the scene. Only entities that were created by the scene can be added.
 	/// </summary>
 	/// <param name="a_pNewEntity"> The entity instance to associate with the scene. </param>
 	/// <returns> True if the entity was successfully added to the scene. </returns>
 	bool AddEntity(Entity* a_pNewEntity);
 	void AddEntities(Entity* a_pNewEntity, unsigned int a_spawnAmount);
+	/// <summary>
+	/// Removes an entity from the scene and frees it and its components, so any handles to it become stale.
+	/// </summary>
+	/// <param name="a_pEntityToDestroy"> The entity to destroy. </param>
 	void DestroyEntity(Entity* a_pEntityToDestroy);
 	/// <summary>
 	/// Destroys a number of entities within the scene that have a specific tag.
@@ -50,18 +168,85 @@ public:
 	/// <param name="a_entityTag"> Entities with this tag will be destroyed. </param>
 	/// <param name="a_destroyAmount"> The number of entities to destroy. </param>
 	void DestroyEntitiesWithTag(std::string a_entityTag, unsigned int a_destroyAmount);
+	/// <summary>
+	/// Rebuilds the neighbour lists if the scene is using them and they're out-of-date. Each step that reevaluates
+	/// calls this once the spatial index is up-to-date.
+	/// </summary>
+	void UpdateNeighbourList();
+	/// <summary>
+	/// Tells the neighbour lists where an entity has moved to if the scene is using them, so they can tell whether
+	/// they need rebuilding without looking through every entity. Brains call this as they move their boids.
+	/// </summary>
+	/// <param name="a_pEntity"> The entity that has moved. </param>
+	/// <param name="a_rPosition"> Where the entity has moved to. </param>
+	inline void NotifyEntityMoved(const Entity* a_pEntity,
+		const glm::vec3& a_rPosition);
+	/// <summary>
+	/// Sums up the boids in each area of the oct-tree if the scene is using cell aggregates. Each step that
+	/// reevaluates calls this once the spatial index is up-to-date.
+	/// </summary>
+	void UpdateCellAggregates();
+
+	/// <summary>
+	/// Sets how the scene's oct-tree keeps track of its entities as they move. Does nothing if the scene isn't using
+	/// an oct-tree.
+	/// </summary>
+	/// <param name="a_updateMode"> The oct-tree's new update mode. </param>
+	inline void SetOctTreeUpdateMode(OctTree<Entity, glm::vec3>::UPDATE_MODE a_updateMode);
+	inline void SetFrustumCullingState(bool a_bFrustumCulling);
+	/// <summary>
+	/// Sets whether boids that are moved by their brain components find their neighbours from lists that are only
+	/// rebuilt once the boids have moved far enough, rather than querying the spatial index each time.
+	/// </summary>
+	/// <param name="a_bUseNeighbourLists"> True if the neighbour lists should be used. </param>
+	inline void SetNeighbourListState(bool a_bUseNeighbourLists);
+	/// <summary>
+	/// Sets whether boids that are moved by their brain components perceive distant boids through the totals kept by
+	/// each area of the oct-tree, rather than one by one. Only oct-trees keep these totals.
+	/// </summary>
+	/// <param name="a_bUseCellAggregates"> True if the cell aggregates should be used. </param>
+	inline void SetCellAggregateState(bool a_bUseCellAggregates);
+	/// <summary>
+	/// Sets the widest that an area of the oct-tree can be, divided by its distance from a boid, for the boid to
+	/// perceive its boids through their totals.
+	/// </summary>
+	/// <param name="a_fOpeningAngle"> The new opening angle. Zero perceives every boid one by one. </param>
+	inline void SetOpeningAngle(float a_fOpeningAngle);
+	/// <summary>
+	/// Sets how many fixed steps the scene takes for every second that passes.
+	/// </summary>
+	/// <param name="a_fTickRate"> The number of steps per second. </param>
+	inline void SetTickRate(float a_fTickRate);
+	/// <summary>
+	/// Sets the most fixed steps that the scene takes in one frame, before it drops time to catch up.
+	/// </summary>
+	/// <param name="a_uiMaximumStepCount"> The most steps per frame. </param>
+	inline void SetMaximumStepCount(unsigned int a_uiMaximumStepCount);
+	/// <summary>
+	/// Sets how many groups the entities are split into for recalculating their expensive decisions. Each group
+	/// recalculates on a different step, so the work is spread evenly rather than all happening on one step.
+	/// </summary>
+	/// <param name="a_uiBucketCount"> The number of groups. One makes every entity recalculate on the same step.
+	/// </param>
+	inline void SetReevaluationBucketCount(unsigned int a_uiBucketCount);
 
 	/// <summary>
-	/// Finds an entity by searching for its ID.
+	/// Finds an entity by its handle.
 	/// </summary>
-	/// <param name="a_uniqueID"> The ID that belongs to the entity to search for. </param>
-	/// <returns> A pointer to the entity that was searched for, if it exists. </returns>
-	inline Entity* GetEntity(unsigned int a_uniqueID);
+	/// <param name="a_handle"> The handle that the scene gave the entity when it was created. </param>
+	/// <returns> A pointer to the entity, or null if it has been destroyed. </returns>
+	inline Entity* GetEntity(PoolHandle a_handle) const;
 	/// <summary>
 	/// Returns a reference to a collection containing all of the scene's entities.
 	/// </summary>
-	/// <returns> A collection containing a pointer to each entity within the scene. </returns>
-	inline const std::map<unsigned int, Entity*>& GetAllEntities() const;
+	/// <returns> A pointer to each entity within the scene, indexed by the slot in the scene's pool that the entity
+	/// is stored in. Slots without an entity in the scene are null. </returns>
+	inline const std::vector<Entity*>& GetAllEntities() const;
+	/// <summary>
+	/// Returns the groups that the scene's entities are stored in, one for each set of components that an entity in
+	/// the scene has.
+	/// </summary>
+	inline const std::vector<Archetype>& GetArchetypes() const;
 	/// <summary>
 	/// Returns the total number of entities in the scene.
 	/// </summary>
@@ -73,32 +258,294 @@ public:
 	/// <param name="a_tag"> The function only counts entities with this tag. </param>
 	/// <returns> The number of matching entities within the scene. </returns>
 	inline const unsigned int GetEntityCount(std::string a_tag) const;
-	inline const OctTree<Entity, glm::vec3>& GetOctTree() const;
+	inline const SpatialIndex<Entity, glm::vec3>& GetSpatialIndex() const;
+	inline SPATIAL_INDEX_TYPE GetSpatialIndexType() const;
+	/// <summary>
+	/// Returns the flock system that moves the scene's boids, or null if each boid is moved by its brain component.
+	/// </summary>
+	inline const FlockSystem* GetFlockSystem() const;
+	/// <summary>
+	/// Returns the broadphase that finds which of the colliders in the spatial index are colliding.
+	/// </summary>
+	inline const SweepAndPrune& GetBroadphase() const;
+	/// <summary>
+	/// Returns every contact between the colliders in the spatial index, and how each one changed when the
+	/// broadphase was last updated.
+	/// </summary>
+	inline const ContactCache& GetContacts() const;
+	/// <summary>
+	/// Returns how the scene's oct-tree keeps track of its entities, or the default update mode if the scene isn't
+	/// using an oct-tree.
+	/// </summary>
+	inline OctTree<Entity, glm::vec3>::UPDATE_MODE GetOctTreeUpdateMode() const;
+	inline bool GetFrustumCullingState() const;
+	inline bool GetNeighbourListState() const;
+	/// <summary>
+	/// Returns the lists of entities around each boid, which are only kept up-to-date while the scene is using them.
+	/// </summary>
+	inline const NeighbourList& GetNeighbourList() const;
+	inline bool GetCellAggregateState() const;
+	inline float GetOpeningAngle() const;
+	/// <summary>
+	/// Returns the scene's oct-tree, or null if the scene is using a different kind of spatial index.
+	/// </summary>
+	inline const OctTree<Entity, glm::vec3>* GetOctTree() const;
+	/// <summary>
+	/// Returns the clock that splits frames into the scene's fixed steps. Its alpha value tells renderers how far the
+	/// scene is between its last step and its next one.
+	/// </summary>
+	inline const FixedTimestep& GetClock() const;
+	/// <summary>
+	/// Returns the number of fixed steps between each time that the entities recalculate their expensive decisions.
+	/// </summary>
+	unsigned int GetReevaluationInterval() const;
+	/// <summary>
+	/// Returns the number of groups that the entities are split into for recalculating their expensive decisions,
+	/// which is never more than the reevaluation interval.
+	/// </summary>
+	inline unsigned int GetReevaluationBucketCount() const;
+	/// <summary>
+	/// Returns how long (in milliseconds) each of the scene's steps took.
+	/// </summary>
+	inline const FrameTimeHistogram& GetStepTimes() const;
+	/// <summary>
+	/// Returns how long (in milliseconds) one stage of each of the scene's steps took.
+	/// </summary>
+	inline const FrameTimeHistogram& GetStageTimes(UPDATE_STAGE a_stage) const;
+	/// <summary>
+	/// Forgets how long the scene's previous steps, and each of their stages, took.
+	/// </summary>
+	inline void ClearStepTimes();
+	/// <summary>
+	/// Returns the number of entities that were drawn last frame.
+	/// </summary>
+	inline unsigned int GetDrawnEntityCount() const;
+	/// <summary>
+	/// Returns the number of entities that weren't drawn last frame because they were outside of the camera's view.
+	/// </summary>
+	inline unsigned int GetCulledEntityCount() const;
+	static const char* GetUpdateStageName(UPDATE_STAGE a_stage);
 
 private:
+	/// <summary>
+	/// Where an entity is stored amongst the scene's archetypes, and the ID of its boid in the flock system, so it can
+	/// be removed from both without searching.
+	/// </summary>
+	struct EntityLocation {
+		unsigned int uiArchetype;
+		unsigned int uiRow;
+		/// <summary>
+		/// FlockSystem::msc_uiNoBoid if the entity isn't moved by the flock system.
+		/// </summary>
+		unsigned int uiBoidID;
+	};
+
+	/// <summary>
+	/// Finds the archetype that stores entities with a set of components, creating it if there isn't one yet.
+	/// </summary>
+	/// <param name="a_signature"> The set of component types. </param>
+	/// <returns> The archetype's index. </returns>
+	unsigned int FindArchetype(ComponentSignature a_signature);
+	/// <summary>
+	/// Returns true if an entity was added to the spatial index, rather than the flock system or neither.
+	/// </summary>
+	bool IsInSpatialIndex(Entity* a_pEntity) const;
+	/// <summary>
+	/// Runs one stage of a step over every entity that it concerns.
+	/// </summary>
+	/// <param name="a_stage"> The stage to run. </param>
+	/// <param name="a_fStepDuration"> The amount of time (in seconds) to move the entities for. </param>
+	/// <param name="a_bReevaluate"> True if the entities that are due to recalculate their expensive decisions should
+	/// do so. </param>
+	void RunStage(UPDATE_STAGE a_stage,
+		float a_fStepDuration,
+		bool a_bReevaluate);
+	/// <summary>
+	/// Copies each boid's position and direction from the flock system into its entity, so it's drawn in the right
+	/// place.
+	/// </summary>
+	/// <param name="a_fDeltaTime"> The amount of time (in seconds) that has passed since the last frame and current
+	/// frame. </param>
+	void SyncFlockEntities(float a_fDeltaTime);
+	/// <summary>
+	/// Tells the colliders of every contact that began or ended during the contact cache's last update.
+	/// </summary>
+	void NotifyContactColliders();
+	/// <summary>
+	/// Passes each contact that's still touching to the brains of the entities in it that are due to reevaluate, which
+	/// steer away from each other.
+	/// </summary>
+	void SeparateContacts();
+	/// <summary>
+	/// Returns an entity's components and then the entity itself to their pools.
+	/// </summary>
+	/// <param name="a_pEntity"> The entity to free, which mustn't be in the scene. </param>
+	void ReleaseEntity(Entity* a_pEntity);
+
 	/// <summary>
 	/// The number of entities that exist within the scene.
 	/// </summary>
 	unsigned int m_uiEntityCount;
 	/// <summary>
-	/// A collection of all the scene's entities.
+	/// Stores every entity that the scene has created, whether or not it has been added to the scene yet.
+	/// </summary>
+	ObjectPool<Entity> m_entityPool;
+	/// <summary>
+	/// Stores every component that the scene has created, with a pool for each type of component. Each pool is
+	/// created when the first component of its type is.
 	/// </summary>
-	std::map<unsigned int, Entity*> m_sceneEntities;
+	ObjectPoolBase* m_componentPools[COMPONENT_TYPE_COUNT];
 	/// <summary>
-	/// The oct-tree helps the scene to track the positions of its entities and update them
-	/// (regarding collisions, queries, etc.) in a performant manner.
+	/// A collection of all the scene's entities, indexed by the slot in the entity pool that each one is stored in.
 	/// </summary>
-	OctTree<Entity, glm::vec3> m_octTree;
+	std::vector<Entity*> m_sceneEntities;
+	/// <summary>
+	/// The scene's entities grouped by their sets of components, which the scene updates its entities through.
+	/// </summary>
+	std::vector<Archetype> m_archetypes;
+	/// <summary>
+	/// Where each of the scene's entities is stored amongst the archetypes, indexed the same way as the entities.
+	/// </summary>
+	std::vector<EntityLocation> m_entityLocations;
+	/// <summary>
+	/// Helps the scene to track the positions of its entities and update them (regarding collisions, queries, etc.)
+	/// in a performant manner.
+	/// </summary>
+	SpatialIndex<Entity, glm::vec3>* m_pSpatialIndex;
+	SPATIAL_INDEX_TYPE m_spatialIndexType;
+	/// <summary>
+	/// Draws the volume of space that the scene's spatial index covers.
+	/// </summary>
+	Boundary<glm::vec3> m_boundary;
+	/// <summary>
+	/// Moves every boid in the scene, in place of their brain components. Null if the boids' brain components move
+	/// them instead.
+	/// </summary>
+	FlockSystem* m_pFlockSystem;
+	/// <summary>
+	/// The bounds of each entity that boids can collide with, besides other boids. Kept between updates so its
+	/// memory can be reused.
+	/// </summary>
+	std::vector<BoundingBox<glm::vec3>> m_obstacleBounds;
+	/// <summary>
+	/// Finds the collisions between every collider in the spatial index at once, in place of each collider
+	/// searching for its own.
+	/// </summary>
+	SweepAndPrune m_broadphase;
+	/// <summary>
+	/// Every contact that the broadphase has found, stored once per pair of entities.
+	/// </summary>
+	ContactCache m_contacts;
+	/// <summary>
+	/// The entities around each boid that's moved by its brain component, found from the spatial index with some
+	/// room to spare.
+	/// </summary>
+	NeighbourList m_neighbourList;
+	bool m_bUseNeighbourLists;
+	bool m_bUseCellAggregates;
+	float m_fOpeningAngle;
+	/// <summary>
+	/// True if entities outside of the camera's view are skipped when the scene is drawn.
+	/// </summary>
+	bool m_bFrustumCulling;
+	unsigned int m_uiDrawnEntityCount;
+	unsigned int m_uiCulledEntityCount;
+	/// <summary>
+	/// Splits the time between frames into fixed steps.
+	/// </summary>
+	FixedTimestep m_clock;
+	/// <summary>
+	/// The time (in seconds) between each time that the entities recalculate their expensive decisions.
+	/// </summary>
+	const float mc_fReevaluationPeriod;
+	/// <summary>
+	/// Decides which entities recalculate their expensive decisions on each step, by their IDs.
+	/// </summary>
+	StaggeredSchedule m_reevaluationSchedule;
+	/// <summary>
+	/// The number of steps that the scene has taken, whether or not they were taken by its clock.
+	/// </summary>
+	unsigned int m_uiStepCount;
+	FrameTimeHistogram m_stepTimes;
+	/// <summary>
+	/// How long each stage of the scene's steps took, indexed by stage.
+	/// </summary>
+	FrameTimeHistogram m_stageTimes[UPDATE_STAGE_COUNT];
 };
 
-Entity* Scene::GetEntity(unsigned int a_uniqueID) {
-	return m_sceneEntities.empty() ? nullptr : m_sceneEntities[a_uniqueID];
+void Scene::NotifyEntityMoved(const Entity* a_pEntity,
+	const glm::vec3& a_rPosition) {
+	if (m_bUseNeighbourLists) {
+		m_neighbourList.CheckMovement(a_pEntity->GetHandle().uiIndex, a_rPosition);
+	}
+}
+
+void Scene::SetOctTreeUpdateMode(OctTree<Entity, glm::vec3>::UPDATE_MODE a_updateMode) {
+	if (m_spatialIndexType == SPATIAL_INDEX_TYPE_OCT_TREE) {
+		static_cast<OctTree<Entity, glm::vec3>*>(m_pSpatialIndex)->SetUpdateMode(a_updateMode);
+	}
+}
+
+void Scene::SetFrustumCullingState(bool a_bFrustumCulling) {
+	m_bFrustumCulling = a_bFrustumCulling;
+}
+
+void Scene::SetNeighbourListState(bool a_bUseNeighbourLists) {
+	// The boids have moved without the lists being checked, so they're rebuilt before they're next used.
+	if (a_bUseNeighbourLists && !m_bUseNeighbourLists) {
+		m_neighbourList.Invalidate();
+	}
+
+	m_bUseNeighbourLists = a_bUseNeighbourLists;
+}
+
+void Scene::SetCellAggregateState(bool a_bUseCellAggregates) {
+	m_bUseCellAggregates = a_bUseCellAggregates;
+}
+
+void Scene::SetOpeningAngle(float a_fOpeningAngle) {
+	m_fOpeningAngle = a_fOpeningAngle > 0.0f ? a_fOpeningAngle : 0.0f;
+}
+
+void Scene::SetTickRate(float a_fTickRate) {
+	m_clock.SetTickRate(a_fTickRate);
+}
+
+void Scene::SetMaximumStepCount(unsigned int a_uiMaximumStepCount) {
+	m_clock.SetMaximumStepCount(a_uiMaximumStepCount);
+}
+
+void Scene::SetReevaluationBucketCount(unsigned int a_uiBucketCount) {
+	m_reevaluationSchedule.SetBucketCount(a_uiBucketCount);
+}
+
+template <typename TComponent, typename... TArguments>
+TComponent* Scene::CreateComponent(TArguments&&... a_rArguments) {
+	ObjectPoolBase*& rpPool = m_componentPools[TComponent::msc_componentType];
+
+	if (!rpPool) {
+		rpPool = new ObjectPool<TComponent>();
+	}
+
+	PoolHandle handle;
+	TComponent* pComponent = static_cast<ObjectPool<TComponent>*>(rpPool)->Create(handle,
+		std::forward<TArguments>(a_rArguments)...);
+	pComponent->SetPoolHandle(handle);
+	return pComponent;
 }
 
-const std::map<unsigned int, Entity*>& Scene::GetAllEntities() const {
+Entity* Scene::GetEntity(PoolHandle a_handle) const {
+	return m_entityPool.Get(a_handle);
+}
+
+const std::vector<Entity*>& Scene::GetAllEntities() const {
 	return m_sceneEntities;
 }
 
+const std::vector<Archetype>& Scene::GetArchetypes() const {
+	return m_archetypes;
+}
+
 const unsigned int Scene::GetEntityCount() const {
 	return m_uiEntityCount;
 }
@@ -107,8 +554,8 @@ const unsigned int Scene::GetEntityCount(std::string a_tag) const {
 	// Entities in the scene with a matching tag.
 	unsigned int matchingEntities = 0;
 
-	for (std::pair<unsigned int, Entity*> entity : m_sceneEntities) {
-		if (entity.second->GetTag() == a_tag) {
+	for (const Entity* pEntity : m_sceneEntities) {
+		if (pEntity && pEntity->GetTag() == a_tag) {
 			++matchingEntities;
 		}
 	}
@@ -116,8 +563,89 @@ const unsigned int Scene::GetEntityCount(std::string a_tag) const {
 	return matchingEntities;
 }
 
-const OctTree<Entity, glm::vec3>& Scene::GetOctTree() const {
-	return m_octTree;
+const SpatialIndex<Entity, glm::vec3>& Scene::GetSpatialIndex() const {
+	return *m_pSpatialIndex;
+}
+
+Scene::SPATIAL_INDEX_TYPE Scene::GetSpatialIndexType() const {
+	return m_spatialIndexType;
+}
+
+const FlockSystem* Scene::GetFlockSystem() const {
+	return m_pFlockSystem;
+}
+
+const SweepAndPrune& Scene::GetBroadphase() const {
+	return m_broadphase;
+}
+
+const ContactCache& Scene::GetContacts() const {
+	return m_contacts;
+}
+
+OctTree<Entity, glm::vec3>::UPDATE_MODE Scene::GetOctTreeUpdateMode() const {
+	if (m_spatialIndexType == SPATIAL_INDEX_TYPE_OCT_TREE) {
+		return static_cast<const OctTree<Entity, glm::vec3>*>(m_pSpatialIndex)->GetUpdateMode();
+	}
+
+	return OctTree<Entity, glm::vec3>::UPDATE_MODE_REFIT;
+}
+
+bool Scene::GetFrustumCullingState() const {
+	return m_bFrustumCulling;
+}
+
+bool Scene::GetNeighbourListState() const {
+	return m_bUseNeighbourLists;
+}
+
+const NeighbourList& Scene::GetNeighbourList() const {
+	return m_neighbourList;
+}
+
+bool Scene::GetCellAggregateState() const {
+	return m_bUseCellAggregates;
+}
+
+float Scene::GetOpeningAngle() const {
+	return m_fOpeningAngle;
+}
+
+const OctTree<Entity, glm::vec3>* Scene::GetOctTree() const {
+	return m_spatialIndexType == SPATIAL_INDEX_TYPE_OCT_TREE ?
+		static_cast<const OctTree<Entity, glm::vec3>*>(m_pSpatialIndex) : nullptr;
+}
+
+const FixedTimestep& Scene::GetClock() const {
+	return m_clock;
+}
+
+unsigned int Scene::GetReevaluationBucketCount() const {
+	return m_reevaluationSchedule.GetBucketCount();
+}
+
+const FrameTimeHistogram& Scene::GetStepTimes() const {
+	return m_stepTimes;
+}
+
+const FrameTimeHistogram& Scene::GetStageTimes(UPDATE_STAGE a_stage) const {
+	return m_stageTimes[a_stage];
+}
+
+void Scene::ClearStepTimes() {
+	m_stepTimes.Clear();
+
+	for (FrameTimeHistogram& rStageTimes : m_stageTimes) {
+		rStageTimes.Clear();
+	}
+}
+
+unsigned int Scene::GetDrawnEntityCount() const {
+	return m_uiDrawnEntityCount;
+}
+
+unsigned int Scene::GetCulledEntityCount() const {
+	return m_uiCulledEntityCount;
 }
 
 #endif // !SCENE_H.
@@ -0,0 +1,201 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+#ifndef SCENE_SNAPSHOT_H
+#define SCENE_SNAPSHOT_H
+
+// Header includes.
+#include "BoundingBox.h"
+#include "glm/glm.hpp"
+#include "ObjectPool.h"
+#include <vector>
+
+// Forward declarations.
+class DrawQueue;
+class Frustum;
+class Model;
+
+/// <summary>
+/// A copy of everything needed to draw a scene at one moment, so it can be drawn on one thread while the scene is
+/// simulated on another.
+/// </summary>
+class SceneSnapshot {
+public:
+	/// <summary>
+	/// A model to draw for one entity.
+	/// </summary>
+	struct ModelInstance {
+		/// <summary>
+		/// Used to find the same entity's model in an earlier snapshot. An entity that has taken over the slot of
+		/// one that was destroyed has a different generation, so it isn't mistaken for the old one.
+		/// </summary>
+		PoolHandle entityHandle;
+		Model* pModel;
+		glm::mat4 modelMatrix;
+		/// <summary>
+		/// Where the model was in the previous snapshot that was published, or where it is now if its entity has only
+		/// just been added to the scene.
+		/// </summary>
+		glm::vec3 previousPosition;
+		/// <summary>
+		/// The width, height, and depth of the volume around the model's position that's tested against the camera's
+		/// view, as measured outward from its position.
+		/// </summary>
+		glm::vec3 cullingExtents;
+		/// <summary>
+		/// False if the model is always drawn, because there was nothing to test against the camera's view.
+		/// </summary>
+		bool bCullable;
+	};
+
+	/// <summary>
+	/// A group of models that are near each other, which is tested against the camera's view all at once.
+	/// </summary>
+	struct ModelCell {
+		/// <summary>
+		/// Holds every one of the cell's models in both the previous step and this one, so it holds them wherever
+		/// they're drawn in between.
+		/// </summary>
+		BoundingBox<glm::vec3> bounds;
+		/// <summary>
+		/// Where the cell's models start within the snapshot's cell-ordered model indices.
+		/// </summary>
+		unsigned int uiFirstModel;
+		unsigned int uiModelCount;
+	};
+
+	/// <summary>
+	/// The edges of a box to draw as lines.
+	/// </summary>
+	struct LineBox {
+		BoundingBox<glm::vec3> box;
+		glm::vec3 colour;
+	};
+
+	SceneSnapshot();
+	~SceneSnapshot() {}
+
+	/// <summary>
+	/// Removes every model and line, keeping their memory for the next snapshot.
+	/// </summary>
+	void Clear();
+	/// <summary>
+	/// Records a model to be drawn. Models must be added in order of the slots that their entities are stored in.
+	/// </summary>
+	/// <param name="a_entityHandle"> The handle of the entity that the model belongs to. </param>
+	/// <param name="a_pModel"> The model to draw. </param>
+	/// <param name="a_rModelMatrix"> The model's transform. </param>
+	/// <param name="a_pCullingExtents"> The size of the volume around the model that's tested against the camera's
+	/// view, or null to always draw the model. </param>
+	void AddModelInstance(PoolHandle a_entityHandle,
+		Model* a_pModel,
+		const glm::mat4& a_rModelMatrix,
+		const glm::vec3* a_pCullingExtents);
+	/// <summary>
+	/// Records the edges of a box to be drawn as lines.
+	/// </summary>
+	/// <param name="a_rBox"> The box to draw. </param>
+	/// <param name="a_rColour"> The lines' red, green, and blue colour values, from zero to one. </param>
+	void AddLineBox(const BoundingBox<glm::vec3>& a_rBox,
+		const glm::vec3& a_rColour);
+	/// <summary>
+	/// Records where each model was in the snapshot that was published before this one, and when that snapshot was
+	/// taken, so that the snapshot can be drawn between the two steps without the earlier one being kept around.
+	/// Then groups the models into cells, so that whole cells of models can be culled at once.
+	/// </summary>
+	/// <param name="a_rPreviousSnapshot"> The snapshot that was published before this one. </param>
+	void SetPreviousStep(const SceneSnapshot& a_rPreviousSnapshot);
+	/// <summary>
+	/// Draws the snapshot's models and lines. Each model is moved part of the way back towards where it was in the
+	/// previous step, so that motion looks smooth when snapshots arrive at a different rate to frames being drawn.
+	/// </summary>
+	/// <param name="a_pDrawQueue"> The queue that draws the models and lines. </param>
+	/// <param name="a_fInterpolation"> How far to move each model from where it was in the previous step (at zero) to
+	/// where it is in this snapshot (at one). </param>
+	/// <param name="a_pViewFrustum"> Models outside of this volume aren't drawn. Null to draw every model. Cells that
+	/// are entirely inside or outside of it are drawn or skipped without testing their models. </param>
+	/// <returns> The number of models that were drawn. </returns>
+	unsigned int Draw(DrawQueue* a_pDrawQueue,
+		float a_fInterpolation,
+		const Frustum* a_pViewFrustum) const;
+
+	/// <summary>
+	/// Sets the time (in seconds) at which the snapshot was taken.
+	/// </summary>
+	inline void SetTime(double a_dTime);
+
+	inline double GetTime() const;
+	/// <summary>
+	/// Returns the time (in seconds) at which the previous step's snapshot was taken.
+	/// </summary>
+	inline double GetPreviousTime() const;
+	inline unsigned int GetModelInstanceCount() const;
+
+private:
+	/// <summary>
+	/// Roughly how many models are grouped into each cell. Fewer makes the cells fit their models more tightly, but
+	/// leaves more cells to test.
+	/// </summary>
+	static const unsigned int msc_uiModelsPerCell = 64;
+	/// <summary>
+	/// The most cells there can be along each axis.
+	/// </summary>
+	static const unsigned int msc_uiMaximumCellsPerAxis = 16;
+
+	/// <summary>
+	/// Splits the volume that the models cover into a grid of cells and sorts each cullable model into the cell that
+	/// it's in now, fitting each cell's bounds around its models.
+	/// </summary>
+	void GroupModelsByCell();
+	/// <summary>
+	/// Queues a model to be drawn part of the way between where it was in the previous step and where it is now.
+	/// </summary>
+	/// <param name="a_pViewFrustum"> The model isn't drawn if it's outside this volume. Null to always draw it. </param>
+	/// <returns> True if the model was drawn. </returns>
+	bool DrawModelInstance(DrawQueue* a_pDrawQueue,
+		const ModelInstance& a_rInstance,
+		float a_fInterpolation,
+		const Frustum* a_pViewFrustum) const;
+
+	/// <summary>
+	/// Sorted by entity slot, so that each model's previous position can be found by walking through the previous
+	/// snapshot once.
+	/// </summary>
+	std::vector<ModelInstance> m_modelInstances;
+	std::vector<ModelCell> m_modelCells;
+	/// <summary>
+	/// The indices of the cullable models, ordered by the cell that they're in.
+	/// </summary>
+	std::vector<unsigned int> m_cellModels;
+	/// <summary>
+	/// The indices of the models that are always drawn.
+	/// </summary>
+	std::vector<unsigned int> m_uncullableModels;
+	/// <summary>
+	/// The number of models in each of the grid's cells, reused while grouping.
+	/// </summary>
+	std::vector<unsigned int> m_cellCounts;
+	std::vector<LineBox> m_lineBoxes;
+	double m_dTime;
+	double m_dPreviousTime;
+};
+
+void SceneSnapshot::SetTime(double a_dTime) {
+	m_dTime = a_dTime;
+}
+
+double SceneSnapshot::GetTime() const {
+	return m_dTime;
+}
+
+double SceneSnapshot::GetPreviousTime() const {
+	return m_dPreviousTime;
+}
+
+unsigned int SceneSnapshot::GetModelInstanceCount() const {
+	return m_modelInstances.size();
+}
+
+#endif // !SCENE_SNAPSHOT_H
@@ -0,0 +1,445 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+#ifndef SPATIAL_HASH_GRID_H
+#define SPATIAL_HASH_GRID_H
+
+// Header includes.
+#include "Boundary.h"
+#include "BoundingBox.h"
+#include "glm/glm.hpp"
+#include "SpatialIndex.h"
+#include <algorithm>
+#include <cfloat>
+#include <unordered_map>
+#include <vector>
+
+/// <summary>
+/// Divides a volume of space into a grid of equally sized cells. Works best when objects are spread evenly across
+/// the volume and queries are roughly the same size as a cell, because each query then only has to visit a few
+/// neighbouring cells.
+/// The grid is rebuilt from scratch on every update by sorting the objects by cell, which keeps each cell's objects
+/// next to each other in memory.
+/// </summary>
+/// <typeparam name="TObject"> The type of object to keep track of. Can be an incomplete type. </typeparam>
+/// <typeparam name="TVector"> The type of vector that stores each object's position. Must be a complete type. </typeparam>
+template <typename TObject, typename TVector>
+class SpatialHashGrid : public SpatialIndex<TObject, TVector> {
+public:
+	typedef typename SpatialIndex<TObject, TVector>::QueryCallback QueryCallback;
+	typedef typename SpatialIndex<TObject, TVector>::NearestObject NearestObject;
+
+	/// <summary>
+	/// An object that's registered with the grid.
+	/// </summary>
+	struct ObjectEntry {
+		TObject* pObject;
+		/// <summary>
+		/// The object's boundary, which follows the object as it moves.
+		/// </summary>
+		const Boundary<TVector>* pBoundary;
+		/// <summary>
+		/// A copy of the object's bounds from when the grid was last updated.
+		/// </summary>
+		BoundingBox<TVector> bounds;
+		/// <summary>
+		/// Where the object was placed within the sorted objects during the last update, or msc_uiUnsortedIndex if
+		/// it was registered after that.
+		/// </summary>
+		unsigned int uiSortedIndex;
+	};
+
+	/// <summary>
+	/// Creates a new grid.
+	/// </summary>
+	/// <param name="a_position"> The grid's central position. </param>
+	/// <param name="a_dimensions"> The grid's width, height, and depth as measured outward from its central position. </param>
+	/// <param name="a_fCellSize"> The width, height, and depth of each cell. Should match the size of a typical
+	/// query. </param>
+	SpatialHashGrid(TVector a_position,
+		TVector a_dimensions,
+		float a_fCellSize);
+	virtual ~SpatialHashGrid() {}
+
+	/// <summary>
+	/// Sorts every object into the cell that matches its current position.
+	/// Always call once per frame, before the grid is queried.
+	/// </summary>
+	virtual void Update();
+
+	/// <summary>
+	/// Registers an object with the grid. The object can be found by queries once the grid has been updated.
+	/// </summary>
+	/// <param name="a_pObject"> The object to register. </param>
+	/// <param name="a_rBoundary"> The object's boundary. </param>
+	/// <returns> True the object was successfully added to the grid. </returns>
+	virtual bool InsertObject(TObject* a_pObject,
+		const Boundary<TVector>& a_rBoundary);
+	/// <summary>
+	/// Unregisters an object from the grid. Its sorted copy is blanked out straight away so that queries can't find
+	/// the object afterwards, and the gap is closed when the grid is next updated.
+	/// </summary>
+	/// <param name="a_pObject"> The object to unregister. </param>
+	/// <returns> True if the object was found and removed from the grid. </returns>
+	virtual bool RemoveObject(TObject* a_pObject);
+	/// <summary>
+	/// Finds every object within a volume of the grid and passes each one to a visitor.
+	/// Objects are tested against their bounds from when the grid was last updated.
+	/// </summary>
+	/// <typeparam name="TVisitor"> A callable type that accepts a TObject pointer. </typeparam>
+	/// <param name="a_rQueryVolume"> The space within the grid that will be searched. </param>
+	/// <param name="a_rVisitor"> Called once for every object that's found within the space to search. </param>
+	template <typename TVisitor>
+	void Query(const BoundingBox<TVector>& a_rQueryVolume,
+		TVisitor&& a_rVisitor) const;
+	virtual void Query(const BoundingBox<TVector>& a_rQueryVolume,
+		std::vector<TObject*>& a_rContainedEntities) const;
+	virtual void Query(const BoundingBox<TVector>& a_rQueryVolume,
+		QueryCallback a_callback,
+		void* a_pUserData) const;
+	/// <summary>
+	/// Finds the objects whose positions are nearest to a position. Cells are searched in shells that grow outward
+	/// from the position's cell, stopping once every unsearched cell is further away than every object found.
+	/// </summary>
+	/// <param name="a_rPosition"> The position to search around. </param>
+	/// <param name="a_uiCount"> The most objects to find. </param>
+	/// <param name="a_rNearestObjects"> Cleared, then filled with the found objects from nearest to furthest. </param>
+	virtual void QueryNearest(const TVector& a_rPosition,
+		unsigned int a_uiCount,
+		std::vector<NearestObject>& a_rNearestObjects) const;
+
+	virtual const BoundingBox<TVector>& GetArea() const;
+	virtual unsigned int GetObjectCount() const;
+	inline float GetCellSize() const;
+
+private:
+	/// <summary>
+	/// Marks objects that haven't been sorted yet.
+	/// </summary>
+	static const unsigned int msc_uiUnsortedIndex = ~0u;
+
+	/// <summary>
+	/// Sorts the registered objects by cell.
+	/// </summary>
+	void Rebuild();
+	/// <summary>
+	/// Finds the cell coordinates that contain a position. Positions outside of the grid are moved into the nearest
+	/// cell along its edge.
+	/// </summary>
+	/// <param name="a_rPosition"> A position. </param>
+	/// <returns> The cell's x, y, and z coordinates. </returns>
+	glm::ivec3 GetCellCoordinates(const TVector& a_rPosition) const;
+	/// <summary>
+	/// Converts cell coordinates into the cell's index.
+	/// </summary>
+	/// <param name="a_rCoordinates"> The cell's x, y, and z coordinates. </param>
+	/// <returns> The cell's index. </returns>
+	inline unsigned int GetCellIndex(const glm::ivec3& a_rCoordinates) const;
+
+	/// <summary>
+	/// The volume of space that the grid covers.
+	/// </summary>
+	BoundingBox<TVector> m_area;
+	/// <summary>
+	/// The width, height, and depth of each cell.
+	/// </summary>
+	const float mc_fCellSize;
+	/// <summary>
+	/// The number of cells along the grid's x, y, and z axes.
+	/// </summary>
+	glm::ivec3 m_cellCounts;
+	/// <summary>
+	/// The largest width, height, and depth of any object that's registered with the grid. Queries are widened by
+	/// this much because objects are only sorted into the cell that contains their position.
+	/// </summary>
+	TVector m_objectDimensions;
+	/// <summary>
+	/// Every object that's registered with the grid, in the order they were registered.
+	/// </summary>
+	std::vector<ObjectEntry> m_objects;
+	/// <summary>
+	/// Where each registered object is stored within the registered objects, so objects can be removed without
+	/// searching for them.
+	/// </summary>
+	std::unordered_map<TObject*, unsigned int> m_objectSlots;
+	/// <summary>
+	/// The registered objects, sorted so that each cell's objects are next to each other. Objects that have been
+	/// removed since the last update are left in place with a null object pointer.
+	/// </summary>
+	std::vector<ObjectEntry> m_sortedObjects;
+	/// <summary>
+	/// The index of each cell's first object in the sorted objects. Has one extra element at the end so a cell's
+	/// objects always end where the next cell's objects start.
+	/// </summary>
+	std::vector<unsigned int> m_cellStarts;
+	/// <summary>
+	/// The cell that each registered object was sorted into during the last update.
+	/// </summary>
+	std::vector<unsigned int> m_objectCells;
+};
+
+template <typename TObject, typename TVector>
+SpatialHashGrid<TObject, TVector>::SpatialHashGrid(TVector a_position,
+	TVector a_dimensions,
+	float a_fCellSize) : m_area(a_position, a_dimensions),
+	mc_fCellSize(a_fCellSize > 0.0f ? a_fCellSize : 1.0f),
+	m_cellCounts(1),
+	m_objectDimensions(0.0f),
+	m_objects(),
+	m_objectSlots(),
+	m_sortedObjects(),
+	m_cellStarts(),
+	m_objectCells() {
+	// Round up so the cells always cover the whole area.
+	m_cellCounts = glm::max(glm::ivec3(glm::ceil(a_dimensions * 2.0f / mc_fCellSize)), glm::ivec3(1));
+	m_cellStarts.assign(m_cellCounts.x * m_cellCounts.y * m_cellCounts.z + 1, 0);
+}
+
+template <typename TObject, typename TVector>
+void SpatialHashGrid<TObject, TVector>::Update() {
+	Rebuild();
+}
+
+template <typename TObject, typename TVector>
+bool SpatialHashGrid<TObject, TVector>::InsertObject(TObject* a_pObject,
+	const Boundary<TVector>& a_rBoundary) {
+	if (!a_pObject || !a_rBoundary.GetPosition()) {
+		return false;
+	}
+
+	ObjectEntry entry;
+	entry.pObject = a_pObject;
+	entry.pBoundary = &a_rBoundary;
+	entry.bounds = a_rBoundary.GetBoundingBox();
+	entry.uiSortedIndex = msc_uiUnsortedIndex;
+	m_objectSlots[a_pObject] = m_objects.size();
+	m_objects.push_back(entry);
+	return true;
+}
+
+template <typename TObject, typename TVector>
+bool SpatialHashGrid<TObject, TVector>::RemoveObject(TObject* a_pObject) {
+	typename std::unordered_map<TObject*, unsigned int>::iterator slot = m_objectSlots.find(a_pObject);
+
+	if (slot == m_objectSlots.end()) {
+		return false;
+	}
+
+	const unsigned int i = slot->second;
+	m_objectSlots.erase(slot);
+
+	// Sorting every object again here would make removing many objects at once take quadratic time, so the sorted
+	// objects are only fixed up when the grid is next updated.
+	if (m_objects[i].uiSortedIndex != msc_uiUnsortedIndex) {
+		m_sortedObjects[m_objects[i].uiSortedIndex].pObject = nullptr;
+	}
+
+	// The order of the objects doesn't matter, so fill the gap with the last object.
+	m_objects[i] = m_objects.back();
+	m_objects.pop_back();
+
+	if (i < m_objects.size()) {
+		m_objectSlots[m_objects[i].pObject] = i;
+	}
+
+	return true;
+}
+
+template <typename TObject, typename TVector>
+void SpatialHashGrid<TObject, TVector>::Rebuild() {
+	std::fill(m_cellStarts.begin(), m_cellStarts.end(), 0);
+	m_objectCells.resize(m_objects.size());
+
+	// Count the objects in each cell.
+	for (unsigned int i = 0; i < m_objects.size(); ++i) {
+		ObjectEntry& rObject = m_objects[i];
+
+		if (rObject.pBoundary && rObject.pBoundary->GetPosition()) {
+			rObject.bounds = rObject.pBoundary->GetBoundingBox();
+		}
+
+		m_objectDimensions = glm::max(m_objectDimensions, rObject.bounds.GetDimensions());
+		m_objectCells[i] = GetCellIndex(GetCellCoordinates(rObject.bounds.GetPosition()));
+		++m_cellStarts[m_objectCells[i] + 1];
+	}
+
+	// Turn the counts into each cell's starting index.
+	for (unsigned int i = 1; i < m_cellStarts.size(); ++i) {
+		m_cellStarts[i] += m_cellStarts[i - 1];
+	}
+
+	// Place each object after the objects that have already been placed in its cell. The cell starts are moved
+	// along as objects are placed, and moved back afterwards.
+	m_sortedObjects.resize(m_objects.size());
+
+	for (unsigned int i = 0; i < m_objects.size(); ++i) {
+		m_objects[i].uiSortedIndex = m_cellStarts[m_objectCells[i]]++;
+		m_sortedObjects[m_objects[i].uiSortedIndex] = m_objects[i];
+	}
+
+	for (unsigned int i = m_cellStarts.size() - 1; i > 0; --i) {
+		m_cellStarts[i] = m_cellStarts[i - 1];
+	}
+
+	m_cellStarts[0] = 0;
+}
+
+template <typename TObject, typename TVector>
+template <typename TVisitor>
+void SpatialHashGrid<TObject, TVector>::Query(const BoundingBox<TVector>& a_rQueryVolume,
+	TVisitor&& a_rVisitor) const {
+	// Objects are sorted by their position alone, so widen the search to reach any object that pokes into the
+	// queried volume from a neighbouring cell.
+	const TVector searchDimensions = a_rQueryVolume.GetDimensions() + m_objectDimensions;
+	const glm::ivec3 minimumCell = GetCellCoordinates(a_rQueryVolume.GetPosition() - searchDimensions);
+	const glm::ivec3 maximumCell = GetCellCoordinates(a_rQueryVolume.GetPosition() + searchDimensions);
+
+	for (int z = minimumCell.z; z <= maximumCell.z; ++z) {
+		for (int y = minimumCell.y; y <= maximumCell.y; ++y) {
+			// Cells along the x axis are next to each other, so their objects can be read in one run.
+			const unsigned int firstCell = GetCellIndex(glm::ivec3(minimumCell.x, y, z));
+			const unsigned int lastCell = GetCellIndex(glm::ivec3(maximumCell.x, y, z));
+
+			for (unsigned int i = m_cellStarts[firstCell]; i < m_cellStarts[lastCell + 1]; ++i) {
+				const ObjectEntry& rObject = m_sortedObjects[i];
+
+				if (rObject.pObject && a_rQueryVolume.Overlaps(rObject.bounds)) {
+					a_rVisitor(rObject.pObject);
+				}
+			}
+		}
+	}
+}
+
+template <typename TObject, typename TVector>
+void SpatialHashGrid<TObject, TVector>::Query(const BoundingBox<TVector>& a_rQueryVolume,
+	std::vector<TObject*>& a_rContainedEntities) const {
+	Query(a_rQueryVolume, [&a_rContainedEntities](TObject* a_pObject) {
+		a_rContainedEntities.push_back(a_pObject);
+	});
+}
+
+template <typename TObject, typename TVector>
+void SpatialHashGrid<TObject, TVector>::Query(const BoundingBox<TVector>& a_rQueryVolume,
+	QueryCallback a_callback,
+	void* a_pUserData) const {
+	Query(a_rQueryVolume, [a_callback, a_pUserData](TObject* a_pObject) {
+		a_callback(a_pObject, a_pUserData);
+	});
+}
+
+template <typename TObject, typename TVector>
+void SpatialHashGrid<TObject, TVector>::QueryNearest(const TVector& a_rPosition,
+	unsigned int a_uiCount,
+	std::vector<NearestObject>& a_rNearestObjects) const {
+	a_rNearestObjects.clear();
+
+	if (m_sortedObjects.empty() || a_uiCount == 0) {
+		return;
+	}
+
+	const glm::ivec3 centreCell = GetCellCoordinates(a_rPosition);
+	const TVector gridMinimum = m_area.GetPosition() - m_area.GetDimensions();
+	const glm::ivec3 lastCell = m_cellCounts - 1;
+	const glm::ivec3 furthestShells = glm::max(centreCell, lastCell - centreCell);
+	const int lastShell = glm::max(furthestShells.x, glm::max(furthestShells.y, furthestShells.z));
+	// Cells along the x axis are next to each other, so a run of them can be read in one go.
+	auto addCells = [&](unsigned int a_uiFirstCell, unsigned int a_uiLastCell) {
+		for (unsigned int i = m_cellStarts[a_uiFirstCell]; i < m_cellStarts[a_uiLastCell + 1]; ++i) {
+			const ObjectEntry& rObject = m_sortedObjects[i];
+
+			if (!rObject.pObject) {
+				continue;
+			}
+
+			const TVector offset = rObject.bounds.GetPosition() - a_rPosition;
+			const NearestObject nearestObject = { glm::dot(offset, offset), rObject.pObject };
+			this->AddNearestObject(a_rNearestObjects, a_uiCount, nearestObject);
+		}
+	};
+
+	for (int shell = 0; shell <= lastShell; ++shell) {
+		const glm::ivec3 minimumCell = glm::max(centreCell - shell, glm::ivec3(0));
+		const glm::ivec3 maximumCell = glm::min(centreCell + shell, lastCell);
+
+		for (int z = minimumCell.z; z <= maximumCell.z; ++z) {
+			for (int y = minimumCell.y; y <= maximumCell.y; ++y) {
+				// Rows on the shell's top, bottom, front, or back are part of the shell all the way along, whereas
+				// the other rows only touch it at their ends.
+				if (glm::abs(z - centreCell.z) == shell || glm::abs(y - centreCell.y) == shell) {
+					addCells(GetCellIndex(glm::ivec3(minimumCell.x, y, z)), GetCellIndex(glm::ivec3(maximumCell.x, y, z)));
+					continue;
+				}
+
+				if (centreCell.x - shell >= 0) {
+					const unsigned int cell = GetCellIndex(glm::ivec3(centreCell.x - shell, y, z));
+					addCells(cell, cell);
+				}
+
+				if (centreCell.x + shell <= lastCell.x) {
+					const unsigned int cell = GetCellIndex(glm::ivec3(centreCell.x + shell, y, z));
+					addCells(cell, cell);
+				}
+			}
+		}
+
+		// Finds how close the unsearched cells come to the position. Positions beyond the grid's edges are sorted
+		// into the edge cells, so there's nothing left to search past a side that has reached an edge.
+		float unsearchedDistance = FLT_MAX;
+
+		for (int axis = 0; axis < 3; ++axis) {
+			if (minimumCell[axis] > 0) {
+				unsearchedDistance = glm::min(unsearchedDistance,
+					a_rPosition[axis] - (gridMinimum[axis] + minimumCell[axis] * mc_fCellSize));
+			}
+
+			if (maximumCell[axis] < lastCell[axis]) {
+				unsearchedDistance = glm::min(unsearchedDistance,
+					gridMinimum[axis] + (maximumCell[axis] + 1) * mc_fCellSize - a_rPosition[axis]);
+			}
+		}
+
+		if (unsearchedDistance == FLT_MAX) {
+			break;
+		}
+
+		unsearchedDistance = glm::max(unsearchedDistance, 0.0f);
+
+		if (!this->CanBeNearer(a_rNearestObjects, a_uiCount, unsearchedDistance * unsearchedDistance)) {
+			break;
+		}
+	}
+
+	std::sort_heap(a_rNearestObjects.begin(), a_rNearestObjects.end());
+}
+
+template <typename TObject, typename TVector>
+glm::ivec3 SpatialHashGrid<TObject, TVector>::GetCellCoordinates(const TVector& a_rPosition) const {
+	const TVector gridMinimum = m_area.GetPosition() - m_area.GetDimensions();
+	const glm::ivec3 coordinates(glm::floor((a_rPosition - gridMinimum) / mc_fCellSize));
+	return glm::clamp(coordinates, glm::ivec3(0), m_cellCounts - 1);
+}
+
+template <typename TObject, typename TVector>
+unsigned int SpatialHashGrid<TObject, TVector>::GetCellIndex(const glm::ivec3& a_rCoordinates) const {
+	return a_rCoordinates.x + m_cellCounts.x * (a_rCoordinates.y + m_cellCounts.y * a_rCoordinates.z);
+}
+
+template <typename TObject, typename TVector>
+const BoundingBox<TVector>& SpatialHashGrid<TObject, TVector>::GetArea() const {
+	return m_area;
+}
+
+template <typename TObject, typename TVector>
+unsigned int SpatialHashGrid<TObject, TVector>::GetObjectCount() const {
+	return m_objects.size();
+}
+
+template <typename TObject, typename TVector>
+float SpatialHashGrid<TObject, TVector>::GetCellSize() const {
+	return mc_fCellSize;
+}
+
+#endif // !SPATIAL_HASH_GRID_H
@@ -0,0 +1,211 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+#ifndef SPATIAL_INDEX_H
+#define SPATIAL_INDEX_H
+
+// Header includes.
+#include "Boundary.h"
+#include "BoundingBox.h"
+#include "SceneSnapshot.h"
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+/// <summary>
+/// Keeps track of where objects are positioned within a volume of space so that nearby objects can be found without
+/// checking every object.
+/// </summary>
+/// <typeparam name="TObject"> The type of object to keep track of. Can be an incomplete type. </typeparam>
+/// <typeparam name="TVector"> The type of vector that stores each object's position. Must be a complete type. </typeparam>
+template <typename TObject, typename TVector>
+class SpatialIndex {
+public:
+	/// <summary>
+	/// Called once for every object that's found by a query.
+	/// </summary>
+	typedef void (*QueryCallback)(TObject* a_pObject, void* a_pUserData);
+
+	/// <summary>
+	/// An object found by a nearest object query, along with how far its position is from the queried position.
+	/// </summary>
+	struct NearestObject {
+		float fSquaredDistance;
+		TObject* pObject;
+
+		/// <summary>
+		/// Orders objects from nearest to furthest, so the standard heap functions keep the furthest on top.
+		/// </summary>
+		inline bool operator<(const NearestObject& a_rOther) const {
+			return fSquaredDistance < a_rOther.fSquaredDistance;
+		}
+	};
+
+	virtual ~SpatialIndex() {}
+
+	/// <summary>
+	/// Brings the index up-to-date with the current position of each object.
+	/// Always call once per frame, before the index is queried.
+	/// </summary>
+	virtual void Update() = 0;
+
+	/// <summary>
+	/// Registers an object with the index.
+	/// </summary>
+	/// <param name="a_pObject"> The object to register. </param>
+	/// <param name="a_rBoundary"> The object's boundary, which must stay alive while the object is registered. </param>
+	/// <returns> True the object was successfully added to the index. </returns>
+	virtual bool InsertObject(TObject* a_pObject,
+		const Boundary<TVector>& a_rBoundary) = 0;
+	/// <summary>
+	/// Unregisters an object from the index.
+	/// </summary>
+	/// <param name="a_pObject"> The object to unregister. </param>
+	/// <returns> True if the object was found and removed from the index. </returns>
+	virtual bool RemoveObject(TObject* a_pObject) = 0;
+	/// <summary>
+	/// Finds every object within a volume of the index.
+	/// </summary>
+	/// <param name="a_rQueryVolume"> The space within the index that will be searched. </param>
+	/// <param name="a_rContainedEntities"> The found objects are added to the end of this collection, which isn't
+	/// cleared first so that its memory can be reused between queries. </param>
+	virtual void Query(const BoundingBox<TVector>& a_rQueryVolume,
+		std::vector<TObject*>& a_rContainedEntities) const = 0;
+	/// <summary>
+	/// Finds every object within a volume of the index and passes each one to a callback.
+	/// </summary>
+	/// <param name="a_rQueryVolume"> The space within the index that will be searched. </param>
+	/// <param name="a_callback"> Called once for every object that's found within the space to search. </param>
+	/// <param name="a_pUserData"> Passed to the callback alongside each object. </param>
+	virtual void Query(const BoundingBox<TVector>& a_rQueryVolume,
+		QueryCallback a_callback,
+		void* a_pUserData) const = 0;
+	/// <summary>
+	/// Finds every object within a volume of the index and passes each one to a visitor.
+	/// </summary>
+	/// <typeparam name="TVisitor"> A callable type that accepts a TObject pointer. </typeparam>
+	/// <param name="a_rQueryVolume"> The space within the index that will be searched. </param>
+	/// <param name="a_rVisitor"> Called once for every object that's found within the space to search. </param>
+	template <typename TVisitor>
+	void Query(const BoundingBox<TVector>& a_rQueryVolume,
+		TVisitor&& a_rVisitor) const;
+	/// <summary>
+	/// Finds the objects whose positions are nearest to a position, however far away they are.
+	/// </summary>
+	/// <param name="a_rPosition"> The position to search around. </param>
+	/// <param name="a_uiCount"> The most objects to find. Fewer are found if fewer are registered. </param>
+	/// <param name="a_rNearestObjects"> Cleared, then filled with the found objects from nearest to furthest. Its
+	/// memory can be reused between queries. </param>
+	virtual void QueryNearest(const TVector& a_rPosition,
+		unsigned int a_uiCount,
+		std::vector<NearestObject>& a_rNearestObjects) const = 0;
+	/// <summary>
+	/// Adds the edges of the volume of space that the index covers to a draw queue's batch of lines. Indices that
+	/// divide their space into areas can draw those too.
+	/// </summary>
+	/// <param name="a_pDrawQueue"> The queue that draws the index's lines. </param>
+	virtual void Draw(DrawQueue* a_pDrawQueue) const;
+	/// <summary>
+	/// Adds the same lines as Draw to a snapshot, so they can be drawn on another thread.
+	/// </summary>
+	/// <param name="a_rSnapshot"> The snapshot to add the index's lines to. </param>
+	virtual void WriteSnapshot(SceneSnapshot& a_rSnapshot) const;
+
+	/// <summary>
+	/// Returns the volume of space that the index covers.
+	/// </summary>
+	virtual const BoundingBox<TVector>& GetArea() const = 0;
+	/// <summary>
+	/// Returns the number of objects that are registered with the index.
+	/// </summary>
+	/// <returns> The number of registered objects. </returns>
+	virtual unsigned int GetObjectCount() const = 0;
+
+protected:
+	/// <summary>
+	/// Offers an object to a heap of the nearest objects found so far, which holds no more than a number of objects.
+	/// Once it's full, the object replaces the furthest one if it's nearer.
+	/// </summary>
+	/// <param name="a_rNearestObjects"> A max-heap ordered by distance. </param>
+	/// <param name="a_uiCount"> The most objects the heap can hold. </param>
+	/// <param name="a_rObject"> The object to offer. </param>
+	static void AddNearestObject(std::vector<NearestObject>& a_rNearestObjects,
+		unsigned int a_uiCount,
+		const NearestObject& a_rObject);
+	/// <summary>
+	/// Returns true if something at a distance could still be among the nearest objects, either because the heap
+	/// isn't full yet or because it's nearer than the furthest object in the heap.
+	/// </summary>
+	static inline bool CanBeNearer(const std::vector<NearestObject>& a_rNearestObjects,
+		unsigned int a_uiCount,
+		float a_fSquaredDistance);
+	/// <summary>
+	/// Returns the squared distance from a position to the closest point of a box, which is zero inside the box.
+	/// No object within the box can be nearer to the position than this.
+	/// </summary>
+	static inline float GetSquaredDistance(const BoundingBox<TVector>& a_rBox,
+		const TVector& a_rPosition);
+};
+
+template <typename TObject, typename TVector>
+template <typename TVisitor>
+void SpatialIndex<TObject, TVector>::Query(const BoundingBox<TVector>& a_rQueryVolume,
+	TVisitor&& a_rVisitor) const {
+	typedef typename std::remove_reference<TVisitor>::type VisitorType;
+	// Hands the visitor to the index as user data so that querying doesn't need to allocate any memory.
+	Query(a_rQueryVolume, [](TObject* a_pObject, void* a_pUserData) {
+		(*static_cast<VisitorType*>(a_pUserData))(a_pObject);
+	}, const_cast<void*>(static_cast<const void*>(std::addressof(a_rVisitor))));
+}
+
+template <typename TObject, typename TVector>
+void SpatialIndex<TObject, TVector>::AddNearestObject(std::vector<NearestObject>& a_rNearestObjects,
+	unsigned int a_uiCount,
+	const NearestObject& a_rObject) {
+	if (a_rNearestObjects.size() < a_uiCount) {
+		a_rNearestObjects.push_back(a_rObject);
+		std::push_heap(a_rNearestObjects.begin(), a_rNearestObjects.end());
+	} else if (a_uiCount > 0 && a_rObject < a_rNearestObjects.front()) {
+		// Swaps the furthest object out for the nearer one.
+		std::pop_heap(a_rNearestObjects.begin(), a_rNearestObjects.end());
+		a_rNearestObjects.back() = a_rObject;
+		std::push_heap(a_rNearestObjects.begin(), a_rNearestObjects.end());
+	}
+}
+
+template <typename TObject, typename TVector>
+bool SpatialIndex<TObject, TVector>::CanBeNearer(const std::vector<NearestObject>& a_rNearestObjects,
+	unsigned int a_uiCount,
+	float a_fSquaredDistance) {
+	return a_rNearestObjects.size() < a_uiCount || a_fSquaredDistance < a_rNearestObjects.front().fSquaredDistance;
+}
+
+template <typename TObject, typename TVector>
+float SpatialIndex<TObject, TVector>::GetSquaredDistance(const BoundingBox<TVector>& a_rBox,
+	const TVector& a_rPosition) {
+	const TVector closestPoint = glm::clamp(a_rPosition,
+		a_rBox.GetPosition() - a_rBox.GetDimensions(),
+		a_rBox.GetPosition() + a_rBox.GetDimensions());
+	const TVector offset = a_rPosition - closestPoint;
+	return glm::dot(offset, offset);
+}
+
+template <typename TObject, typename TVector>
+void SpatialIndex<TObject, TVector>::Draw(DrawQueue* a_pDrawQueue) const {
+	if (!a_pDrawQueue) {
+		return;
+	}
+
+	const TVector colour(1.0f);
+	a_pDrawQueue->AddLineBox(&GetArea().GetPosition().x, &GetArea().GetDimensions().x, &colour.x);
+}
+
+template <typename TObject, typename TVector>
+void SpatialIndex<TObject, TVector>::WriteSnapshot(SceneSnapshot& a_rSnapshot) const {
+	a_rSnapshot.AddLineBox(GetArea(), TVector(1.0f));
+}
+
+#endif // !SPATIAL_INDEX_H
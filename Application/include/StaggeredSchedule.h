@@ -0,0 +1,106 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+#ifndef STAGGERED_SCHEDULE_H
+#define STAGGERED_SCHEDULE_H
+
+/// <summary>
+/// Spreads an expensive task that's repeated at a fixed interval across the ticks in between, so that only some of
+/// the objects that run it do so on each tick.
+/// Each object is given a phase, which places it in one of a number of buckets. Every bucket is due once per
+/// interval, and the buckets are due on evenly spaced ticks within it.
+/// </summary>
+class StaggeredSchedule {
+public:
+	/// <summary>
+	/// Creates a schedule.
+	/// </summary>
+	/// <param name="a_uiInterval"> The number of ticks between each time that an object runs the task. </param>
+	/// <param name="a_uiBucketCount"> The number of buckets to split the objects into. One makes every object run
+	/// the task on the same tick. </param>
+	inline StaggeredSchedule(unsigned int a_uiInterval = 1,
+		unsigned int a_uiBucketCount = 1);
+	~StaggeredSchedule() {}
+
+	/// <summary>
+	/// Checks if an object is due to run the task on a tick.
+	/// </summary>
+	/// <param name="a_uiTick"> The tick to check, counting from zero. </param>
+	/// <param name="a_uiPhase"> A number that stays the same for the object, such as its ID. Consecutive phases are
+	/// placed in different buckets. </param>
+	/// <returns> True if the object should run the task. </returns>
+	inline bool IsDue(unsigned int a_uiTick,
+		unsigned int a_uiPhase) const;
+	/// <summary>
+	/// Checks if any bucket is due to run the task on a tick.
+	/// </summary>
+	/// <param name="a_uiTick"> The tick to check, counting from zero. </param>
+	/// <returns> False if no object would run the task, whatever its phase. </returns>
+	inline bool IsAnyDue(unsigned int a_uiTick) const;
+
+	/// <summary>
+	/// Sets the number of ticks between each time that an object runs the task. At least one tick is always used.
+	/// </summary>
+	inline void SetInterval(unsigned int a_uiInterval);
+	/// <summary>
+	/// Sets the number of buckets to split the objects into. Limited to the interval, as there's no tick to run any
+	/// more buckets on.
+	/// </summary>
+	inline void SetBucketCount(unsigned int a_uiBucketCount);
+
+	inline unsigned int GetInterval() const;
+	/// <summary>
+	/// Returns the number of buckets that the objects are split into, which is never more than the interval.
+	/// </summary>
+	inline unsigned int GetBucketCount() const;
+
+private:
+	unsigned int m_uiInterval;
+	/// <summary>
+	/// The number of buckets that was asked for, which may be more than the interval.
+	/// </summary>
+	unsigned int m_uiBucketCount;
+};
+
+StaggeredSchedule::StaggeredSchedule(unsigned int a_uiInterval,
+	unsigned int a_uiBucketCount) : m_uiInterval(1),
+	m_uiBucketCount(1) {
+	SetInterval(a_uiInterval);
+	SetBucketCount(a_uiBucketCount);
+}
+
+bool StaggeredSchedule::IsDue(unsigned int a_uiTick,
+	unsigned int a_uiPhase) const {
+	const unsigned int bucketCount = GetBucketCount();
+	// Spaces the buckets evenly across the interval, so each tick runs no more than one bucket.
+	const unsigned int bucketTick = (a_uiPhase % bucketCount) * m_uiInterval / bucketCount;
+	return a_uiTick % m_uiInterval == bucketTick;
+}
+
+bool StaggeredSchedule::IsAnyDue(unsigned int a_uiTick) const {
+	const unsigned int bucketCount = GetBucketCount();
+	const unsigned int intervalTick = a_uiTick % m_uiInterval;
+	// The first bucket that's due on or after the tick, which is only due on it if no bucket is due in between.
+	const unsigned int bucket = (intervalTick * bucketCount + m_uiInterval - 1) / m_uiInterval;
+	return bucket < bucketCount && bucket * m_uiInterval / bucketCount == intervalTick;
+}
+
+void StaggeredSchedule::SetInterval(unsigned int a_uiInterval) {
+	m_uiInterval = a_uiInterval > 0 ? a_uiInterval : 1;
+}
+
+void StaggeredSchedule::SetBucketCount(unsigned int a_uiBucketCount) {
+	m_uiBucketCount = a_uiBucketCount > 0 ? a_uiBucketCount : 1;
+}
+
+unsigned int StaggeredSchedule::GetInterval() const {
+	return m_uiInterval;
+}
+
+unsigned int StaggeredSchedule::GetBucketCount() const {
+	return m_uiBucketCount < m_uiInterval ? m_uiBucketCount : m_uiInterval;
+}
+
+#endif // !STAGGERED_SCHEDULE_H
@@ -0,0 +1,174 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+#ifndef SWEEP_AND_PRUNE_H
+#define SWEEP_AND_PRUNE_H
+
+// Header includes.
+#include "BoundingBox.h"
+#include "ContactCache.h"
+#include "glm/glm.hpp"
+#include "ObjectPool.h"
+#include <vector>
+
+// Forward declarations.
+class ColliderComponent;
+class StaggeredSchedule;
+
+/// <summary>
+/// Finds every pair of colliders that overlap by keeping the ends of their bounds sorted along one axis, and sweeping
+/// along it. Colliders move a little each update, so the ends are re-sorted with an insertion sort that only does as
+/// much work as the number of ends that passed each other.
+/// Each update adds every pair of colliders that overlap to a contact cache, which works out which contacts have
+/// begun and ended. Updates can be staggered so that each only checks the colliders that are due, and the pairs
+/// between colliders that aren't due are left for the contact cache to keep.
+/// </summary>
+class SweepAndPrune {
+public:
+	SweepAndPrune();
+	~SweepAndPrune() {}
+
+	/// <summary>
+	/// Adds a collider, which is sorted into place when the broadphase is next updated.
+	/// </summary>
+	/// <param name="a_uiID"> A small number that no other collider in the broadphase has, such as the slot that the
+	/// collider's entity is stored in. </param>
+	/// <param name="a_pCollider"> The collider to add. </param>
+	/// <param name="a_entityHandle"> The handle of the collider's entity, which its contacts are added with. </param>
+	void AddCollider(unsigned int a_uiID,
+		ColliderComponent* a_pCollider,
+		PoolHandle a_entityHandle);
+	/// <summary>
+	/// Removes a collider. Its contacts end during the next update, as it's no longer there to add them.
+	/// </summary>
+	/// <param name="a_uiID"> The ID that the collider was added with. </param>
+	/// <returns> False if there's no collider with the ID. </returns>
+	bool RemoveCollider(unsigned int a_uiID);
+	/// <summary>
+	/// Re-sorts the colliders' bounds from where the colliders are now, and adds every pair that overlaps to a
+	/// contact cache by their entities' handles.
+	/// </summary>
+	/// <param name="a_rContacts"> The contact cache, which should be between starting and finishing an update. </param>
+	/// <param name="a_pSchedule"> Decides which colliders are checked, by their entities' slots. Only the pairs that
+	/// at least one due collider is in are added. Null to check every collider. </param>
+	/// <param name="a_uiTick"> The step being taken, counting from zero. </param>
+	void Update(ContactCache& a_rContacts,
+		const StaggeredSchedule* a_pSchedule = nullptr,
+		unsigned int a_uiTick = 0);
+
+	inline unsigned int GetColliderCount() const;
+	/// <summary>
+	/// Returns the axis that the bounds are sorted along: zero for x, one for y, or two for z.
+	/// </summary>
+	inline unsigned int GetSortAxis() const;
+	/// <summary>
+	/// Returns the number of times that two ends swapped places while being re-sorted during the last update.
+	/// </summary>
+	inline unsigned int GetSwapCount() const;
+
+private:
+	/// <summary>
+	/// One end of a collider's bounds along the sort axis.
+	/// </summary>
+	struct Endpoint {
+		float fValue;
+		/// <summary>
+		/// The collider's ID shifted up by one bit, with the lowest bit set if this is the upper end.
+		/// </summary>
+		unsigned int uiData;
+	};
+	/// <summary>
+	/// A collider that the sweep is inside of, with a copy of its bounds so the colliders that each new one is tested
+	/// against are read from contiguous memory.
+	/// </summary>
+	struct ActiveProxy {
+		unsigned int uiID;
+		PoolHandle entityHandle;
+		glm::vec3 minimum;
+		glm::vec3 maximum;
+		bool bDue;
+	};
+	/// <summary>
+	/// A collider in the broadphase.
+	/// </summary>
+	struct Proxy {
+		ColliderComponent* pCollider;
+		PoolHandle entityHandle;
+		/// <summary>
+		/// The collider's bounds, as they were at the start of the last update.
+		/// </summary>
+		glm::vec3 minimum;
+		glm::vec3 maximum;
+		/// <summary>
+		/// Where the collider is in the list of colliders that the sweep is currently inside of.
+		/// </summary>
+		unsigned int uiActiveIndex;
+		/// <summary>
+		/// True if the collider's pairs are checked during the current update.
+		/// </summary>
+		bool bDue;
+	};
+
+	/// <summary>
+	/// Returns true if one end belongs before another. Lower ends go before upper ends at the same value, so colliders
+	/// that only just touch count as overlapping.
+	/// </summary>
+	inline static bool IsBefore(const Endpoint& a_rFirst,
+		const Endpoint& a_rSecond);
+	/// <summary>
+	/// Picks the axis that the colliders are spread furthest along, so the sweep passes through as few colliders at
+	/// a time as possible.
+	/// </summary>
+	/// <returns> True if the sort axis changed, which leaves the ends unsorted. </returns>
+	bool ChooseSortAxis();
+	/// <summary>
+	/// Drops the ends of every collider that's been removed.
+	/// </summary>
+	void RemoveStaleEndpoints();
+
+	/// <summary>
+	/// The colliders in the broadphase, indexed by their IDs. Unused IDs have a null collider.
+	/// </summary>
+	std::vector<Proxy> m_proxies;
+	/// <summary>
+	/// Both ends of every collider's bounds along the sort axis, kept sorted between updates.
+	/// </summary>
+	std::vector<Endpoint> m_endpoints;
+	/// <summary>
+	/// The colliders whose bounds the sweep is currently inside of. Kept between updates so its memory can be reused.
+	/// </summary>
+	std::vector<ActiveProxy> m_activeProxies;
+	unsigned int m_uiColliderCount;
+	unsigned int m_uiSortAxis;
+	unsigned int m_uiSwapCount;
+	/// <summary>
+	/// True if colliders have been added since the last update, whose ends haven't been sorted into place yet.
+	/// </summary>
+	bool m_bHasNewColliders;
+	/// <summary>
+	/// True if colliders have been removed since their ends were last dropped.
+	/// </summary>
+	bool m_bHasRemovedColliders;
+};
+
+unsigned int SweepAndPrune::GetColliderCount() const {
+	return m_uiColliderCount;
+}
+
+unsigned int SweepAndPrune::GetSortAxis() const {
+	return m_uiSortAxis;
+}
+
+unsigned int SweepAndPrune::GetSwapCount() const {
+	return m_uiSwapCount;
+}
+
+bool SweepAndPrune::IsBefore(const Endpoint& a_rFirst,
+	const Endpoint& a_rSecond) {
+	return a_rFirst.fValue < a_rSecond.fValue ||
+		(a_rFirst.fValue == a_rSecond.fValue && (a_rFirst.uiData & 1) < (a_rSecond.uiData & 1));
+}
+
+#endif // !SWEEP_AND_PRUNE_H
@@ -0,0 +1,122 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+// Header includes.
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/// <summary>
+/// A fixed set of worker threads that share loops between themselves and the thread that starts the loop.
+/// </summary>
+class ThreadPool {
+public:
+	/// <summary>
+	/// Called by each thread for a range of a loop's iterations.
+	/// </summary>
+	typedef void (*Task)(unsigned int a_uiBegin, unsigned int a_uiEnd, void* a_pUserData);
+
+	/// <summary>
+	/// Creates the pool's worker threads.
+	/// </summary>
+	/// <param name="a_uiThreadCount"> The number of threads that run each loop, including the thread that starts it.
+	/// Zero uses one thread for every hardware thread. </param>
+	ThreadPool(unsigned int a_uiThreadCount = 0);
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+	~ThreadPool();
+
+	/// <summary>
+	/// Splits a loop's iterations into ranges and runs them across the pool's threads, returning once every range has
+	/// been run. Ranges can run in any order, on any thread.
+	/// </summary>
+	/// <param name="a_uiCount"> The number of iterations in the loop. </param>
+	/// <param name="a_task"> Called once for each range of iterations. </param>
+	/// <param name="a_pUserData"> Passed to the task alongside each range. </param>
+	void ParallelFor(unsigned int a_uiCount,
+		Task a_task,
+		void* a_pUserData);
+	/// <summary>
+	/// Splits a loop's iterations into ranges and runs them across the pool's threads, returning once every range has
+	/// been run. Ranges can run in any order, on any thread.
+	/// </summary>
+	/// <typeparam name="TFunction"> A callable type that accepts the first and one past the last iteration of a
+	/// range. </typeparam>
+	/// <param name="a_uiCount"> The number of iterations in the loop. </param>
+	/// <param name="a_rFunction"> Called once for each range of iterations. </param>
+	template <typename TFunction>
+	void ParallelFor(unsigned int a_uiCount,
+		TFunction&& a_rFunction);
+
+	/// <summary>
+	/// Returns the number of threads that run each loop, including the thread that starts it.
+	/// </summary>
+	inline unsigned int GetThreadCount() const;
+
+private:
+	/// <summary>
+	/// Waits for loops to be started and helps to run them, until the pool is destroyed.
+	/// </summary>
+	void RunWorker();
+	/// <summary>
+	/// Runs ranges of the current loop until every range has been taken.
+	/// </summary>
+	void RunRanges();
+
+	/// <summary>
+	/// True once the pool is being destroyed, to tell the workers to stop.
+	/// </summary>
+	bool m_bStopping;
+	/// <summary>
+	/// Counts the loops that have been started, so workers can tell when there's a new one.
+	/// </summary>
+	unsigned int m_uiLoopNumber;
+	/// <summary>
+	/// The number of workers that are still running ranges of the current loop.
+	/// </summary>
+	unsigned int m_uiBusyWorkers;
+	// The current loop.
+	Task m_task;
+	void* m_pUserData;
+	unsigned int m_uiCount;
+	unsigned int m_uiRangeSize;
+	/// <summary>
+	/// The index of the next range of the current loop that hasn't been taken by a thread.
+	/// </summary>
+	std::atomic<unsigned int> m_uiNextRange;
+	std::mutex m_mutex;
+	/// <summary>
+	/// Wakes the workers when a loop is started or the pool is being destroyed.
+	/// </summary>
+	std::condition_variable m_loopStarted;
+	/// <summary>
+	/// Wakes the thread that started a loop once every worker has finished it.
+	/// </summary>
+	std::condition_variable m_loopFinished;
+	std::vector<std::thread> m_workers;
+};
+
+template <typename TFunction>
+void ThreadPool::ParallelFor(unsigned int a_uiCount,
+	TFunction&& a_rFunction) {
+	typedef typename std::remove_reference<TFunction>::type FunctionType;
+	// Hands the function to the pool as user data so that starting a loop doesn't need to allocate any memory.
+	ParallelFor(a_uiCount, [](unsigned int a_uiBegin, unsigned int a_uiEnd, void* a_pUserData) {
+		(*static_cast<FunctionType*>(a_pUserData))(a_uiBegin, a_uiEnd);
+	}, const_cast<void*>(static_cast<const void*>(std::addressof(a_rFunction))));
+}
+
+unsigned int ThreadPool::GetThreadCount() const {
+	return m_workers.size() + 1;
+}
+
+#endif // !THREAD_POOL_H
@@ -16,8 +16,13 @@ class Framework;
 /// <summary>
 /// Allows an entity to store position and rotation data.
 /// </summary>
-class TransformComponent : public Component {
+class TransformComponent final : public Component {
 public:
+	/// <summary>
+	/// The type that the component is attached to entities as, which also picks the pool that scenes store it in.
+	/// </summary>
+	static const COMPONENT_TYPE msc_componentType = COMPONENT_TYPE_TRANSFORM;
+
 	enum MATRIX_ROW {
 		MATRIX_ROW_RIGHT_VECTOR,
 		MATRIX_ROW_UP_VECTOR,
@@ -33,6 +38,8 @@ public:
 
 	virtual void Update(float a_fDeltaTime) {}
 	virtual void Draw(Framework* a_pRenderingFramework) {}
+	virtual Component* Clone(Entity* a_pOwner,
+		Scene* a_pScene);
 
 	/// <summary>
 	/// Sets a row within the transform component's position and rotation matrix.
@@ -0,0 +1,112 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+#ifndef TRIPLE_BUFFER_H
+#define TRIPLE_BUFFER_H
+
+// Header includes.
+#include <atomic>
+
+/// <summary>
+/// Hands values from one thread that writes them to another thread that reads them, without either thread ever
+/// waiting for the other.
+/// The writer fills one buffer while the reader uses another, and the third holds the latest value that's been
+/// published. Publishing and acquiring swap a buffer with the published one, so the reader always gets the newest
+/// value and older values that it never acquired are skipped.
+/// </summary>
+/// <typeparam name="T"> The type of value to hand between the threads. Must be default constructible. </typeparam>
+template <typename T>
+class TripleBuffer {
+public:
+	TripleBuffer();
+	~TripleBuffer() {}
+
+	/// <summary>
+	/// Makes the write buffer the newest value for the reader, and gives the writer the previously published buffer
+	/// to fill next. Only call from the writing thread.
+	/// </summary>
+	void Publish();
+	/// <summary>
+	/// Swaps the read buffer for the newest published value, if there's one that hasn't been acquired yet. Only call
+	/// from the reading thread.
+	/// </summary>
+	/// <returns> True if the read buffer now holds a new value. </returns>
+	bool Acquire();
+	/// <summary>
+	/// Returns true if a value has been published since the reader last acquired one.
+	/// </summary>
+	inline bool IsUpdated() const;
+
+	/// <summary>
+	/// Returns the buffer that the writer fills before publishing it. Only call from the writing thread.
+	/// </summary>
+	inline T& GetWriteBuffer();
+	/// <summary>
+	/// Returns the buffer that the reader last acquired. Only call from the reading thread.
+	/// </summary>
+	inline T& GetReadBuffer();
+
+private:
+	/// <summary>
+	/// Set in the published state when its buffer hasn't been acquired by the reader yet.
+	/// </summary>
+	static const unsigned int msc_uiUpdatedFlag = 4;
+	static const unsigned int msc_uiIndexMask = 3;
+
+	// Neither thread ever waits for the other, so the buffers can't be shared with a third.
+	TripleBuffer(const TripleBuffer&) = delete;
+	TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+	T m_buffers[3];
+	/// <summary>
+	/// The index of the buffer that holds the newest published value, combined with the updated flag.
+	/// </summary>
+	std::atomic<unsigned int> m_uiPublishedState;
+	unsigned int m_uiWriteIndex;
+	unsigned int m_uiReadIndex;
+};
+
+template <typename T>
+TripleBuffer<T>::TripleBuffer() : m_buffers(),
+	m_uiPublishedState(1),
+	m_uiWriteIndex(0),
+	m_uiReadIndex(2) {}
+
+template <typename T>
+void TripleBuffer<T>::Publish() {
+	// Releases the writes to the buffer to the reader, and acquires the reader's last use of the buffer it gives back.
+	const unsigned int previousState = m_uiPublishedState.exchange(m_uiWriteIndex | msc_uiUpdatedFlag,
+		std::memory_order_acq_rel);
+	m_uiWriteIndex = previousState & msc_uiIndexMask;
+}
+
+template <typename T>
+bool TripleBuffer<T>::Acquire() {
+	if (!IsUpdated()) {
+		return false;
+	}
+
+	// Only the reader clears the updated flag, so the published buffer can't have been acquired since the check.
+	const unsigned int previousState = m_uiPublishedState.exchange(m_uiReadIndex, std::memory_order_acq_rel);
+	m_uiReadIndex = previousState & msc_uiIndexMask;
+	return true;
+}
+
+template <typename T>
+bool TripleBuffer<T>::IsUpdated() const {
+	return (m_uiPublishedState.load(std::memory_order_acquire) & msc_uiUpdatedFlag) != 0;
+}
+
+template <typename T>
+T& TripleBuffer<T>::GetWriteBuffer() {
+	return m_buffers[m_uiWriteIndex];
+}
+
+template <typename T>
+T& TripleBuffer<T>::GetReadBuffer() {
+	return m_buffers[m_uiReadIndex];
+}
+
+#endif // !TRIPLE_BUFFER_H
@@ -30,6 +30,10 @@ public:
 	/// </summary>
 	void DrawPhysicsControls() const;
 	/// <summary>
+	/// Draws the UI elements that control how the scene is drawn, and how many entities were drawn last frame.
+	/// </summary>
+	void DrawRenderingControls() const;
+	/// <summary>
 	/// Draws the UI elements that control the application's pause/play states.
 	/// </summary>
 	void DrawTimeControls() const;
@@ -10,6 +10,7 @@
 #include "Entity.h"
 #include "LearnOpenGL/camera.h"
 #include "Framework.h"
+#include "Frustum.h"
 #include "GLFW/glfw3.h"
 #include "imgui.h"
 #include "ModelComponent.h"
@@ -17,9 +18,13 @@
 #include "TransformComponent.h"
 #include "UserInterface.h"
 #include "Utilities.h"
+#include <chrono>
 
-Application::Application() : m_uiBoidCount(50),
-	mc_uiMaximumBoidCount(500),
+Application::Application(Scene::SPATIAL_INDEX_TYPE a_spatialIndexType,
+	bool a_bUseFlockSystem,
+	bool a_bThreadedSimulation) : m_uiBoidCount(50),
+	// The flock system can move ten times as many boids in the same time as their brain components.
+	mc_uiMaximumBoidCount(a_bUseFlockSystem ? 5000 : 500),
 	m_fMarkerZOffset(10.0f),
 	mc_fMimimumMarkerZOffset(0.5f),
 	mc_fMaximumMarkerZOffset(50.0f),
@@ -27,10 +32,18 @@ Application::Application() : m_uiBoidCount(50),
 	m_bPaused(false),
 	m_bUpdateOnce(false),
 	m_bSpawnedObstacle(false),
+	mc_bThreadedSimulation(a_bThreadedSimulation),
+	m_bSimulating(false),
 	m_pFramework(Framework::GetInstance()),
-	m_pScene(new Scene()),
+	m_pScene(new Scene(a_spatialIndexType, a_bUseFlockSystem)),
 	m_pUserInterface(new UserInterface(this)),
-	m_pWorldCursor(new Entity()) {
+	m_pWorldCursor(nullptr),
+	m_simulationThread(),
+	m_sceneMutex(),
+	m_snapshots(),
+	m_previousSnapshot(),
+	m_uiDrawnModelCount(0),
+	m_uiCulledModelCount(0) {
 	if (!m_pFramework) {
 		return;
 	}
@@ -38,11 +51,12 @@ Application::Application() : m_uiBoidCount(50),
 	// Seed rand number generator.
 	srand(time(nullptr));
 	m_bFrameworkInitialised = m_pFramework->GetInitializationState();
-	TransformComponent* pTransform = new TransformComponent(m_pWorldCursor);
+	m_pWorldCursor = m_pScene->CreateEntity();
+	TransformComponent* pTransform = m_pScene->CreateComponent<TransformComponent>(m_pWorldCursor);
 	pTransform->SetMatrixRow(TransformComponent::MATRIX_ROW_POSITION_VECTOR,
 		m_pFramework->GetCamera()->Position + m_pFramework->GetCamera()->Front * m_fMarkerZOffset);
 	m_pWorldCursor->AddComponent(COMPONENT_TYPE_TRANSFORM, static_cast<Component*>(pTransform));
-	ModelComponent* pModel = new ModelComponent(m_pWorldCursor);
+	ModelComponent* pModel = m_pScene->CreateComponent<ModelComponent>(m_pWorldCursor);
 	pModel->LoadModel("Resources/Models/Low_poly_UFO/Low_poly_UFO.obj");
 	const float scaleScalar = 0.01f;
 	pModel->SetScale(glm::vec3(scaleScalar));
@@ -53,16 +67,45 @@ Application::Application() : m_uiBoidCount(50),
 }
 
 Application::~Application() {
+	// The simulation thread uses the scene, so it has to finish before anything is released.
+	m_bSimulating = false;
+
+	if (m_simulationThread.joinable()) {
+		m_simulationThread.join();
+	}
+
 	m_pFramework->Destory();
 	delete m_pFramework;
 	m_pFramework = nullptr;
 }
 
 void Application::Run() {
+	if (!mc_bThreadedSimulation) {
+		while (!CloseApplication()) {
+			Update();
+			Draw();
+		}
+
+		return;
+	}
+
+	// The scene is updated on its own thread, so drawing and waiting for the display never hold it up.
+	m_bSimulating = true;
+	m_simulationThread = std::thread(&Application::Simulate, this);
+
 	while (!CloseApplication()) {
-		Update();
+		m_pFramework->Update();
+
+		{
+			std::lock_guard<std::mutex> sceneLock(m_sceneMutex);
+			ProcessInput();
+		}
+
 		Draw();
 	}
+
+	m_bSimulating = false;
+	m_simulationThread.join();
 }
 
 bool Application::CloseApplication() const {
@@ -80,11 +123,61 @@ void Application::Update() {
 
 	m_pFramework->Update();
 	ProcessInput();
+	UpdateScene(m_pFramework->GetDeltaTime());
+}
 
-	if (!m_bPaused || m_bUpdateOnce) {
-		m_pScene->Update(m_pFramework->GetDeltaTime());
-		// Reset after updating the application once.
-		m_bUpdateOnce = false;
+void Application::UpdateScene(float a_fFrameTime) {
+	if (!m_bPaused) {
+		m_pScene->Update(a_fFrameTime);
+	} else if (m_bUpdateOnce) {
+		// Less than a step is ever left waiting, so adding one step's worth of time takes exactly one step.
+		m_pScene->Update(m_pScene->GetClock().GetStepDuration());
+	}
+
+	// Reset after updating the application once.
+	m_bUpdateOnce = false;
+}
+
+void Application::Simulate() {
+	typedef std::chrono::steady_clock Clock;
+	Clock::time_point lastUpdateTime = Clock::now();
+
+	while (m_bSimulating) {
+		const Clock::time_point updateTime = Clock::now();
+		const float frameTime = std::chrono::duration<float>(updateTime - lastUpdateTime).count();
+		lastUpdateTime = updateTime;
+		SceneSnapshot& rSnapshot = m_snapshots.GetWriteBuffer();
+		bool publishSnapshot = false;
+		float timeUntilStep = 0.0f;
+
+		{
+			std::lock_guard<std::mutex> sceneLock(m_sceneMutex);
+			const FixedTimestep& rClock = m_pScene->GetClock();
+			const unsigned int tickCount = rClock.GetTickCount();
+			UpdateScene(frameTime);
+			// A snapshot that's the same as the last one would stall the models' interpolation, but while paused
+			// there's no motion to interpolate and the user can still change the scene.
+			publishSnapshot = rClock.GetTickCount() != tickCount || m_bPaused;
+
+			if (publishSnapshot) {
+				m_pScene->WriteSnapshot(rSnapshot);
+			}
+
+			timeUntilStep = (1.0f - rClock.GetAlpha()) * rClock.GetStepDuration();
+		}
+
+		if (publishSnapshot) {
+			rSnapshot.SetTime(std::chrono::duration<double>(updateTime.time_since_epoch()).count());
+			// Each snapshot carries the step before it, so the main thread always moves models between the two newest
+			// steps however many snapshots it skips.
+			rSnapshot.SetPreviousStep(m_previousSnapshot);
+			m_previousSnapshot = rSnapshot;
+			m_snapshots.Publish();
+		}
+
+		// Nothing changes until the scene's next step is due, so the main thread has the scene's lock until then.
+		std::this_thread::sleep_until(updateTime + std::chrono::duration_cast<Clock::duration>(
+			std::chrono::duration<float>(timeUntilStep)));
 	}
 }
 
@@ -128,45 +221,73 @@ void Application::Draw() {
 		rgbColourValues,
 		alphaColourValue);
 	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-	// Draw scene entities.
-	m_pScene->Draw(m_pFramework);
-	// Draw UI overlay.
-	m_pUserInterface->Draw();
+	// Draw the scene entities that the camera can see.
+	Camera* pCamera = m_pFramework->GetCamera();
+	const Frustum viewFrustum(pCamera->GetProjectionMatrix(m_pFramework->GetScreenWidth(),
+		m_pFramework->GetScreenHeight()) * pCamera->GetViewMatrix());
+
+	if (mc_bThreadedSimulation) {
+		DrawSnapshots(viewFrustum);
+		// The user interface changes the scene, so the simulation thread has to wait for it.
+		std::lock_guard<std::mutex> sceneLock(m_sceneMutex);
+		m_pUserInterface->Draw();
+	} else {
+		m_pScene->Draw(m_pFramework, viewFrustum);
+		// Draw UI overlay.
+		m_pUserInterface->Draw();
+	}
+
 	glfwSwapBuffers(m_pFramework->GetWindow());
 	glfwPollEvents();
 }
 
+void Application::DrawSnapshots(const Frustum& a_rViewFrustum) {
+	m_snapshots.Acquire();
+	const SceneSnapshot& rSnapshot = m_snapshots.GetReadBuffer();
+	// Draws the scene one simulation step behind, moving from the previous step to the newest over the time that
+	// passed between them being taken.
+	const double stepDuration = rSnapshot.GetTime() - rSnapshot.GetPreviousTime();
+	const double timeSinceSnapshot = std::chrono::duration<double>(
+		std::chrono::steady_clock::now().time_since_epoch()).count() - rSnapshot.GetTime();
+	const float interpolation = stepDuration > 0.0 ?
+		glm::clamp(static_cast<float>(timeSinceSnapshot / stepDuration), 0.0f, 1.0f) :
+		1.0f;
+	m_uiDrawnModelCount = rSnapshot.Draw(m_pFramework,
+		interpolation,
+		m_pScene->GetFrustumCullingState() ? &a_rViewFrustum : nullptr);
+	m_uiCulledModelCount = rSnapshot.GetModelInstanceCount() - m_uiDrawnModelCount;
+}
+
 Entity* Application::CreateBoid() {
 	if (!m_pScene) {
 		return nullptr;
 	}
 
-	Entity* pBoid = new Entity();
+	Entity* pBoid = m_pScene->CreateEntity();
 	// Create transform
-	TransformComponent* pTransform = new TransformComponent(pBoid);
+	TransformComponent* pTransform = m_pScene->CreateComponent<TransformComponent>(pBoid);
 	// The absolute value for the maximum spawn distance.
-	const int absoluteXDistance = m_pScene->GetOctTree().GetBoundary().GetDimensions().x;
-	const int absoluteYDistance = m_pScene->GetOctTree().GetBoundary().GetDimensions().y;
-	const int absoluteZDistance = m_pScene->GetOctTree().GetBoundary().GetDimensions().z;
+	const int absoluteXDistance = m_pScene->GetSpatialIndex().GetArea().GetDimensions().x;
+	const int absoluteYDistance = m_pScene->GetSpatialIndex().GetArea().GetDimensions().y;
+	const int absoluteZDistance = m_pScene->GetSpatialIndex().GetArea().GetDimensions().z;
 	pTransform->SetMatrixRow(TransformComponent::MATRIX_ROW_POSITION_VECTOR,
 		glm::vec3(Utilities::RandomRange(-absoluteXDistance, absoluteXDistance),
 			Utilities::RandomRange(-absoluteYDistance, absoluteYDistance),
 			Utilities::RandomRange(-absoluteZDistance, absoluteZDistance)));
 	pBoid->AddComponent(COMPONENT_TYPE_TRANSFORM, static_cast<Component*>(pTransform));
 	// create model
-	ModelComponent* pModel = new ModelComponent(pBoid);
+	ModelComponent* pModel = m_pScene->CreateComponent<ModelComponent>(pBoid);
 	pModel->LoadModel("Resources/Models/Low_poly_UFO/Low_poly_UFO.obj");
 	const float scaleScalar = 0.01f;
 	pModel->SetScale(glm::vec3(scaleScalar));
 	pModel->SetOffset(glm::vec3(0.0f, -0.25f, 0.0f));
 	pBoid->AddComponent(COMPONENT_TYPE_MODEL, static_cast<Component*>(pModel));
 	// Create a collider for collisions.
-	ColliderComponent* pCollider = new ColliderComponent(pBoid,
-		&m_pScene->GetOctTree());
+	ColliderComponent* pCollider = m_pScene->CreateComponent<ColliderComponent>(pBoid);
 	pCollider->SetDimensions(glm::vec3(Utilities::Third, 0.15f, Utilities::Third));
 	pBoid->AddComponent(COMPONENT_TYPE_COLLIDER, pCollider);
 	// create brain i.e. AI controller
-	BrainComponent* pBrain = new BrainComponent(pBoid, m_pScene);
+	BrainComponent* pBrain = m_pScene->CreateComponent<BrainComponent>(pBoid, m_pScene);
 	pBoid->AddComponent(COMPONENT_TYPE_BRAIN, static_cast<Component*>(pBrain));
 	pBoid->SetTag("Boid");
 	return pBoid;
@@ -177,24 +298,25 @@ Entity* Application::CreateObstacle(glm::vec3 a_spawnPosition) {
 		return nullptr;
 	}
 
-	Entity* pObstacle = new Entity();
+	Entity* pObstacle = m_pScene->CreateEntity();
 	// Add a new transform component.
-	TransformComponent* obstaclesTransform = new TransformComponent(pObstacle);
+	TransformComponent* obstaclesTransform = m_pScene->CreateComponent<TransformComponent>(pObstacle);
 	obstaclesTransform->SetMatrixRow(TransformComponent::MATRIX_ROW_POSITION_VECTOR, a_spawnPosition);
 	pObstacle->AddComponent(COMPONENT_TYPE_TRANSFORM, static_cast<Component*>(obstaclesTransform));
 	// Create a model to visualise the obstacle.
-	ModelComponent* pModel = new ModelComponent(pObstacle);
+	ModelComponent* pModel = m_pScene->CreateComponent<ModelComponent>(pObstacle);
 	pModel->LoadModel("Resources/Models/Low_poly_UFO/Low_poly_UFO.obj");
 	const float scaleScalar = 0.01f;
 	pModel->SetScale(glm::vec3(scaleScalar));
 	pObstacle->AddComponent(COMPONENT_TYPE_MODEL, static_cast<Component*>(pModel));
-	ColliderComponent* pCollider = new ColliderComponent(pObstacle, &m_pScene->GetOctTree());
+	ColliderComponent* pCollider = m_pScene->CreateComponent<ColliderComponent>(pObstacle);
 	const float dimensionsScale = 2.0f;
 	pCollider->SetDimensions(dimensionsScale);
 	pObstacle->AddComponent(COMPONENT_TYPE_COLLIDER, pCollider);
 	pObstacle->SetTag("Obstacle");
 	m_pScene->AddEntity(pObstacle);
 	m_bSpawnedObstacle = true;
+	return pObstacle;
 }
 
 void Application::SetBoidCount(unsigned int a_uiBoidCount) {
@@ -216,3 +338,11 @@ void Application::SetPauseState(bool a_bPaused) {
 void Application::SetUpdateOnceState(bool a_bUpdateOnce) {
 	m_bUpdateOnce = a_bUpdateOnce;
 }
+
+unsigned int Application::GetDrawnEntityCount() const {
+	return mc_bThreadedSimulation ? m_uiDrawnModelCount : m_pScene->GetDrawnEntityCount();
+}
+
+unsigned int Application::GetCulledEntityCount() const {
+	return mc_bThreadedSimulation ? m_uiCulledModelCount : m_pScene->GetCulledEntityCount();
+}
@@ -0,0 +1,43 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+// File's header.
+#include "Archetype.h"
+
+Archetype::Archetype(ComponentSignature a_signature) : m_signature(a_signature),
+	m_entities(),
+	m_columns() {}
+
+unsigned int Archetype::AddEntity(Entity* a_pEntity) {
+	for (unsigned int i = 0; i < COMPONENT_TYPE_COUNT; ++i) {
+		const COMPONENT_TYPE componentType = static_cast<COMPONENT_TYPE>(i);
+
+		if (HasComponentType(componentType)) {
+			m_columns[i].push_back(a_pEntity->GetComponentOfType(componentType));
+		}
+	}
+
+	m_entities.push_back(a_pEntity);
+	return m_entities.size() - 1;
+}
+
+Entity* Archetype::RemoveEntity(unsigned int a_uiRow) {
+	if (a_uiRow >= m_entities.size()) {
+		return nullptr;
+	}
+
+	const unsigned int lastRow = m_entities.size() - 1;
+
+	for (std::vector<Component*>& rColumn : m_columns) {
+		if (!rColumn.empty()) {
+			rColumn[a_uiRow] = rColumn[lastRow];
+			rColumn.pop_back();
+		}
+	}
+
+	m_entities[a_uiRow] = m_entities[lastRow];
+	m_entities.pop_back();
+	return a_uiRow < lastRow ? m_entities[a_uiRow] : nullptr;
+}
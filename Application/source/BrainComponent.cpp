@@ -7,8 +7,7 @@
 #include "BrainComponent.h"
 #include "ColliderComponent.h"
 #include "Entity.h"
-#include "LearnOpenGL/shader.h"
-#include "OctTree.h"
+#include "SpatialIndex.h"
 #include "Scene.h"
 #include "TransformComponent.h"
 #include "Utilities.h"
@@ -18,6 +17,9 @@ float BrainComponent::ms_fSeparationForce = 0.4f;
 float BrainComponent::ms_fAlignmentForce = 0.2f;
 float BrainComponent::ms_fCohesionForce = 0.6f;
 float BrainComponent::ms_fWanderForce = 0.5f;
+BrainComponent::NEIGHBOURHOOD_TYPE BrainComponent::ms_neighbourhoodType = BrainComponent::NEIGHBOURHOOD_TYPE_METRIC;
+unsigned int BrainComponent::ms_uiTopologicalNeighbourCount = 7;
+float BrainComponent::ms_fPerceptionDistance = 24.0f;
 
 BrainComponent::BrainComponent(Entity* a_pOwner,
 	Scene* a_pScene) : Component(a_pOwner),
@@ -25,12 +27,14 @@ BrainComponent::BrainComponent(Entity* a_pOwner,
 	mc_fSpeed(1.0f),
 	mc_fMaximumVelocity(1.5f),
 	mc_fMaximumNeighbourDistance(8.0f),
-	m_fLastUpdate(0.0f),
 	m_currentMovementVelocity(0.0f),
 	m_newMovementVelocity(0.0f),
 	m_collisionSeparationVelocity(0.0f),
 	m_pScene(a_pScene),
-	m_pEntityCollider(static_cast<ColliderComponent*>(a_pOwner->GetComponentOfType(COMPONENT_TYPE_COLLIDER))) {
+	m_pEntityCollider(static_cast<ColliderComponent*>(a_pOwner->GetComponentOfType(COMPONENT_TYPE_COLLIDER))),
+	m_nearbyEntities(),
+	m_distantBoids(),
+	m_nearestEntities() {
 	m_componentType = COMPONENT_TYPE_BRAIN;
 }
 
@@ -41,19 +45,18 @@ BrainComponent::BrainComponent(Entity* a_pOwner,
 	mc_fMaximumVelocity(a_rBrainToCopy.mc_fMaximumVelocity),
 	mc_fMaximumNeighbourDistance(a_rBrainToCopy.mc_fMaximumNeighbourDistance),
 	m_uiNeighbourCount(a_rBrainToCopy.m_uiNeighbourCount),
-	m_fLastUpdate(a_rBrainToCopy.m_fLastUpdate),
 	m_currentMovementVelocity(a_rBrainToCopy.m_currentMovementVelocity),
 	m_newMovementVelocity(a_rBrainToCopy.m_newMovementVelocity),
 	m_collisionSeparationVelocity(a_rBrainToCopy.m_collisionSeparationVelocity),
 	m_pScene(a_pScene),
-	m_pEntityCollider(static_cast<ColliderComponent*>(a_pOwner->GetComponentOfType(COMPONENT_TYPE_COLLIDER))) {
+	m_pEntityCollider(static_cast<ColliderComponent*>(a_pOwner->GetComponentOfType(COMPONENT_TYPE_COLLIDER))),
+	m_nearbyEntities(),
+	m_distantBoids(),
+	m_nearestEntities() {
 	m_componentType = a_rBrainToCopy.m_componentType;
 }
 
 void BrainComponent::Update(float a_fDeltaTime) {
-	m_fLastUpdate += a_fDeltaTime;
-	const float updateStep = 0.15f;
-
 	// Get this components owner entity.
 	Entity* pOwnerEntity = GetEntity();
 
@@ -68,21 +71,9 @@ void BrainComponent::Update(float a_fDeltaTime) {
 	}
 
 	glm::vec3 currentPosition = (glm::vec3)pOwnerTransform->GetMatrixRow(TransformComponent::MATRIX_ROW_POSITION_VECTOR);
-	glm::vec3 forwardDirection = (glm::vec3)pOwnerTransform->GetMatrixRow(TransformComponent::MATRIX_ROW_FORWARD_VECTOR);
 
-	if (m_fLastUpdate >= updateStep) {
-		m_fLastUpdate = 0.0f;
-		pEntityVector nearbyEntities = GetNeighbouringEntities(currentPosition);
-		m_uiNeighbourCount = nearbyEntities.size();
-		// Calculate our boid's behaviour.
-		m_newMovementVelocity += CalculateNewMovementVelocity(currentPosition,
-			forwardDirection,
-			nearbyEntities);
-	}
-
-	// Check for any collisions.
+	// Check for any collisions. The scene has already added up the separation velocity from each contact.
 	if (m_pEntityCollider && m_pEntityCollider->IsColliding()) {
-		CalculateCollisionVelocity(currentPosition);
 		m_currentMovementVelocity = m_collisionSeparationVelocity;
 	} else {
 		if (glm::length(m_collisionSeparationVelocity) != 0) {
@@ -96,7 +87,7 @@ void BrainComponent::Update(float a_fDeltaTime) {
 	glm::vec3 nextPosition = currentPosition + m_currentMovementVelocity * a_fDeltaTime;
 
 	// Check if the entity will move outside the scene's bounds.
-	if (m_pScene && !m_pScene->GetOctTree().GetBoundary().Contains(nextPosition)) {
+	if (m_pScene && !m_pScene->GetSpatialIndex().GetArea().Contains(nextPosition)) {
 		// Reverse the boids movement directions.
 		m_currentMovementVelocity = -m_currentMovementVelocity;
 		m_newMovementVelocity = -m_newMovementVelocity;
@@ -106,12 +97,47 @@ void BrainComponent::Update(float a_fDeltaTime) {
 		glm::vec3(-mc_fMaximumVelocity, -mc_fMaximumVelocity, -mc_fMaximumVelocity),
 		glm::vec3(mc_fMaximumVelocity, mc_fMaximumVelocity, mc_fMaximumVelocity));
 	currentPosition += m_currentMovementVelocity * a_fDeltaTime;
+
+	// Boids are the only entities that move, so the scene's neighbour lists learn how far they've moved from here.
+	if (m_pScene) {
+		m_pScene->NotifyEntityMoved(pOwnerEntity, currentPosition);
+	}
+
 	// Update the entity's transform matrix.
 	UpdateMatrix(pOwnerTransform,
 		&currentPosition,
 		&m_currentMovementVelocity);
 }
 
+void BrainComponent::Reevaluate() {
+	Entity* pOwnerEntity = GetEntity();
+
+	if (!pOwnerEntity) {
+		return;
+	}
+
+	TransformComponent* pOwnerTransform = static_cast<TransformComponent*>(pOwnerEntity->GetComponentOfType(COMPONENT_TYPE_TRANSFORM));
+
+	if (!pOwnerTransform) {
+		return;
+	}
+
+	glm::vec3 currentPosition = (glm::vec3)pOwnerTransform->GetMatrixRow(TransformComponent::MATRIX_ROW_POSITION_VECTOR);
+	glm::vec3 forwardDirection = (glm::vec3)pOwnerTransform->GetMatrixRow(TransformComponent::MATRIX_ROW_FORWARD_VECTOR);
+	GetNeighbouringEntities(currentPosition, m_nearbyEntities, m_distantBoids);
+	m_uiNeighbourCount = m_nearbyEntities.size() + m_distantBoids.uiCount;
+	// Calculate our boid's behaviour.
+	m_newMovementVelocity += CalculateNewMovementVelocity(currentPosition,
+		forwardDirection,
+		m_nearbyEntities,
+		m_distantBoids);
+}
+
+Component* BrainComponent::Clone(Entity* a_pOwner,
+	Scene* a_pScene) {
+	return a_pScene->CreateComponent<BrainComponent>(a_pOwner, *this, a_pScene);
+}
+
 glm::vec3 BrainComponent::CalculateSeekVelocity(const glm::vec3& a_rTargetPosition,
 	const glm::vec3& a_rCurrentPosition) const {
 	glm::vec3 targetDirection(a_rTargetPosition - a_rCurrentPosition);
@@ -164,11 +190,12 @@ glm::vec3 BrainComponent::CalculateSeparationVelocity(glm::vec3 a_separationVelo
 }
 
 glm::vec3 BrainComponent::CalculateAlignmentVelocity(glm::vec3 a_alignmentVelocity,
-	glm::vec3 a_targetVector) const {
+	glm::vec3 a_targetVector,
+	unsigned int a_uiNeighbourCount) const {
 	a_alignmentVelocity += a_targetVector;
 
-	if (glm::length(a_alignmentVelocity) > 0.0f && m_uiNeighbourCount > 0) {
-		a_alignmentVelocity /= m_uiNeighbourCount;
+	if (glm::length(a_alignmentVelocity) > 0.0f && a_uiNeighbourCount > 0) {
+		a_alignmentVelocity /= a_uiNeighbourCount;
 		a_alignmentVelocity = glm::normalize(a_alignmentVelocity);
 	}
 
@@ -177,11 +204,12 @@ glm::vec3 BrainComponent::CalculateAlignmentVelocity(glm::vec3 a_alignmentVeloci
 
 glm::vec3 BrainComponent::CalculateCohesionVelocity(glm::vec3 a_cohesionVelocity,
 	glm::vec3 a_cohesionChange,
-	glm::vec3 a_currentPosition) const {
+	glm::vec3 a_currentPosition,
+	unsigned int a_uiNeighbourCount) const {
 	a_cohesionVelocity += a_cohesionChange;
 
-	if (glm::length(a_cohesionVelocity) > 0.0f && m_uiNeighbourCount > 0) {
-		a_cohesionVelocity /= m_uiNeighbourCount;
+	if (glm::length(a_cohesionVelocity) > 0.0f && a_uiNeighbourCount > 0) {
+		a_cohesionVelocity /= a_uiNeighbourCount;
 		a_cohesionVelocity = glm::normalize(a_cohesionVelocity - a_currentPosition);
 	}
 
@@ -190,7 +218,25 @@ glm::vec3 BrainComponent::CalculateCohesionVelocity(glm::vec3 a_cohesionVelocity
 
 glm::vec3 BrainComponent::CalculateNewMovementVelocity(glm::vec3& a_rCurrentPosition,
 	glm::vec3& a_rEntityForward,
-	pEntityVector nearbyEntities) const {
+	const pEntityVector& a_rNearbyEntities,
+	const OctTree<Entity, glm::vec3>::Aggregate& a_rDistantBoids) const {
+	// Get the component's owner entity.
+	const Entity* pOwnerEntity = GetEntity();
+
+	if (!pOwnerEntity) {
+		return glm::vec3(0);
+	}
+
+	glm::vec3 wanderVelocity = CalculateWanderVelocity(a_rEntityForward, a_rCurrentPosition) * ms_fWanderForce;
+	glm::vec3 changeInMovement(wanderVelocity + CalculateFlockingVelocity(a_rCurrentPosition,
+		a_rNearbyEntities,
+		a_rDistantBoids));
+	return changeInMovement;
+}
+
+glm::vec3 BrainComponent::CalculateFlockingVelocity(const glm::vec3& a_rCurrentPosition,
+	const pEntityVector& a_rNearbyEntities,
+	const OctTree<Entity, glm::vec3>::Aggregate& a_rDistantBoids) const {
 	// Get the component's owner entity.
 	const Entity* pOwnerEntity = GetEntity();
 
@@ -198,13 +244,18 @@ glm::vec3 BrainComponent::CalculateNewMovementVelocity(glm::vec3& a_rCurrentPosi
 		return glm::vec3(0);
 	}
 
+	if (m_pScene && m_pScene->GetCellAggregateState()) {
+		return CalculateAggregateFlockingVelocity(a_rCurrentPosition, a_rNearbyEntities, a_rDistantBoids);
+	}
+
+	const unsigned int neighbourCount = a_rNearbyEntities.size() + a_rDistantBoids.uiCount;
 	// Behavioural forces.
 	glm::vec3 seperationVelocity(0.0f);
 	glm::vec3 alignmentVelocity(0.0f);
 	glm::vec3 cohesionVelocity(0.0f);
 
 	// Loop over all of the nearvy entities in scene.
-	for (const Entity* entity : nearbyEntities) {
+	for (const Entity* entity : a_rNearbyEntities) {
 		if (!entity ||
 			// Check if an entity found itself.
 			entity->GetID() == pOwnerEntity->GetID() ||
@@ -224,49 +275,109 @@ glm::vec3 BrainComponent::CalculateNewMovementVelocity(glm::vec3& a_rCurrentPosi
 		seperationVelocity = CalculateSeparationVelocity(seperationVelocity,
 			// Creates a direction that points towards the other entity if they have different positions.
 			a_rCurrentPosition == nearbyEntityPosition ? GetRandomNearbyPoint(a_rCurrentPosition) - a_rCurrentPosition : -directionToNearbyEntity,
-			m_uiNeighbourCount);
+			neighbourCount);
 		alignmentVelocity = CalculateAlignmentVelocity(alignmentVelocity,
 			// Add the neighbouring boid's current velocity.
-			pNearbyBrain->GetVelocity());
+			pNearbyBrain->GetVelocity(),
+			neighbourCount);
 		cohesionVelocity = CalculateCohesionVelocity(cohesionVelocity,
 			directionToNearbyEntity,
-			a_rCurrentPosition);
+			a_rCurrentPosition,
+			neighbourCount);
 	}
 
-	seperationVelocity *= ms_fSeparationForce;
-	alignmentVelocity *= ms_fAlignmentForce;
-	cohesionVelocity *= ms_fCohesionForce;
-	glm::vec3 wanderVelocity = CalculateWanderVelocity(a_rEntityForward, a_rCurrentPosition) * ms_fWanderForce;
-	glm::vec3 changeInMovement(wanderVelocity + cohesionVelocity + alignmentVelocity + seperationVelocity);
-	return changeInMovement;
+	return seperationVelocity * ms_fSeparationForce +
+		alignmentVelocity * ms_fAlignmentForce +
+		cohesionVelocity * ms_fCohesionForce;
 }
 
-void BrainComponent::CalculateCollisionVelocity(const glm::vec3 a_entityPosition) {
-	for (std::vector<ColliderComponent*>::const_iterator iterator = m_pEntityCollider->GetCollisions().begin();
-		iterator != m_pEntityCollider->GetCollisions().end();
-		++iterator) {
-		Entity* pCollidingEntity = (*iterator)->GetEntity();
+unsigned int BrainComponent::AccumulateNeighbours(const glm::vec3& a_rCurrentPosition,
+	const pEntityVector& a_rNearbyEntities,
+	glm::vec3& a_rSeparationSum,
+	glm::vec3& a_rVelocitySum,
+	glm::vec3& a_rPositionSum) const {
+	const Entity* pOwnerEntity = GetEntity();
+	unsigned int nearbyBoidCount = 0;
 
-		if (!pCollidingEntity) {
-			return;
+	for (const Entity* entity : a_rNearbyEntities) {
+		if (!entity || !pOwnerEntity ||
+			// Check if an entity found itself.
+			entity->GetID() == pOwnerEntity->GetID() ||
+			entity->GetTag() != "Boid") {
+			continue;
 		}
 
-		TransformComponent* pCollidingEntityTransform = static_cast<TransformComponent*>(pCollidingEntity->GetComponentOfType(COMPONENT_TYPE_TRANSFORM));
+		const TransformComponent* pNearbyTransform = static_cast<TransformComponent*>(entity->GetComponentOfType(COMPONENT_TYPE_TRANSFORM));
+		const BrainComponent* pNearbyBrain = static_cast<BrainComponent*>(entity->GetComponentOfType(COMPONENT_TYPE_BRAIN));
 
-		if (!pCollidingEntityTransform) {
-			return;
+		if (!pNearbyTransform || !pNearbyBrain) {
+			continue;
 		}
 
-		glm::vec3 targetVector = (a_entityPosition == *pCollidingEntityTransform->GetPosition()) ?
-			// Get nearby point encase entities spawn on top of each other.
-			GetRandomNearbyPoint(a_entityPosition) - a_entityPosition :
-			// Normal collision avoidance behaviour.
-			a_entityPosition - *pCollidingEntityTransform->GetPosition();
-		// Calculate where to move towards.
-		m_collisionSeparationVelocity = CalculateSeparationVelocity(m_collisionSeparationVelocity,
-			targetVector,
-			m_pEntityCollider->GetCollisions().size());
+		const glm::vec3 nearbyEntityPosition = (const glm::vec3)pNearbyTransform->GetMatrixRow(TransformComponent::MATRIX_ROW_POSITION_VECTOR);
+		// Creates a direction that points away from the other entity if they have different positions.
+		a_rSeparationSum += a_rCurrentPosition == nearbyEntityPosition ?
+			GetRandomNearbyPoint(a_rCurrentPosition) - a_rCurrentPosition :
+			a_rCurrentPosition - nearbyEntityPosition;
+		// Add the neighbouring boid's current velocity.
+		a_rVelocitySum += pNearbyBrain->GetVelocity();
+		a_rPositionSum += nearbyEntityPosition;
+		++nearbyBoidCount;
+	}
+
+	return nearbyBoidCount;
+}
+
+glm::vec3 BrainComponent::CalculateAggregateFlockingVelocity(const glm::vec3& a_rCurrentPosition,
+	const pEntityVector& a_rNearbyEntities,
+	const OctTree<Entity, glm::vec3>::Aggregate& a_rDistantBoids) const {
+	// Every force is worked out from the sum of its neighbours' contributions, so that the distant boids' totals
+	// weigh as much as the boids they stand in for.
+	glm::vec3 separationSum(0.0f);
+	glm::vec3 velocitySum(a_rDistantBoids.valueSum);
+	glm::vec3 positionSum(a_rDistantBoids.positionSum);
+	const unsigned int nearbyBoidCount = AccumulateNeighbours(a_rCurrentPosition,
+		a_rNearbyEntities,
+		separationSum,
+		velocitySum,
+		positionSum);
+	const unsigned int boidCount = nearbyBoidCount + a_rDistantBoids.uiCount;
+
+	if (boidCount == 0) {
+		return glm::vec3(0.0f);
 	}
+
+	// Distant boids are only summed up by their centre, which says nothing about how close any one of them is, so
+	// they're left out of separation.
+	const glm::vec3 separationVelocity = CalculateSeparationVelocity(glm::vec3(0.0f), separationSum, nearbyBoidCount);
+	const glm::vec3 averageVelocity = velocitySum / static_cast<float>(boidCount);
+	const glm::vec3 directionToCentre = positionSum / static_cast<float>(boidCount) - a_rCurrentPosition;
+	const glm::vec3 alignmentVelocity = glm::length(averageVelocity) > 0.0f ?
+		glm::normalize(averageVelocity) :
+		averageVelocity;
+	const glm::vec3 cohesionVelocity = glm::length(directionToCentre) > 0.0f ?
+		glm::normalize(directionToCentre) :
+		directionToCentre;
+	return separationVelocity * ms_fSeparationForce +
+		alignmentVelocity * ms_fAlignmentForce +
+		cohesionVelocity * ms_fCohesionForce;
+}
+
+void BrainComponent::CalculateCollisionVelocity(const glm::vec3& a_rEntityPosition,
+	const glm::vec3& a_rCollidingEntityPosition) {
+	if (!m_pEntityCollider) {
+		return;
+	}
+
+	glm::vec3 targetVector = (a_rEntityPosition == a_rCollidingEntityPosition) ?
+		// Get nearby point encase entities spawn on top of each other.
+		GetRandomNearbyPoint(a_rEntityPosition) - a_rEntityPosition :
+		// Normal collision avoidance behaviour.
+		a_rEntityPosition - a_rCollidingEntityPosition;
+	// Calculate where to move towards.
+	m_collisionSeparationVelocity = CalculateSeparationVelocity(m_collisionSeparationVelocity,
+		targetVector,
+		m_pEntityCollider->GetContactCount());
 }
 
 void BrainComponent::UpdateMatrix(TransformComponent* a_pTransform,
@@ -300,12 +411,60 @@ void BrainComponent::UpdateMatrix(TransformComponent* a_pTransform,
 	a_pTransform->SetMatrixRow(TransformComponent::MATRIX_ROW_POSITION_VECTOR, *a_pPosition);
 }
 
-pEntityVector BrainComponent::GetNeighbouringEntities(glm::vec3 a_currentPosition) const {
-	pEntityVector nearbyEntities;
-	m_pScene->GetOctTree().Query(Boundary<glm::vec3>(a_currentPosition,
-		glm::vec3(mc_fMaximumNeighbourDistance)),
-		nearbyEntities);
-	return nearbyEntities;
+void BrainComponent::GetNeighbouringEntities(glm::vec3 a_currentPosition,
+	pEntityVector& a_rNearbyEntities,
+	OctTree<Entity, glm::vec3>::Aggregate& a_rDistantBoids) const {
+	a_rNearbyEntities.clear();
+	a_rDistantBoids.uiCount = 0;
+	a_rDistantBoids.positionSum = glm::vec3(0.0f);
+	a_rDistantBoids.valueSum = glm::vec3(0.0f);
+
+	if (ms_neighbourhoodType == NEIGHBOURHOOD_TYPE_TOPOLOGICAL) {
+		// One more entity is found to make room for the boid itself, which boids sharing its position can be found
+		// before, so it's looked for by its entity rather than assumed to be first.
+		const Entity* pOwnerEntity = GetEntity();
+		m_pScene->GetSpatialIndex().QueryNearest(a_currentPosition, ms_uiTopologicalNeighbourCount + 1, m_nearestEntities);
+
+		for (const SpatialIndex<Entity, glm::vec3>::NearestObject& rNearestEntity : m_nearestEntities) {
+			if (a_rNearbyEntities.size() == ms_uiTopologicalNeighbourCount) {
+				break;
+			}
+
+			if (rNearestEntity.pObject != pOwnerEntity) {
+				a_rNearbyEntities.push_back(rNearestEntity.pObject);
+			}
+		}
+
+		return;
+	}
+
+	const OctTree<Entity, glm::vec3>* pOctTree = m_pScene->GetCellAggregateState() ? m_pScene->GetOctTree() : nullptr;
+
+	if (pOctTree) {
+		// Nearby boids are found one by one, and areas of distant boids are added up from their totals.
+		pOctTree->QueryAggregates(BoundingBox<glm::vec3>(a_currentPosition, glm::vec3(ms_fPerceptionDistance)),
+			m_pScene->GetOpeningAngle(),
+			[&a_rNearbyEntities](Entity* a_pEntity) {
+				a_rNearbyEntities.push_back(a_pEntity);
+			},
+			[&a_rDistantBoids](const OctTree<Entity, glm::vec3>::Aggregate& a_rAggregate) {
+				a_rDistantBoids.uiCount += a_rAggregate.uiCount;
+				a_rDistantBoids.positionSum += a_rAggregate.positionSum;
+				a_rDistantBoids.valueSum += a_rAggregate.valueSum;
+			});
+		return;
+	}
+
+	const BoundingBox<glm::vec3> neighbourhood(a_currentPosition, glm::vec3(mc_fMaximumNeighbourDistance));
+	const Entity* pOwnerEntity = GetEntity();
+
+	// Falls back to querying the spatial index if the boid's list hasn't been built yet.
+	if (m_pScene->GetNeighbourListState() && pOwnerEntity &&
+		m_pScene->GetNeighbourList().GetNeighbours(pOwnerEntity->GetHandle().uiIndex, neighbourhood, a_rNearbyEntities)) {
+		return;
+	}
+
+	m_pScene->GetSpatialIndex().Query(neighbourhood, a_rNearbyEntities);
 }
 
 glm::vec3 BrainComponent::GetRandomNearbyPoint(glm::vec3 a_originPosition) const {
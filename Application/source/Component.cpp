@@ -8,4 +8,5 @@
 #include "Entity.h"
 
 Component::Component(Entity* a_pOwner) : m_pAttachedEntity(a_pOwner),
-	m_componentType(COMPONENT_TYPE_NONE) {}
+	m_componentType(COMPONENT_TYPE_NONE),
+	m_poolHandle() {}
@@ -0,0 +1,168 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+// File's header.
+#include "ContactCache.h"
+#include "StaggeredSchedule.h"
+#include <algorithm>
+
+ContactCache::ContactCache() : m_contacts(),
+	m_buckets(),
+	m_events(),
+	m_endedContacts(),
+	m_eventCounts(),
+	m_uiUpdateCount(0) {}
+
+void ContactCache::BeginUpdate() {
+	++m_uiUpdateCount;
+}
+
+void ContactCache::AddContact(PoolHandle a_firstEntity,
+	PoolHandle a_secondEntity) {
+	ContactKey key = { a_firstEntity, a_secondEntity };
+
+	// Entities in different slots are ordered by slot, so the same pair always gives the same key.
+	if (a_secondEntity.uiIndex < a_firstEntity.uiIndex) {
+		key.first = a_secondEntity;
+		key.second = a_firstEntity;
+	}
+
+	// Keeps at least half of the buckets empty, so the search for a contact stops at an empty bucket quickly.
+	if ((m_contacts.size() + 1) * 2 > m_buckets.size()) {
+		RebuildBuckets();
+	}
+
+	const unsigned int bucket = FindBucket(key);
+
+	if (m_buckets[bucket] != 0) {
+		m_contacts[m_buckets[bucket] - 1].uiLastUpdate = m_uiUpdateCount;
+		return;
+	}
+
+	const Contact contact = { key, m_uiUpdateCount, m_uiUpdateCount };
+	m_contacts.push_back(contact);
+	m_buckets[bucket] = m_contacts.size();
+}
+
+void ContactCache::EndUpdate(const StaggeredSchedule* a_pSchedule,
+	unsigned int a_uiTick) {
+	m_events.clear();
+	m_endedContacts.clear();
+
+	for (unsigned int& rEventCount : m_eventCounts) {
+		rEventCount = 0;
+	}
+
+	for (unsigned int i = 0; i < m_contacts.size(); ++i) {
+		const Contact& rContact = m_contacts[i];
+		ContactEvent event = { CONTACT_EVENT_TYPE_STAY, rContact.key.first, rContact.key.second };
+
+		if (rContact.uiLastUpdate != m_uiUpdateCount) {
+			// Neither entity was checked, so the contact wasn't looked for.
+			if (a_pSchedule &&
+				!a_pSchedule->IsDue(a_uiTick, rContact.key.first.uiIndex) &&
+				!a_pSchedule->IsDue(a_uiTick, rContact.key.second.uiIndex)) {
+				continue;
+			}
+
+			event.type = CONTACT_EVENT_TYPE_END;
+			m_endedContacts.push_back(i);
+		} else if (rContact.uiBeginUpdate == m_uiUpdateCount) {
+			event.type = CONTACT_EVENT_TYPE_BEGIN;
+		}
+
+		m_events.push_back(event);
+		++m_eventCounts[event.type];
+	}
+
+	// Removing the last contacts first means that the contact moved into each gap is always one that's staying.
+	for (unsigned int i = m_endedContacts.size(); i > 0; --i) {
+		RemoveContact(m_endedContacts[i - 1]);
+	}
+
+	// Gives back the buckets from a burst of contacts once they've mostly ended.
+	if (!m_endedContacts.empty() && (m_contacts.size() + 1) * 2 * msc_uiBucketShrinkRatio < m_buckets.size()) {
+		RebuildBuckets();
+	}
+}
+
+void ContactCache::Clear() {
+	m_events.clear();
+
+	for (unsigned int& rEventCount : m_eventCounts) {
+		rEventCount = 0;
+	}
+
+	for (const Contact& rContact : m_contacts) {
+		const ContactEvent event = { CONTACT_EVENT_TYPE_END, rContact.key.first, rContact.key.second };
+		m_events.push_back(event);
+	}
+
+	m_eventCounts[CONTACT_EVENT_TYPE_END] = m_events.size();
+	m_contacts.clear();
+	RebuildBuckets();
+}
+
+unsigned int ContactCache::FindBucket(const ContactKey& a_rKey) const {
+	// There are a power of two buckets, so a mask wraps the search around to the start.
+	const unsigned int bucketMask = m_buckets.size() - 1;
+	unsigned int bucket = GetHash(a_rKey) & bucketMask;
+
+	while (m_buckets[bucket] != 0 && !(m_contacts[m_buckets[bucket] - 1].key == a_rKey)) {
+		bucket = (bucket + 1) & bucketMask;
+	}
+
+	return bucket;
+}
+
+void ContactCache::RemoveContact(unsigned int a_uiContact) {
+	const unsigned int bucketMask = m_buckets.size() - 1;
+	unsigned int emptyBucket = FindBucket(m_contacts[a_uiContact].key);
+	unsigned int bucket = (emptyBucket + 1) & bucketMask;
+
+	// Each contact up to the next empty bucket moves back into the emptied bucket, unless that would put it before
+	// its own bucket.
+	while (m_buckets[bucket] != 0) {
+		const unsigned int homeBucket = GetHash(m_contacts[m_buckets[bucket] - 1].key) & bucketMask;
+
+		if (((bucket - homeBucket) & bucketMask) >= ((bucket - emptyBucket) & bucketMask)) {
+			m_buckets[emptyBucket] = m_buckets[bucket];
+			emptyBucket = bucket;
+		}
+
+		bucket = (bucket + 1) & bucketMask;
+	}
+
+	m_buckets[emptyBucket] = 0;
+	const unsigned int lastContact = m_contacts.size() - 1;
+
+	if (a_uiContact != lastContact) {
+		m_buckets[FindBucket(m_contacts[lastContact].key)] = a_uiContact + 1;
+		m_contacts[a_uiContact] = m_contacts[lastContact];
+	}
+
+	m_contacts.pop_back();
+}
+
+void ContactCache::RebuildBuckets() {
+	const unsigned int minimumBucketCount = 64;
+	unsigned int bucketCount = minimumBucketCount;
+
+	while (bucketCount < (m_contacts.size() + 1) * 2) {
+		bucketCount *= 2;
+	}
+
+	// Keeps the buckets from a burst of contacts only while they'd still be needed, as every bucket is emptied on
+	// each rebuild.
+	if (m_buckets.size() < bucketCount || m_buckets.size() > bucketCount * msc_uiBucketShrinkRatio) {
+		m_buckets.assign(bucketCount, 0);
+	} else {
+		std::fill(m_buckets.begin(), m_buckets.end(), 0);
+	}
+
+	for (unsigned int i = 0; i < m_contacts.size(); ++i) {
+		m_buckets[FindBucket(m_contacts[i].key)] = i + 1;
+	}
+}
@@ -5,17 +5,6 @@
 
 // File's header.
 #include "Entity.h"
-#include "BrainComponent.h"
-#include "ColliderComponent.h"
-#include "ModelComponent.h"
-#include "OctTree.h"
-#include "Scene.h"
-#include "TransformComponent.h"
-
-// Typedefs.
-typedef std::pair<const unsigned int, Entity*> EntityPair;
-typedef std::pair<COMPONENT_TYPE, Component*> ComponentPair;
-typedef std::vector<Component*> ComponentList;
 
 // Static variable initializations.
 unsigned int Entity::ms_uiEntityCount = 0;
@@ -23,76 +12,60 @@ bool Entity::ms_bCollisionsOn = true;
 
 // Increment the entity count with each new instance.
 Entity::Entity() : m_uiEntityID(ms_uiEntityCount++),
-m_tag("") {}
+m_handle(),
+m_tag(""),
+m_components(),
+m_signature(0) {}
 
 Entity::Entity(Entity& a_rEntityCopy,
-	Scene* a_pScene) {
+	Scene* a_pScene) : m_handle(),
+	m_components(),
+	m_signature(0) {
 	m_uiEntityID = ms_uiEntityCount++;
 	m_tag = a_rEntityCopy.m_tag;
 
-	// Go through each component.
-	for (ComponentPair component : a_rEntityCopy.m_components) {
-		COMPONENT_TYPE componentType = component.second->GetComponentType();
-
-		// Find the component type.
-		if (componentType == COMPONENT_TYPE_TRANSFORM) {
-			TransformComponent* pTransformComponent = new TransformComponent(this,
-				*static_cast<TransformComponent*>(a_rEntityCopy.GetComponentOfType(componentType)));
-			m_components.insert(std::pair<COMPONENT_TYPE, Component*>(componentType,
-				static_cast<Component*>(pTransformComponent)));
-		} else if (componentType == COMPONENT_TYPE_MODEL) {
-			ModelComponent* pModelComponent = new ModelComponent(this,
-				*static_cast<ModelComponent*>(a_rEntityCopy.GetComponentOfType(componentType)));
-			m_components.insert(std::pair<COMPONENT_TYPE, Component*>(componentType,
-				static_cast<Component*>(pModelComponent)));
-		} else if (componentType == COMPONENT_TYPE_BRAIN) {
-			BrainComponent* pBrainComponent = new BrainComponent(this,
-				*static_cast<BrainComponent*>(a_rEntityCopy.GetComponentOfType(componentType)),
-				a_pScene);
-			m_components.insert(std::pair<COMPONENT_TYPE, Component*>(componentType,
-				static_cast<Component*>(pBrainComponent)));
-		} else if (componentType == COMPONENT_TYPE_COLLIDER) {
-			ColliderComponent* pColliderComponent = new ColliderComponent(this,
-				&a_pScene->GetOctTree(),
-				*static_cast<ColliderComponent*>(a_rEntityCopy.GetComponentOfType(componentType)));
-			m_components.insert(std::pair<COMPONENT_TYPE, Component*>(componentType,
-				static_cast<Component*>(pColliderComponent)));
+	// Each component knows how to copy itself, so entities don't depend on every kind of component.
+	for (unsigned int i = 0; i < COMPONENT_TYPE_COUNT; ++i) {
+		if (a_rEntityCopy.m_components[i]) {
+			AddComponent(static_cast<COMPONENT_TYPE>(i), a_rEntityCopy.m_components[i]->Clone(this, a_pScene));
 		}
 	}
 }
 
-Entity::~Entity() {
-	m_components.clear();
-}
+Entity::~Entity() {}
 
 void Entity::Update(float a_fDeltaTime) {
-	std::map<COMPONENT_TYPE, Component*>::iterator componentIterator;
-
-	for (componentIterator = m_components.begin();
-		componentIterator != m_components.end();
-		++componentIterator) {
-		Component* pComponent = componentIterator->second;
-
+	for (Component* pComponent : m_components) {
 		if (pComponent) {
 			pComponent->Update(a_fDeltaTime);
 		}
 	}
 }
 
-void Entity::Draw(Framework* a_pRenderingFramework) {
-	std::map<COMPONENT_TYPE, Component*>::iterator componentIterator;
-
-	for (componentIterator = m_components.begin();
-		componentIterator != m_components.end();
-		++componentIterator) {
-		Component* pComponent = componentIterator->second;
+void Entity::Reevaluate() {
+	for (Component* pComponent : m_components) {
+		if (pComponent) {
+			pComponent->Reevaluate();
+		}
+	}
+}
 
+void Entity::Draw(Framework* a_pRenderingFramework) {
+	for (Component* pComponent : m_components) {
 		if (pComponent) {
 			pComponent->Draw(a_pRenderingFramework);
 		}
 	}
 }
 
+void Entity::WriteSnapshot(SceneSnapshot& a_rSnapshot) const {
+	for (const Component* pComponent : m_components) {
+		if (pComponent) {
+			pComponent->WriteSnapshot(a_rSnapshot);
+		}
+	}
+}
+
 void Entity::SetCollisionsState(bool a_bCollisionsOn) {
 	ms_bCollisionsOn = a_bCollisionsOn;
 }
@@ -0,0 +1,53 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+// File's header.
+#include "FixedTimestep.h"
+#include <cmath>
+
+FixedTimestep::FixedTimestep(float a_fTickRate,
+	unsigned int a_uiMaximumStepCount) : m_fTickRate(60.0f),
+	m_fStepDuration(1.0f / 60.0f),
+	m_fAccumulatedTime(0.0f),
+	m_uiMaximumStepCount(1),
+	m_uiFrameStepCount(0),
+	m_uiTickCount(0) {
+	SetTickRate(a_fTickRate);
+	SetMaximumStepCount(a_uiMaximumStepCount);
+}
+
+void FixedTimestep::Accumulate(float a_fFrameTime) {
+	m_fAccumulatedTime += a_fFrameTime > 0.0f ? a_fFrameTime : 0.0f;
+	m_uiFrameStepCount = 0;
+}
+
+bool FixedTimestep::Step() {
+	if (m_fAccumulatedTime < m_fStepDuration) {
+		return false;
+	}
+
+	if (m_uiFrameStepCount >= m_uiMaximumStepCount) {
+		// Keep the part of a step that's waiting so the alpha value stays smooth.
+		m_fAccumulatedTime = std::fmod(m_fAccumulatedTime, m_fStepDuration);
+		return false;
+	}
+
+	m_fAccumulatedTime -= m_fStepDuration;
+	++m_uiFrameStepCount;
+	++m_uiTickCount;
+	return true;
+}
+
+void FixedTimestep::SetTickRate(float a_fTickRate) {
+	if (a_fTickRate <= 0.0f || a_fTickRate == m_fTickRate) {
+		return;
+	}
+
+	// Keep the same fraction of a step waiting, so changing the rate doesn't cause a burst of steps.
+	const float alpha = GetAlpha();
+	m_fTickRate = a_fTickRate;
+	m_fStepDuration = 1.0f / a_fTickRate;
+	m_fAccumulatedTime = (alpha - std::floor(alpha)) * m_fStepDuration;
+}
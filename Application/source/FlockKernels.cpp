@@ -0,0 +1,442 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+// File's header.
+#include "FlockKernels.h"
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+#define FLOCK_KERNELS_X86
+#include <immintrin.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif // _MSC_VER
+#endif // x86
+
+// GCC and Clang only allow intrinsics in functions that are marked with their instruction set, whereas MSVC allows
+// them anywhere.
+#if defined(FLOCK_KERNELS_X86) && defined(__GNUC__)
+#define FLOCK_KERNELS_TARGET(instructionSet) __attribute__((target(instructionSet)))
+#else
+#define FLOCK_KERNELS_TARGET(instructionSet)
+#endif
+
+// The kernels read each boid's components straight out of the arrays of vectors.
+static_assert(sizeof(glm::vec3) == sizeof(float) * 3, "glm::vec3 must be three tightly packed floats.");
+
+namespace {
+#ifdef FLOCK_KERNELS_X86
+	/// <summary>
+	/// Fills an array with the registers returned by the cpuid instruction.
+	/// </summary>
+	void Cpuid(int a_iLeaf,
+		int a_iSubleaf,
+		unsigned int a_registers[4]) {
+#if defined(_MSC_VER)
+		int registers[4] = { 0 };
+		__cpuidex(registers, a_iLeaf, a_iSubleaf);
+
+		for (unsigned int i = 0; i < 4; ++i) {
+			a_registers[i] = static_cast<unsigned int>(registers[i]);
+		}
+#else
+		a_registers[0] = a_registers[1] = a_registers[2] = a_registers[3] = 0;
+		__get_cpuid_count(a_iLeaf, a_iSubleaf, &a_registers[0], &a_registers[1], &a_registers[2], &a_registers[3]);
+#endif // _MSC_VER
+	}
+
+	/// <summary>
+	/// Returns true if the operating system saves the AVX registers when it switches between threads.
+	/// </summary>
+	bool IsAvxStateSaved() {
+		unsigned int registers[4];
+		Cpuid(1, 0, registers);
+		const unsigned int osxsaveBit = 1u << 27;
+
+		if (!(registers[2] & osxsaveBit)) {
+			return false;
+		}
+
+#if defined(_MSC_VER)
+		const unsigned long long enabledState = _xgetbv(0);
+#else
+		unsigned int lowBits = 0;
+		unsigned int highBits = 0;
+		__asm__("xgetbv" : "=a"(lowBits), "=d"(highBits) : "c"(0));
+		const unsigned long long enabledState = (static_cast<unsigned long long>(highBits) << 32) | lowBits;
+#endif // _MSC_VER
+		// Both the SSE and AVX registers must be saved.
+		const unsigned long long avxState = 0x6;
+		return (enabledState & avxState) == avxState;
+	}
+
+	/// <summary>
+	/// Rearranges four vectors that are stored one after another into one register for each axis.
+	/// </summary>
+	FLOCK_KERNELS_TARGET("sse2")
+	inline void LoadVectors(const glm::vec3* a_pVectors,
+		__m128& a_rX,
+		__m128& a_rY,
+		__m128& a_rZ) {
+		const float* pFloats = &a_pVectors->x;
+		// x0 y0 z0 x1, y1 z1 x2 y2, z2 x3 y3 z3
+		const __m128 first = _mm_loadu_ps(pFloats);
+		const __m128 second = _mm_loadu_ps(pFloats + 4);
+		const __m128 third = _mm_loadu_ps(pFloats + 8);
+		// x2 y2 x3 y3
+		const __m128 lastXY = _mm_shuffle_ps(second, third, _MM_SHUFFLE(2, 1, 3, 2));
+		// y0 z0 y1 z1
+		const __m128 firstYZ = _mm_shuffle_ps(first, second, _MM_SHUFFLE(1, 0, 2, 1));
+		a_rX = _mm_shuffle_ps(first, lastXY, _MM_SHUFFLE(2, 0, 3, 0));
+		a_rY = _mm_shuffle_ps(firstYZ, lastXY, _MM_SHUFFLE(3, 1, 2, 0));
+		a_rZ = _mm_shuffle_ps(firstYZ, third, _MM_SHUFFLE(3, 0, 3, 1));
+	}
+
+	FLOCK_KERNELS_TARGET("sse2")
+	inline float Sum(__m128 a_values) {
+		float values[4];
+		_mm_storeu_ps(values, a_values);
+		return (values[0] + values[1]) + (values[2] + values[3]);
+	}
+
+	/// <summary>
+	/// Rearranges eight vectors that are stored one after another into one register for each axis.
+	/// </summary>
+	FLOCK_KERNELS_TARGET("avx2")
+	inline void LoadVectors(const glm::vec3* a_pVectors,
+		__m256& a_rX,
+		__m256& a_rY,
+		__m256& a_rZ) {
+		// Rearranging each half with SSE shuffles is quicker than gathering each axis.
+		__m128 lowX, lowY, lowZ;
+		__m128 highX, highY, highZ;
+		LoadVectors(a_pVectors, lowX, lowY, lowZ);
+		LoadVectors(a_pVectors + 4, highX, highY, highZ);
+		a_rX = _mm256_insertf128_ps(_mm256_castps128_ps256(lowX), highX, 1);
+		a_rY = _mm256_insertf128_ps(_mm256_castps128_ps256(lowY), highY, 1);
+		a_rZ = _mm256_insertf128_ps(_mm256_castps128_ps256(lowZ), highZ, 1);
+	}
+
+	FLOCK_KERNELS_TARGET("avx2")
+	inline float Sum(__m256 a_values) {
+		return Sum(_mm_add_ps(_mm256_castps256_ps128(a_values), _mm256_extractf128_ps(a_values, 1)));
+	}
+#endif // FLOCK_KERNELS_X86
+}
+
+unsigned int FlockKernels::AccumulateNeighbours(const Neighbourhood& a_rNeighbourhood,
+	const glm::vec3* a_pPositions,
+	const glm::vec3* a_pVelocities,
+	const glm::vec3* a_pDimensions,
+	unsigned int a_uiFirstBoid,
+	unsigned int a_uiLastBoid,
+	glm::vec3& a_rAlignmentVelocity,
+	glm::vec3& a_rCohesionVelocity,
+	unsigned int* a_pTouchingBoids) {
+	// The processor can't change, so the kernel only needs to be picked once.
+	static const Kernel kernel = GetKernel(GetInstructionSet());
+	return kernel(a_rNeighbourhood,
+		a_pPositions,
+		a_pVelocities,
+		a_pDimensions,
+		a_uiFirstBoid,
+		a_uiLastBoid,
+		a_rAlignmentVelocity,
+		a_rCohesionVelocity,
+		a_pTouchingBoids);
+}
+
+unsigned int FlockKernels::AccumulateNeighbours(INSTRUCTION_SET a_instructionSet,
+	const Neighbourhood& a_rNeighbourhood,
+	const glm::vec3* a_pPositions,
+	const glm::vec3* a_pVelocities,
+	const glm::vec3* a_pDimensions,
+	unsigned int a_uiFirstBoid,
+	unsigned int a_uiLastBoid,
+	glm::vec3& a_rAlignmentVelocity,
+	glm::vec3& a_rCohesionVelocity,
+	unsigned int* a_pTouchingBoids) {
+	return GetKernel(a_instructionSet)(a_rNeighbourhood,
+		a_pPositions,
+		a_pVelocities,
+		a_pDimensions,
+		a_uiFirstBoid,
+		a_uiLastBoid,
+		a_rAlignmentVelocity,
+		a_rCohesionVelocity,
+		a_pTouchingBoids);
+}
+
+bool FlockKernels::IsSupported(INSTRUCTION_SET a_instructionSet) {
+	if (a_instructionSet == INSTRUCTION_SET_SCALAR) {
+		return true;
+	}
+
+#ifdef FLOCK_KERNELS_X86
+	unsigned int registers[4];
+	Cpuid(0, 0, registers);
+	const unsigned int highestLeaf = registers[0];
+
+	if (a_instructionSet == INSTRUCTION_SET_SSE2) {
+		Cpuid(1, 0, registers);
+		const unsigned int sse2Bit = 1u << 26;
+		return (registers[3] & sse2Bit) != 0;
+	} else if (a_instructionSet == INSTRUCTION_SET_AVX2) {
+		if (highestLeaf < 7 || !IsAvxStateSaved()) {
+			return false;
+		}
+
+		Cpuid(7, 0, registers);
+		const unsigned int avx2Bit = 1u << 5;
+		return (registers[1] & avx2Bit) != 0;
+	}
+#endif // FLOCK_KERNELS_X86
+
+	return false;
+}
+
+FlockKernels::INSTRUCTION_SET FlockKernels::GetInstructionSet() {
+	static const INSTRUCTION_SET instructionSet = IsSupported(INSTRUCTION_SET_AVX2) ? INSTRUCTION_SET_AVX2 :
+		(IsSupported(INSTRUCTION_SET_SSE2) ? INSTRUCTION_SET_SSE2 : INSTRUCTION_SET_SCALAR);
+	return instructionSet;
+}
+
+const char* FlockKernels::GetInstructionSetName(INSTRUCTION_SET a_instructionSet) {
+	if (a_instructionSet == INSTRUCTION_SET_SSE2) {
+		return "SSE2";
+	} else if (a_instructionSet == INSTRUCTION_SET_AVX2) {
+		return "AVX2";
+	}
+
+	return "Scalar";
+}
+
+FlockKernels::Kernel FlockKernels::GetKernel(INSTRUCTION_SET a_instructionSet) {
+	if (a_instructionSet == INSTRUCTION_SET_SSE2) {
+		return &AccumulateNeighboursSse2;
+	} else if (a_instructionSet == INSTRUCTION_SET_AVX2) {
+		return &AccumulateNeighboursAvx2;
+	}
+
+	return &AccumulateNeighboursScalar;
+}
+
+unsigned int FlockKernels::AccumulateNeighboursScalar(const Neighbourhood& a_rNeighbourhood,
+	const glm::vec3* a_pPositions,
+	const glm::vec3* a_pVelocities,
+	const glm::vec3* a_pDimensions,
+	unsigned int a_uiFirstBoid,
+	unsigned int a_uiLastBoid,
+	glm::vec3& a_rAlignmentVelocity,
+	glm::vec3& a_rCohesionVelocity,
+	unsigned int* a_pTouchingBoids) {
+	unsigned int touchingCount = 0;
+
+	for (unsigned int i = a_uiFirstBoid; i < a_uiLastBoid; ++i) {
+		const glm::vec3 directionToNeighbour = a_pPositions[i] - a_rNeighbourhood.position;
+		const glm::vec3 distance = glm::abs(directionToNeighbour);
+		// The same test as overlapping the neighbourhood with the other boid's bounds.
+		const glm::vec3 reach = a_rNeighbourhood.dimensions + a_pDimensions[i];
+		// Around half of the boids that are checked are neighbours, which is too unpredictable to branch on, so every
+		// boid's contribution is added after being scaled by one if it's a neighbour or zero if not.
+		const bool isNeighbour = (distance.x <= reach.x) &
+			(distance.y <= reach.y) &
+			(distance.z <= reach.z) &
+			(i != a_rNeighbourhood.uiBoid);
+		const float neighbourScale = static_cast<float>(isNeighbour);
+		a_rAlignmentVelocity += a_pVelocities[i] * neighbourScale;
+		a_rCohesionVelocity += directionToNeighbour * neighbourScale;
+		const bool isTouching = isNeighbour &
+			(distance.x <= a_rNeighbourhood.boidDimensions.x + a_pDimensions[i].x) &
+			(distance.y <= a_rNeighbourhood.boidDimensions.y + a_pDimensions[i].y) &
+			(distance.z <= a_rNeighbourhood.boidDimensions.z + a_pDimensions[i].z);
+		a_pTouchingBoids[touchingCount] = i;
+		touchingCount += isTouching;
+	}
+
+	return touchingCount;
+}
+
+FLOCK_KERNELS_TARGET("sse2")
+unsigned int FlockKernels::AccumulateNeighboursSse2(const Neighbourhood& a_rNeighbourhood,
+	const glm::vec3* a_pPositions,
+	const glm::vec3* a_pVelocities,
+	const glm::vec3* a_pDimensions,
+	unsigned int a_uiFirstBoid,
+	unsigned int a_uiLastBoid,
+	glm::vec3& a_rAlignmentVelocity,
+	glm::vec3& a_rCohesionVelocity,
+	unsigned int* a_pTouchingBoids) {
+	unsigned int i = a_uiFirstBoid;
+	unsigned int touchingCount = 0;
+#ifdef FLOCK_KERNELS_X86
+	const unsigned int width = 4;
+	const __m128 positionX = _mm_set1_ps(a_rNeighbourhood.position.x);
+	const __m128 positionY = _mm_set1_ps(a_rNeighbourhood.position.y);
+	const __m128 positionZ = _mm_set1_ps(a_rNeighbourhood.position.z);
+	const __m128 neighbourhoodX = _mm_set1_ps(a_rNeighbourhood.dimensions.x);
+	const __m128 neighbourhoodY = _mm_set1_ps(a_rNeighbourhood.dimensions.y);
+	const __m128 neighbourhoodZ = _mm_set1_ps(a_rNeighbourhood.dimensions.z);
+	const __m128 boidX = _mm_set1_ps(a_rNeighbourhood.boidDimensions.x);
+	const __m128 boidY = _mm_set1_ps(a_rNeighbourhood.boidDimensions.y);
+	const __m128 boidZ = _mm_set1_ps(a_rNeighbourhood.boidDimensions.z);
+	// Clearing the sign bit gives the absolute value.
+	const __m128 absoluteMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+	const __m128i boid = _mm_set1_epi32(static_cast<int>(a_rNeighbourhood.uiBoid));
+	const __m128i laneOffsets = _mm_setr_epi32(0, 1, 2, 3);
+	__m128 alignmentX = _mm_setzero_ps();
+	__m128 alignmentY = _mm_setzero_ps();
+	__m128 alignmentZ = _mm_setzero_ps();
+	__m128 cohesionX = _mm_setzero_ps();
+	__m128 cohesionY = _mm_setzero_ps();
+	__m128 cohesionZ = _mm_setzero_ps();
+
+	for (; i + width <= a_uiLastBoid; i += width) {
+		__m128 neighbourX, neighbourY, neighbourZ;
+		__m128 velocityX, velocityY, velocityZ;
+		__m128 dimensionsX, dimensionsY, dimensionsZ;
+		LoadVectors(a_pPositions + i, neighbourX, neighbourY, neighbourZ);
+		LoadVectors(a_pVelocities + i, velocityX, velocityY, velocityZ);
+		LoadVectors(a_pDimensions + i, dimensionsX, dimensionsY, dimensionsZ);
+		const __m128 directionX = _mm_sub_ps(neighbourX, positionX);
+		const __m128 directionY = _mm_sub_ps(neighbourY, positionY);
+		const __m128 directionZ = _mm_sub_ps(neighbourZ, positionZ);
+		const __m128 distanceX = _mm_and_ps(directionX, absoluteMask);
+		const __m128 distanceY = _mm_and_ps(directionY, absoluteMask);
+		const __m128 distanceZ = _mm_and_ps(directionZ, absoluteMask);
+		const __m128i indices = _mm_add_epi32(_mm_set1_epi32(static_cast<int>(i)), laneOffsets);
+		const __m128 isSelf = _mm_castsi128_ps(_mm_cmpeq_epi32(indices, boid));
+		const __m128 isNeighbour = _mm_andnot_ps(isSelf,
+			_mm_and_ps(_mm_cmple_ps(distanceX, _mm_add_ps(neighbourhoodX, dimensionsX)),
+				_mm_and_ps(_mm_cmple_ps(distanceY, _mm_add_ps(neighbourhoodY, dimensionsY)),
+					_mm_cmple_ps(distanceZ, _mm_add_ps(neighbourhoodZ, dimensionsZ)))));
+		alignmentX = _mm_add_ps(alignmentX, _mm_and_ps(velocityX, isNeighbour));
+		alignmentY = _mm_add_ps(alignmentY, _mm_and_ps(velocityY, isNeighbour));
+		alignmentZ = _mm_add_ps(alignmentZ, _mm_and_ps(velocityZ, isNeighbour));
+		cohesionX = _mm_add_ps(cohesionX, _mm_and_ps(directionX, isNeighbour));
+		cohesionY = _mm_add_ps(cohesionY, _mm_and_ps(directionY, isNeighbour));
+		cohesionZ = _mm_add_ps(cohesionZ, _mm_and_ps(directionZ, isNeighbour));
+		const __m128 isTouching = _mm_and_ps(isNeighbour,
+			_mm_and_ps(_mm_cmple_ps(distanceX, _mm_add_ps(boidX, dimensionsX)),
+				_mm_and_ps(_mm_cmple_ps(distanceY, _mm_add_ps(boidY, dimensionsY)),
+					_mm_cmple_ps(distanceZ, _mm_add_ps(boidZ, dimensionsZ)))));
+		const int touchingLanes = _mm_movemask_ps(isTouching);
+
+		// Boids rarely touch, so the lanes are only checked when one of them does.
+		if (touchingLanes != 0) {
+			for (unsigned int lane = 0; lane < width; ++lane) {
+				if (touchingLanes & (1 << lane)) {
+					a_pTouchingBoids[touchingCount++] = i + lane;
+				}
+			}
+		}
+	}
+
+	a_rAlignmentVelocity += glm::vec3(Sum(alignmentX), Sum(alignmentY), Sum(alignmentZ));
+	a_rCohesionVelocity += glm::vec3(Sum(cohesionX), Sum(cohesionY), Sum(cohesionZ));
+#endif // FLOCK_KERNELS_X86
+	// Any boids that don't fill a whole register are checked one at a time.
+	return touchingCount + AccumulateNeighboursScalar(a_rNeighbourhood,
+		a_pPositions,
+		a_pVelocities,
+		a_pDimensions,
+		i,
+		a_uiLastBoid,
+		a_rAlignmentVelocity,
+		a_rCohesionVelocity,
+		a_pTouchingBoids + touchingCount);
+}
+
+FLOCK_KERNELS_TARGET("avx2")
+unsigned int FlockKernels::AccumulateNeighboursAvx2(const Neighbourhood& a_rNeighbourhood,
+	const glm::vec3* a_pPositions,
+	const glm::vec3* a_pVelocities,
+	const glm::vec3* a_pDimensions,
+	unsigned int a_uiFirstBoid,
+	unsigned int a_uiLastBoid,
+	glm::vec3& a_rAlignmentVelocity,
+	glm::vec3& a_rCohesionVelocity,
+	unsigned int* a_pTouchingBoids) {
+	unsigned int i = a_uiFirstBoid;
+	unsigned int touchingCount = 0;
+#ifdef FLOCK_KERNELS_X86
+	const unsigned int width = 8;
+	const __m256 positionX = _mm256_set1_ps(a_rNeighbourhood.position.x);
+	const __m256 positionY = _mm256_set1_ps(a_rNeighbourhood.position.y);
+	const __m256 positionZ = _mm256_set1_ps(a_rNeighbourhood.position.z);
+	const __m256 neighbourhoodX = _mm256_set1_ps(a_rNeighbourhood.dimensions.x);
+	const __m256 neighbourhoodY = _mm256_set1_ps(a_rNeighbourhood.dimensions.y);
+	const __m256 neighbourhoodZ = _mm256_set1_ps(a_rNeighbourhood.dimensions.z);
+	const __m256 boidX = _mm256_set1_ps(a_rNeighbourhood.boidDimensions.x);
+	const __m256 boidY = _mm256_set1_ps(a_rNeighbourhood.boidDimensions.y);
+	const __m256 boidZ = _mm256_set1_ps(a_rNeighbourhood.boidDimensions.z);
+	// Clearing the sign bit gives the absolute value.
+	const __m256 absoluteMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+	const __m256i boid = _mm256_set1_epi32(static_cast<int>(a_rNeighbourhood.uiBoid));
+	const __m256i laneOffsets = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+	__m256 alignmentX = _mm256_setzero_ps();
+	__m256 alignmentY = _mm256_setzero_ps();
+	__m256 alignmentZ = _mm256_setzero_ps();
+	__m256 cohesionX = _mm256_setzero_ps();
+	__m256 cohesionY = _mm256_setzero_ps();
+	__m256 cohesionZ = _mm256_setzero_ps();
+
+	for (; i + width <= a_uiLastBoid; i += width) {
+		__m256 neighbourX, neighbourY, neighbourZ;
+		__m256 velocityX, velocityY, velocityZ;
+		__m256 dimensionsX, dimensionsY, dimensionsZ;
+		LoadVectors(a_pPositions + i, neighbourX, neighbourY, neighbourZ);
+		LoadVectors(a_pVelocities + i, velocityX, velocityY, velocityZ);
+		LoadVectors(a_pDimensions + i, dimensionsX, dimensionsY, dimensionsZ);
+		const __m256 directionX = _mm256_sub_ps(neighbourX, positionX);
+		const __m256 directionY = _mm256_sub_ps(neighbourY, positionY);
+		const __m256 directionZ = _mm256_sub_ps(neighbourZ, positionZ);
+		const __m256 distanceX = _mm256_and_ps(directionX, absoluteMask);
+		const __m256 distanceY = _mm256_and_ps(directionY, absoluteMask);
+		const __m256 distanceZ = _mm256_and_ps(directionZ, absoluteMask);
+		const __m256i indices = _mm256_add_epi32(_mm256_set1_epi32(static_cast<int>(i)), laneOffsets);
+		const __m256 isSelf = _mm256_castsi256_ps(_mm256_cmpeq_epi32(indices, boid));
+		const __m256 isNeighbour = _mm256_andnot_ps(isSelf,
+			_mm256_and_ps(_mm256_cmp_ps(distanceX, _mm256_add_ps(neighbourhoodX, dimensionsX), _CMP_LE_OQ),
+				_mm256_and_ps(_mm256_cmp_ps(distanceY, _mm256_add_ps(neighbourhoodY, dimensionsY), _CMP_LE_OQ),
+					_mm256_cmp_ps(distanceZ, _mm256_add_ps(neighbourhoodZ, dimensionsZ), _CMP_LE_OQ))));
+		alignmentX = _mm256_add_ps(alignmentX, _mm256_and_ps(velocityX, isNeighbour));
+		alignmentY = _mm256_add_ps(alignmentY, _mm256_and_ps(velocityY, isNeighbour));
+		alignmentZ = _mm256_add_ps(alignmentZ, _mm256_and_ps(velocityZ, isNeighbour));
+		cohesionX = _mm256_add_ps(cohesionX, _mm256_and_ps(directionX, isNeighbour));
+		cohesionY = _mm256_add_ps(cohesionY, _mm256_and_ps(directionY, isNeighbour));
+		cohesionZ = _mm256_add_ps(cohesionZ, _mm256_and_ps(directionZ, isNeighbour));
+		const __m256 isTouching = _mm256_and_ps(isNeighbour,
+			_mm256_and_ps(_mm256_cmp_ps(distanceX, _mm256_add_ps(boidX, dimensionsX), _CMP_LE_OQ),
+				_mm256_and_ps(_mm256_cmp_ps(distanceY, _mm256_add_ps(boidY, dimensionsY), _CMP_LE_OQ),
+					_mm256_cmp_ps(distanceZ, _mm256_add_ps(boidZ, dimensionsZ), _CMP_LE_OQ))));
+		const int touchingLanes = _mm256_movemask_ps(isTouching);
+
+		// Boids rarely touch, so the lanes are only checked when one of them does.
+		if (touchingLanes != 0) {
+			for (unsigned int lane = 0; lane < width; ++lane) {
+				if (touchingLanes & (1 << lane)) {
+					a_pTouchingBoids[touchingCount++] = i + lane;
+				}
+			}
+		}
+	}
+
+	a_rAlignmentVelocity += glm::vec3(Sum(alignmentX), Sum(alignmentY), Sum(alignmentZ));
+	a_rCohesionVelocity += glm::vec3(Sum(cohesionX), Sum(cohesionY), Sum(cohesionZ));
+#endif // FLOCK_KERNELS_X86
+	// Any boids that don't fill a whole register are checked one at a time.
+	return touchingCount + AccumulateNeighboursScalar(a_rNeighbourhood,
+		a_pPositions,
+		a_pVelocities,
+		a_pDimensions,
+		i,
+		a_uiLastBoid,
+		a_rAlignmentVelocity,
+		a_rCohesionVelocity,
+		a_pTouchingBoids + touchingCount);
+}
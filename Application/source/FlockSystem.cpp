@@ -0,0 +1,408 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+// File's header.
+#include "FlockSystem.h"
+#include "FlockKernels.h"
+#include "glm/ext.hpp"
+#include <algorithm>
+#include "StaggeredSchedule.h"
+
+namespace {
+	/// <summary>
+	/// Reorders a collection of boid properties.
+	/// </summary>
+	/// <param name="a_rValues"> The properties to reorder. </param>
+	/// <param name="a_rSortedOrder"> The current index of the property that belongs at each position. </param>
+	/// <param name="a_rWorkingSpace"> Memory that's swapped with the properties, so that it can be reused. </param>
+	template <typename T>
+	void Reorder(std::vector<T>& a_rValues,
+		const std::vector<unsigned int>& a_rSortedOrder,
+		std::vector<T>& a_rWorkingSpace) {
+		a_rWorkingSpace.resize(a_rValues.size());
+
+		for (unsigned int i = 0; i < a_rSortedOrder.size(); ++i) {
+			a_rWorkingSpace[i] = a_rValues[a_rSortedOrder[i]];
+		}
+
+		a_rValues.swap(a_rWorkingSpace);
+	}
+}
+
+FlockSystem::FlockSystem(const BoundingBox<glm::vec3>& a_rArea,
+	float a_fNeighbourDistance,
+	unsigned int a_uiSeed,
+	unsigned int a_uiThreadCount) : m_fSeparationForce(0.4f),
+	m_fAlignmentForce(0.2f),
+	m_fCohesionForce(0.6f),
+	m_fWanderForce(0.5f),
+	m_bCollisionsOn(true),
+	m_uiSeed(a_uiSeed),
+	m_uiAddedBoidCount(0),
+	mc_fSpeed(1.0f),
+	mc_fMaximumVelocity(1.5f),
+	mc_fMaximumNeighbourDistance(a_fNeighbourDistance > 0.0f ? a_fNeighbourDistance : 1.0f),
+	m_area(a_rArea),
+	m_cellCounts(1),
+	m_boidDimensions(0.0f),
+	m_positions(),
+	m_velocities(),
+	m_nextPositions(),
+	m_nextVelocities(),
+	m_steeringVelocities(),
+	m_collisionVelocities(),
+	m_dimensions(),
+	m_colliding(),
+	m_randomStates(),
+	m_phases(),
+	m_entities(),
+	m_boidIDs(),
+	m_boidIndices(),
+	m_freeBoidIDs(),
+	m_boidCells(),
+	m_cellStarts(),
+	m_sortedOrder(),
+	m_sortingVectors(),
+	m_sortingBytes(),
+	m_sortingIntegers(),
+	m_sortingEntities(),
+	m_threadPool(a_uiThreadCount) {
+	m_cellCounts = glm::max(glm::ivec3(glm::ceil(m_area.GetDimensions() * 2.0f / mc_fMaximumNeighbourDistance)),
+		glm::ivec3(1));
+	m_cellStarts.assign(m_cellCounts.x * m_cellCounts.y * m_cellCounts.z + 1, 0);
+}
+
+void FlockSystem::Update(float a_fDeltaTime,
+	const std::vector<BoundingBox<glm::vec3>>& a_rObstacles,
+	const StaggeredSchedule* a_pSteeringSchedule,
+	unsigned int a_uiTick) {
+	SortBoids();
+	SteerBoids(a_rObstacles, a_pSteeringSchedule, a_uiTick);
+	MoveBoids(a_fDeltaTime);
+}
+
+void FlockSystem::SteerBoids(const std::vector<BoundingBox<glm::vec3>>& a_rObstacles,
+	const StaggeredSchedule* a_pSteeringSchedule,
+	unsigned int a_uiTick) {
+	if (m_positions.empty() || !a_pSteeringSchedule) {
+		return;
+	}
+
+	m_threadPool.ParallelFor(m_positions.size(), [this, &a_rObstacles, a_pSteeringSchedule, a_uiTick](
+		unsigned int a_uiBegin,
+		unsigned int a_uiEnd) {
+		for (unsigned int i = a_uiBegin; i < a_uiEnd; ++i) {
+			if (a_pSteeringSchedule->IsDue(a_uiTick, m_phases[i])) {
+				SteerBoid(i, a_rObstacles);
+			}
+		}
+	});
+}
+
+void FlockSystem::MoveBoids(float a_fDeltaTime) {
+	if (m_positions.empty()) {
+		return;
+	}
+
+	m_nextPositions.resize(m_positions.size());
+	m_nextVelocities.resize(m_velocities.size());
+	m_threadPool.ParallelFor(m_positions.size(), [this, a_fDeltaTime](unsigned int a_uiBegin,
+		unsigned int a_uiEnd) {
+		for (unsigned int i = a_uiBegin; i < a_uiEnd; ++i) {
+			MoveBoid(i, a_fDeltaTime);
+		}
+	});
+	// Every boid has been updated, so the next frame's state becomes the current state.
+	m_positions.swap(m_nextPositions);
+	m_velocities.swap(m_nextVelocities);
+}
+
+unsigned int FlockSystem::AddBoid(Entity* a_pEntity,
+	glm::vec3 a_position,
+	glm::vec3 a_velocity,
+	glm::vec3 a_dimensions) {
+	m_positions.push_back(a_position);
+	m_velocities.push_back(a_velocity);
+	m_steeringVelocities.push_back(a_velocity);
+	m_collisionVelocities.push_back(glm::vec3(0.0f));
+	m_dimensions.push_back(a_dimensions);
+	m_colliding.push_back(0);
+	m_phases.push_back(m_uiAddedBoidCount);
+	// Mix the boid's number into the seed so that boids added one after another don't get similar random numbers.
+	unsigned int randomState = m_uiSeed ^ (m_uiAddedBoidCount++ * 0x9e3779b9u);
+	randomState = (randomState ^ (randomState >> 16)) * 0x85ebca6bu;
+	randomState = (randomState ^ (randomState >> 13)) * 0xc2b2ae35u;
+	randomState ^= randomState >> 16;
+	// A xorshift generator never leaves a zero state.
+	m_randomStates.push_back(randomState != 0 ? randomState : 1);
+	m_entities.push_back(a_pEntity);
+	m_boidDimensions = glm::max(m_boidDimensions, a_dimensions);
+	unsigned int boidID = m_boidIndices.size();
+
+	if (!m_freeBoidIDs.empty()) {
+		boidID = m_freeBoidIDs.back();
+		m_freeBoidIDs.pop_back();
+	} else {
+		m_boidIndices.resize(boidID + 1);
+	}
+
+	m_boidIndices[boidID] = m_boidIDs.size();
+	m_boidIDs.push_back(boidID);
+	return boidID;
+}
+
+bool FlockSystem::RemoveBoid(unsigned int a_uiBoidID) {
+	if (a_uiBoidID >= m_boidIndices.size() || m_boidIndices[a_uiBoidID] == msc_uiNoBoid) {
+		return false;
+	}
+
+	const unsigned int i = m_boidIndices[a_uiBoidID];
+	// The order of the boids doesn't matter, so fill the gap with the last boid.
+	m_positions[i] = m_positions.back();
+	m_positions.pop_back();
+	m_velocities[i] = m_velocities.back();
+	m_velocities.pop_back();
+	m_steeringVelocities[i] = m_steeringVelocities.back();
+	m_steeringVelocities.pop_back();
+	m_collisionVelocities[i] = m_collisionVelocities.back();
+	m_collisionVelocities.pop_back();
+	m_dimensions[i] = m_dimensions.back();
+	m_dimensions.pop_back();
+	m_colliding[i] = m_colliding.back();
+	m_colliding.pop_back();
+	m_randomStates[i] = m_randomStates.back();
+	m_randomStates.pop_back();
+	m_phases[i] = m_phases.back();
+	m_phases.pop_back();
+	m_entities[i] = m_entities.back();
+	m_entities.pop_back();
+	m_boidIDs[i] = m_boidIDs.back();
+	m_boidIDs.pop_back();
+
+	// The last boid has taken the removed boid's place, unless it was the removed boid.
+	if (i < m_boidIDs.size()) {
+		m_boidIndices[m_boidIDs[i]] = i;
+	}
+
+	m_boidIndices[a_uiBoidID] = msc_uiNoBoid;
+	m_freeBoidIDs.push_back(a_uiBoidID);
+	return true;
+}
+
+void FlockSystem::SortBoids() {
+	const unsigned int boidCount = m_positions.size();
+	std::fill(m_cellStarts.begin(), m_cellStarts.end(), 0);
+	m_boidCells.resize(boidCount);
+
+	// Count the boids in each cell.
+	for (unsigned int i = 0; i < boidCount; ++i) {
+		m_boidCells[i] = GetCellIndex(GetCellCoordinates(m_positions[i]));
+		++m_cellStarts[m_boidCells[i] + 1];
+	}
+
+	// Turn the counts into each cell's starting index.
+	for (unsigned int i = 1; i < m_cellStarts.size(); ++i) {
+		m_cellStarts[i] += m_cellStarts[i - 1];
+	}
+
+	// Place each boid after the boids that have already been placed in its cell. The cell starts are moved along as
+	// boids are placed, and moved back afterwards.
+	m_sortedOrder.resize(boidCount);
+
+	for (unsigned int i = 0; i < boidCount; ++i) {
+		m_sortedOrder[m_cellStarts[m_boidCells[i]]++] = i;
+	}
+
+	for (unsigned int i = m_cellStarts.size() - 1; i > 0; --i) {
+		m_cellStarts[i] = m_cellStarts[i - 1];
+	}
+
+	m_cellStarts[0] = 0;
+	Reorder(m_positions, m_sortedOrder, m_sortingVectors);
+	Reorder(m_velocities, m_sortedOrder, m_sortingVectors);
+	Reorder(m_steeringVelocities, m_sortedOrder, m_sortingVectors);
+	Reorder(m_collisionVelocities, m_sortedOrder, m_sortingVectors);
+	Reorder(m_dimensions, m_sortedOrder, m_sortingVectors);
+	Reorder(m_colliding, m_sortedOrder, m_sortingBytes);
+	Reorder(m_randomStates, m_sortedOrder, m_sortingIntegers);
+	Reorder(m_phases, m_sortedOrder, m_sortingIntegers);
+	Reorder(m_entities, m_sortedOrder, m_sortingEntities);
+	Reorder(m_boidIDs, m_sortedOrder, m_sortingIntegers);
+
+	for (unsigned int i = 0; i < boidCount; ++i) {
+		m_boidIndices[m_boidIDs[i]] = i;
+	}
+}
+
+void FlockSystem::SteerBoid(unsigned int a_uiBoid,
+	const std::vector<BoundingBox<glm::vec3>>& a_rObstacles) {
+	const glm::vec3 position = m_positions[a_uiBoid];
+	const BoundingBox<glm::vec3> neighbourhood(position, glm::vec3(mc_fMaximumNeighbourDistance));
+	const BoundingBox<glm::vec3> bounds(position, m_dimensions[a_uiBoid]);
+	// Widen the search by the size of the largest boid to reach any boid that pokes into the neighbourhood.
+	const glm::vec3 searchDimensions = neighbourhood.GetDimensions() + m_boidDimensions;
+	const glm::ivec3 minimumCell = GetCellCoordinates(position - searchDimensions);
+	const glm::ivec3 maximumCell = GetCellCoordinates(position + searchDimensions);
+	// Moving away from every neighbour is the opposite of moving towards them, so the separation force is made from
+	// the cohesion force once every neighbour has been found. Only boids that share a position need their own
+	// separation direction.
+	glm::vec3 separationVelocity(0.0f);
+	glm::vec3 alignmentVelocity(0.0f);
+	glm::vec3 cohesionVelocity(0.0f);
+	glm::vec3 collisionVelocity(0.0f);
+	bool colliding = false;
+	unsigned int& rRandomState = m_randomStates[a_uiBoid];
+	const FlockKernels::Neighbourhood kernelNeighbourhood = {
+		position,
+		neighbourhood.GetDimensions(),
+		bounds.GetDimensions(),
+		a_uiBoid
+	};
+	const glm::vec3* pPositions = m_positions.data();
+	const glm::vec3* pVelocities = m_velocities.data();
+	const glm::vec3* pDimensions = m_dimensions.data();
+	// Long runs of boids are split up so the touching boids always fit in a small buffer.
+	const unsigned int maximumRunLength = 256;
+	unsigned int touchingBoids[maximumRunLength];
+
+	for (int z = minimumCell.z; z <= maximumCell.z; ++z) {
+		for (int y = minimumCell.y; y <= maximumCell.y; ++y) {
+			// Cells along the x axis are next to each other, so their boids can be read in one run.
+			const unsigned int firstBoid = m_cellStarts[GetCellIndex(glm::ivec3(minimumCell.x, y, z))];
+			const unsigned int lastBoid = m_cellStarts[GetCellIndex(glm::ivec3(maximumCell.x, y, z)) + 1];
+
+			for (unsigned int runStart = firstBoid; runStart < lastBoid; runStart += maximumRunLength) {
+				const unsigned int runEnd = std::min(runStart + maximumRunLength, lastBoid);
+				const unsigned int touchingCount = FlockKernels::AccumulateNeighbours(kernelNeighbourhood,
+					pPositions,
+					pVelocities,
+					pDimensions,
+					runStart,
+					runEnd,
+					alignmentVelocity,
+					cohesionVelocity,
+					touchingBoids);
+
+				// Boids rarely touch, so the rest is only worked out for the few that do.
+				for (unsigned int touchingBoid = 0; touchingBoid < touchingCount; ++touchingBoid) {
+					const unsigned int i = touchingBoids[touchingBoid];
+					// Creates a direction that points away from the other boid if they have different positions.
+					glm::vec3 directionFromNeighbour = position - pPositions[i];
+
+					if (position == pPositions[i]) {
+						directionFromNeighbour = GetRandomDirection(rRandomState);
+						separationVelocity += directionFromNeighbour;
+					}
+
+					if (m_bCollisionsOn) {
+						collisionVelocity += directionFromNeighbour;
+						colliding = true;
+					}
+				}
+			}
+		}
+	}
+
+	separationVelocity -= cohesionVelocity;
+
+	if (m_bCollisionsOn) {
+		for (const BoundingBox<glm::vec3>& rObstacle : a_rObstacles) {
+			if (bounds.Overlaps(rObstacle)) {
+				collisionVelocity += position == rObstacle.GetPosition() ?
+					GetRandomDirection(rRandomState) :
+					position - rObstacle.GetPosition();
+				colliding = true;
+			}
+		}
+	}
+
+	// Each force points along the sum of its neighbours' contributions, so only normalise once they've all been
+	// added.
+	if (glm::length(separationVelocity) > 0.0f) {
+		separationVelocity = glm::normalize(separationVelocity);
+	}
+
+	if (glm::length(alignmentVelocity) > 0.0f) {
+		alignmentVelocity = glm::normalize(alignmentVelocity);
+	}
+
+	if (glm::length(cohesionVelocity) > 0.0f) {
+		cohesionVelocity = glm::normalize(cohesionVelocity);
+	}
+
+	if (glm::length(collisionVelocity) > 0.0f) {
+		collisionVelocity = glm::normalize(collisionVelocity);
+	}
+
+	const glm::vec3 wanderVelocity = CalculateWanderVelocity(position, m_velocities[a_uiBoid], rRandomState);
+	m_steeringVelocities[a_uiBoid] += separationVelocity * m_fSeparationForce +
+		alignmentVelocity * m_fAlignmentForce +
+		cohesionVelocity * m_fCohesionForce +
+		wanderVelocity * m_fWanderForce;
+	m_collisionVelocities[a_uiBoid] = collisionVelocity;
+	m_colliding[a_uiBoid] = colliding ? 1 : 0;
+}
+
+void FlockSystem::MoveBoid(unsigned int a_uiBoid,
+	float a_fDeltaTime) {
+	glm::vec3 velocity = m_colliding[a_uiBoid] ? m_collisionVelocities[a_uiBoid] : m_steeringVelocities[a_uiBoid];
+
+	// Check if the boid will move outside the flock's area.
+	if (!m_area.Contains(m_positions[a_uiBoid] + velocity * a_fDeltaTime)) {
+		// Reverse the boid's movement directions.
+		velocity = -velocity;
+		m_steeringVelocities[a_uiBoid] = -m_steeringVelocities[a_uiBoid];
+	}
+
+	velocity = glm::clamp(velocity,
+		glm::vec3(-mc_fMaximumVelocity),
+		glm::vec3(mc_fMaximumVelocity));
+	m_nextPositions[a_uiBoid] = m_positions[a_uiBoid] + velocity * a_fDeltaTime;
+
+	// The boid faces along its velocity, which is kept as a direction in the same way that a brain component does.
+	if (glm::length(velocity) > 0.0f) {
+		velocity = glm::normalize(velocity);
+	}
+
+	m_nextVelocities[a_uiBoid] = velocity;
+}
+
+glm::vec3 FlockSystem::CalculateWanderVelocity(const glm::vec3& a_rPosition,
+	const glm::vec3& a_rVelocity,
+	unsigned int& a_rRandomState) const {
+	// Greater values result in wider turning angles.
+	const float projectionDistance = 4.0f;
+	// Project a point in front for the center of a sphere.
+	const glm::vec3 wanderPointOrigin = a_rPosition + a_rVelocity * projectionDistance;
+	const float wanderRadius = 2.0f;
+	// Find a random point on the sphere's surface.
+	glm::vec3 wanderPoint = wanderPointOrigin + GetRandomPointOnSphere(wanderRadius, a_rRandomState);
+	const float jitter = 0.5f;
+	wanderPoint += GetRandomPointOnSphere(jitter, a_rRandomState);
+	// Seek to the wander point.
+	glm::vec3 targetDirection = wanderPoint - a_rPosition;
+
+	if (glm::length(targetDirection) > 0.0f) {
+		targetDirection = glm::normalize(targetDirection);
+	}
+
+	return targetDirection * mc_fSpeed - a_rVelocity;
+}
+
+glm::vec3 FlockSystem::GetRandomDirection(unsigned int& a_rRandomState) {
+	const float absoluteRange = 1.0f;
+	return glm::vec3(GetRandomNumber(a_rRandomState) * 2.0f - 1.0f,
+		GetRandomNumber(a_rRandomState) * 2.0f - 1.0f,
+		GetRandomNumber(a_rRandomState) * 2.0f - 1.0f) * absoluteRange;
+}
+
+glm::vec3 FlockSystem::GetRandomPointOnSphere(float a_fRadius,
+	unsigned int& a_rRandomState) {
+	// Picking the height and the angle around the vertical axis uniformly spreads the points evenly over the sphere.
+	const float height = GetRandomNumber(a_rRandomState) * 2.0f - 1.0f;
+	const float angle = GetRandomNumber(a_rRandomState) * glm::two_pi<float>();
+	const float radiusAtHeight = glm::sqrt(1.0f - height * height);
+	return glm::vec3(radiusAtHeight * glm::cos(angle), radiusAtHeight * glm::sin(angle), height) * a_fRadius;
+}
@@ -0,0 +1,97 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+// File's header.
+#include "FrameTimeHistogram.h"
+
+FrameTimeHistogram::FrameTimeHistogram(float a_fBinWidth,
+	unsigned int a_uiBinCount) : m_fBinWidth(a_fBinWidth > 0.0f ? a_fBinWidth : 1.0f),
+	m_bins(a_uiBinCount > 0 ? a_uiBinCount : 1, 0),
+	m_uiFrameCount(0),
+	m_dTotalTime(0.0),
+	m_fMaximumTime(0.0f) {}
+
+void FrameTimeHistogram::Add(float a_fMilliseconds) {
+	const float time = a_fMilliseconds > 0.0f ? a_fMilliseconds : 0.0f;
+	const unsigned int lastBin = m_bins.size() - 1;
+	const float bin = time / m_fBinWidth;
+	++m_bins[bin < lastBin ? static_cast<unsigned int>(bin) : lastBin];
+	++m_uiFrameCount;
+	m_dTotalTime += time;
+
+	if (time > m_fMaximumTime) {
+		m_fMaximumTime = time;
+	}
+}
+
+void FrameTimeHistogram::Clear() {
+	m_bins.assign(m_bins.size(), 0);
+	m_uiFrameCount = 0;
+	m_dTotalTime = 0.0;
+	m_fMaximumTime = 0.0f;
+}
+
+float FrameTimeHistogram::GetPercentile(float a_fPercentile) const {
+	if (m_uiFrameCount == 0) {
+		return 0.0f;
+	}
+
+	const float frameCount = m_uiFrameCount * a_fPercentile / 100.0f;
+	unsigned int countedFrames = 0;
+
+	for (unsigned int i = 0; i < m_bins.size(); ++i) {
+		countedFrames += m_bins[i];
+
+		if (countedFrames >= frameCount) {
+			return (i + 1) * m_fBinWidth;
+		}
+	}
+
+	return m_bins.size() * m_fBinWidth;
+}
+
+void FrameTimeHistogram::Print(std::FILE* a_pFile) const {
+	std::fprintf(a_pFile, "%u frames: mean %.3f ms, p50 %.2f ms, p99 %.2f ms, max %.3f ms\n",
+		m_uiFrameCount,
+		GetMeanTime(),
+		GetPercentile(50.0f),
+		GetPercentile(99.0f),
+		m_fMaximumTime);
+	unsigned int firstBin = 0;
+	unsigned int lastBin = m_bins.size();
+	unsigned int largestBin = 0;
+
+	while (firstBin < lastBin && m_bins[firstBin] == 0) {
+		++firstBin;
+	}
+
+	while (lastBin > firstBin && m_bins[lastBin - 1] == 0) {
+		--lastBin;
+	}
+
+	for (unsigned int i = firstBin; i < lastBin; ++i) {
+		largestBin = m_bins[i] > largestBin ? m_bins[i] : largestBin;
+	}
+
+	// The longest bar's length in characters.
+	const unsigned int maximumBarLength = 50;
+
+	for (unsigned int i = firstBin; i < lastBin; ++i) {
+		const unsigned int barLength = largestBin > 0 ?
+			(m_bins[i] * maximumBarLength + largestBin - 1) / largestBin :
+			0;
+		std::fprintf(a_pFile, "%7.2f-%-7.2f%s ms %8u |",
+			i * m_fBinWidth,
+			(i + 1) * m_fBinWidth,
+			i + 1 == m_bins.size() ? "+" : " ",
+			m_bins[i]);
+
+		for (unsigned int j = 0; j < barLength; ++j) {
+			std::fputc('#', a_pFile);
+		}
+
+		std::fputc('\n', a_pFile);
+	}
+}
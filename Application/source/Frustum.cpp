@@ -0,0 +1,64 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+// File's header.
+#include "Frustum.h"
+
+Frustum::Frustum() {
+	// Planes without a normal are never behind anything.
+	for (unsigned int i = 0; i < PLANE_COUNT; ++i) {
+		m_planes[i] = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+	}
+}
+
+Frustum::Frustum(const glm::mat4& a_rViewProjectionMatrix) {
+	// A point is inside clip space when -w <= x, y, z <= w, so each plane is the matrix's last row plus or minus one
+	// of its other rows (Gribb and Hartmann). Glm stores matrices by column, so the rows are gathered by hand.
+	glm::vec4 rows[4];
+
+	for (unsigned int i = 0; i < 4; ++i) {
+		rows[i] = glm::vec4(a_rViewProjectionMatrix[0][i],
+			a_rViewProjectionMatrix[1][i],
+			a_rViewProjectionMatrix[2][i],
+			a_rViewProjectionMatrix[3][i]);
+	}
+
+	m_planes[PLANE_LEFT] = rows[3] + rows[0];
+	m_planes[PLANE_RIGHT] = rows[3] - rows[0];
+	m_planes[PLANE_BOTTOM] = rows[3] + rows[1];
+	m_planes[PLANE_TOP] = rows[3] - rows[1];
+	m_planes[PLANE_NEAR] = rows[3] + rows[2];
+	m_planes[PLANE_FAR] = rows[3] - rows[2];
+
+	// Normalises each plane so its distances are measured in world units.
+	for (unsigned int i = 0; i < PLANE_COUNT; ++i) {
+		const float normalLength = glm::length(glm::vec3(m_planes[i]));
+
+		if (normalLength > 0.0f) {
+			m_planes[i] /= normalLength;
+		}
+	}
+}
+
+Frustum::CONTAINMENT Frustum::Classify(const BoundingBox<glm::vec3>& a_rBox) const {
+	const glm::vec3& rCentre = a_rBox.GetPosition();
+	const glm::vec3& rExtents = a_rBox.GetDimensions();
+	CONTAINMENT containment = CONTAINMENT_INSIDE;
+
+	for (unsigned int i = 0; i < PLANE_COUNT; ++i) {
+		const glm::vec3 normal(m_planes[i]);
+		const float distance = glm::dot(normal, rCentre) + m_planes[i].w;
+		// How far the box reaches towards the plane from its centre, along the plane's normal.
+		const float radius = glm::dot(glm::abs(normal), rExtents);
+
+		if (distance < -radius) {
+			return CONTAINMENT_OUTSIDE;
+		} else if (distance < radius) {
+			containment = CONTAINMENT_INTERSECTING;
+		}
+	}
+
+	return containment;
+}
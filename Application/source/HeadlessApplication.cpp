@@ -0,0 +1,133 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+// File's header.
+#include "HeadlessApplication.h"
+#include "BrainComponent.h"
+#include "ColliderComponent.h"
+#include "Entity.h"
+#include "TransformComponent.h"
+#include "Utilities.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+HeadlessApplication::HeadlessApplication(Scene::SPATIAL_INDEX_TYPE a_spatialIndexType,
+	bool a_bUseFlockSystem,
+	unsigned int a_uiBoidCount,
+	float a_fDensity,
+	unsigned int a_uiSeed,
+	unsigned int a_uiReevaluationBucketCount,
+	bool a_bUseNeighbourLists,
+	bool a_bUseCellAggregates,
+	float a_fOpeningAngle) : m_uiBoidCount(a_uiBoidCount),
+	m_pScene(nullptr) {
+	// Seed the random number generator before the scene is created, because the scene seeds its flock from it.
+	srand(a_uiSeed);
+	m_pScene = new Scene(a_spatialIndexType, a_bUseFlockSystem, GetSceneExtent(a_uiBoidCount, a_fDensity));
+
+	if (a_uiReevaluationBucketCount > 0) {
+		m_pScene->SetReevaluationBucketCount(a_uiReevaluationBucketCount);
+	}
+
+	m_pScene->SetNeighbourListState(a_bUseNeighbourLists);
+	m_pScene->SetCellAggregateState(a_bUseCellAggregates);
+	m_pScene->SetOpeningAngle(a_fOpeningAngle);
+
+	if (m_uiBoidCount > 0) {
+		m_pScene->AddEntities(CreateBoid(), m_uiBoidCount);
+	}
+}
+
+HeadlessApplication::~HeadlessApplication() {
+	delete m_pScene;
+	m_pScene = nullptr;
+}
+
+void HeadlessApplication::Run(unsigned int a_uiFrameCount) {
+	if (!m_pScene) {
+		return;
+	}
+
+	typedef std::chrono::steady_clock Clock;
+	// Each frame takes exactly one step, however slowly the boids are updated.
+	const float frameTime = m_pScene->GetClock().GetStepDuration();
+	// Only the steps that are run here are shown in the histogram, not the one that placed the boids.
+	m_pScene->ClearStepTimes();
+	const Clock::time_point startTime = Clock::now();
+
+	for (unsigned int frame = 0; frame < a_uiFrameCount; ++frame) {
+		m_pScene->Update(frameTime);
+	}
+
+	const double elapsedSeconds = std::chrono::duration<double>(Clock::now() - startTime).count();
+	const double boidUpdates = static_cast<double>(m_uiBoidCount) * a_uiFrameCount;
+	std::printf("%u boids, %u frames: %.3f s, %.3f ms/frame, %.0f boid-updates/s\n",
+		m_uiBoidCount,
+		a_uiFrameCount,
+		elapsedSeconds,
+		a_uiFrameCount > 0 ? elapsedSeconds * 1000.0 / a_uiFrameCount : 0.0,
+		elapsedSeconds > 0.0 ? boidUpdates / elapsedSeconds : 0.0);
+	std::printf("Steering split into %u groups over %u steps\n",
+		m_pScene->GetReevaluationBucketCount(),
+		m_pScene->GetReevaluationInterval());
+	m_pScene->GetStepTimes().Print(stdout);
+
+	for (unsigned int i = 0; i < Scene::UPDATE_STAGE_COUNT; ++i) {
+		const Scene::UPDATE_STAGE stage = static_cast<Scene::UPDATE_STAGE>(i);
+		const FrameTimeHistogram& rStageTimes = m_pScene->GetStageTimes(stage);
+		std::printf("  %-20s mean %.3f ms, max %.3f ms\n",
+			Scene::GetUpdateStageName(stage),
+			rStageTimes.GetMeanTime(),
+			rStageTimes.GetMaximumTime());
+	}
+
+	// Flock systems find their boids' neighbours themselves, so the lists are only used by brain components.
+	if (m_pScene->GetNeighbourListState() && !m_pScene->GetFlockSystem()) {
+		const NeighbourList& rNeighbourList = m_pScene->GetNeighbourList();
+		std::printf("Neighbour lists rebuilt on %u of %u checks (%.1f%%), %.1f entities listed per boid\n",
+			rNeighbourList.GetBuildCount(),
+			rNeighbourList.GetUpdateCount(),
+			rNeighbourList.GetRebuildRate() * 100.0f,
+			m_uiBoidCount > 0 ? static_cast<double>(rNeighbourList.GetNeighbourCount()) / m_uiBoidCount : 0.0);
+	}
+}
+
+float HeadlessApplication::GetSceneExtent(unsigned int a_uiBoidCount,
+	float a_fDensity) {
+	// Matches the scene's default extent, for scenes that nothing can size.
+	const float defaultExtent = 10.0f;
+
+	if (a_uiBoidCount == 0 || a_fDensity <= 0.0f) {
+		return defaultExtent;
+	}
+
+	// The scene is a cube that's twice as wide as its extent.
+	const float volume = a_uiBoidCount / a_fDensity * 1000.0f;
+	return std::cbrt(volume) * 0.5f;
+}
+
+Entity* HeadlessApplication::CreateBoid() {
+	Entity* pBoid = m_pScene->CreateEntity();
+	TransformComponent* pTransform = m_pScene->CreateComponent<TransformComponent>(pBoid);
+	// The absolute value for the maximum spawn distance.
+	const int absoluteXDistance = m_pScene->GetSpatialIndex().GetArea().GetDimensions().x;
+	const int absoluteYDistance = m_pScene->GetSpatialIndex().GetArea().GetDimensions().y;
+	const int absoluteZDistance = m_pScene->GetSpatialIndex().GetArea().GetDimensions().z;
+	pTransform->SetMatrixRow(TransformComponent::MATRIX_ROW_POSITION_VECTOR,
+		glm::vec3(Utilities::RandomRange(-absoluteXDistance, absoluteXDistance),
+			Utilities::RandomRange(-absoluteYDistance, absoluteYDistance),
+			Utilities::RandomRange(-absoluteZDistance, absoluteZDistance)));
+	pBoid->AddComponent(COMPONENT_TYPE_TRANSFORM, static_cast<Component*>(pTransform));
+	// Matches the size of the application's boids, so they collide in the same way.
+	ColliderComponent* pCollider = m_pScene->CreateComponent<ColliderComponent>(pBoid);
+	pCollider->SetDimensions(glm::vec3(Utilities::Third, 0.15f, Utilities::Third));
+	pBoid->AddComponent(COMPONENT_TYPE_COLLIDER, pCollider);
+	BrainComponent* pBrain = m_pScene->CreateComponent<BrainComponent>(pBoid, m_pScene);
+	pBoid->AddComponent(COMPONENT_TYPE_BRAIN, static_cast<Component*>(pBrain));
+	pBoid->SetTag("Boid");
+	return pBoid;
+}
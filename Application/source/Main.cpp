@@ -3,10 +3,115 @@
 // Date Created: 21/01/2021.
 //////////////////////////////
 
+// Builds that only simulate, such as on machines without a display, define BOIDSIM_HEADLESS_ONLY to leave out
+// everything that needs a window or rendering context.
+#ifndef BOIDSIM_HEADLESS_ONLY
 #include "Application.h"
 #include "Framework.h"
+#endif // !BOIDSIM_HEADLESS_ONLY
+#include "BrainComponent.h"
+#include "HeadlessApplication.h"
+#include "Scene.h"
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
 
-int main() {
+int main(int argc, char* argv[]) {
+	// The oct-tree is used unless "--spatial-index hash-grid" or "--spatial-index linear-oct-tree" is passed on the
+	// command line.
+	Scene::SPATIAL_INDEX_TYPE spatialIndexType = Scene::SPATIAL_INDEX_TYPE_OCT_TREE;
+	// The boids are moved by a flock system unless "--brain-components" is passed on the command line.
+	bool useFlockSystem = true;
+#ifndef BOIDSIM_HEADLESS_ONLY
+	// The scene is simulated on its own thread unless "--single-thread" is passed on the command line.
+	bool threadedSimulation = true;
+#endif // !BOIDSIM_HEADLESS_ONLY
+	// "--headless" simulates the boids without a window, for the number of frames given by "--frames", and with the
+	// number of boids given by "--boids". "--seed" makes the run repeatable, and "--buckets" sets how many groups the
+	// boids are split into for steering on different steps (one steers every boid on the same step).
+	// "--neighbour-lists" has boids that are moved by their brain components find their neighbours from lists that
+	// are only rebuilt once the boids have moved far enough. "--topological" has those boids steer by the given number
+	// of nearest boids, however far away they are, rather than by every boid within a fixed distance.
+	// "--cell-aggregates" has them perceive boids out to the distance given by "--perception", with distant areas of
+	// the oct-tree perceived through their totals once they're narrower than "--opening-angle" times their distance.
+	// "--density" sets how many boids there are in every 1,000 cubic units, which the headless scene is sized to fit.
+	// The default is sparse enough that each boid's neighbourhood only reaches a small part of the flock, whereas the
+	// windowed application's 1,000 boids are packed 125 to every 1,000 cubic units.
+	bool headless = false;
+	bool useNeighbourLists = false;
+	bool useCellAggregates = false;
+	float openingAngle = 0.5f;
+	float density = 10.0f;
+	unsigned int frameCount = 600;
+	unsigned int boidCount = 1000;
+	unsigned int seed = static_cast<unsigned int>(time(nullptr));
+	unsigned int bucketCount = 0;
+
+	for (int i = 1; i < argc; ++i) {
+		if (std::strcmp(argv[i], "--brain-components") == 0) {
+			useFlockSystem = false;
+		} else if (std::strcmp(argv[i], "--headless") == 0) {
+			headless = true;
+#ifndef BOIDSIM_HEADLESS_ONLY
+		} else if (std::strcmp(argv[i], "--single-thread") == 0) {
+			threadedSimulation = false;
+#endif // !BOIDSIM_HEADLESS_ONLY
+		} else if (std::strcmp(argv[i], "--neighbour-lists") == 0) {
+			useNeighbourLists = true;
+		} else if (std::strcmp(argv[i], "--cell-aggregates") == 0) {
+			useCellAggregates = true;
+		}
+
+		if (i + 1 >= argc) {
+			continue;
+		}
+
+		if (std::strcmp(argv[i], "--frames") == 0) {
+			frameCount = static_cast<unsigned int>(std::strtoul(argv[i + 1], nullptr, 10));
+		} else if (std::strcmp(argv[i], "--boids") == 0) {
+			boidCount = static_cast<unsigned int>(std::strtoul(argv[i + 1], nullptr, 10));
+		} else if (std::strcmp(argv[i], "--seed") == 0) {
+			seed = static_cast<unsigned int>(std::strtoul(argv[i + 1], nullptr, 10));
+		} else if (std::strcmp(argv[i], "--buckets") == 0) {
+			bucketCount = static_cast<unsigned int>(std::strtoul(argv[i + 1], nullptr, 10));
+		} else if (std::strcmp(argv[i], "--topological") == 0) {
+			BrainComponent::SetNeighbourhoodType(BrainComponent::NEIGHBOURHOOD_TYPE_TOPOLOGICAL);
+			BrainComponent::SetTopologicalNeighbourCount(static_cast<unsigned int>(std::strtoul(argv[i + 1], nullptr, 10)));
+		} else if (std::strcmp(argv[i], "--perception") == 0) {
+			BrainComponent::SetPerceptionDistance(std::strtof(argv[i + 1], nullptr));
+		} else if (std::strcmp(argv[i], "--opening-angle") == 0) {
+			openingAngle = std::strtof(argv[i + 1], nullptr);
+		} else if (std::strcmp(argv[i], "--density") == 0) {
+			density = std::strtof(argv[i + 1], nullptr);
+		} else if (std::strcmp(argv[i], "--spatial-index") == 0) {
+			if (std::strcmp(argv[i + 1], "hash-grid") == 0) {
+				spatialIndexType = Scene::SPATIAL_INDEX_TYPE_HASH_GRID;
+			} else if (std::strcmp(argv[i + 1], "linear-oct-tree") == 0) {
+				spatialIndexType = Scene::SPATIAL_INDEX_TYPE_LINEAR_OCT_TREE;
+			}
+		}
+	}
+
+#ifdef BOIDSIM_HEADLESS_ONLY
+	headless = true;
+#endif // BOIDSIM_HEADLESS_ONLY
+
+	if (headless) {
+		// Never touches the rendering framework, so no window or rendering context is created.
+		HeadlessApplication application(spatialIndexType,
+			useFlockSystem,
+			boidCount,
+			density,
+			seed,
+			bucketCount,
+			useNeighbourLists,
+			useCellAggregates,
+			openingAngle);
+		application.Run(frameCount);
+		return 0;
+	}
+
+#ifndef BOIDSIM_HEADLESS_ONLY
 	Framework* pFramework = Framework::GetInstance();
 
 	if (pFramework) {
@@ -18,11 +123,13 @@ int main() {
 			pFramework->GetScreenHeight(),
 			"Resources/Shaders/model_loading.vs",
 			"Resources/Shaders/model_loading.fs",
+			"Resources/Shaders/model_loading_instanced.vs",
 			"Resources/Shaders/lineRenderer.vs",
 			"Resources/Shaders/lineRenderer.fs");
-		Application application;
+		Application application(spatialIndexType, useFlockSystem, threadedSimulation);
 		application.Run();
 	}
+#endif // !BOIDSIM_HEADLESS_ONLY
 
 	return 0;
 }
\ No newline at end of file
@@ -5,12 +5,15 @@
 
 // File's header.
 #include "ModelComponent.h"
+#include "ColliderComponent.h"
 #include "Entity.h"
 #include "Framework.h"
 #include "glm/ext.hpp"
 #include "glm/gtc/matrix_transform.hpp"
 #include "LearnOpenGL/shader.h"
 #include "LearnOpenGL/model.h"
+#include "Scene.h"
+#include "SceneSnapshot.h"
 #include "TransformComponent.h"
 #include "Utilities.h"
 
@@ -44,10 +47,34 @@ void ModelComponent::Update(float a_fDeltaTime) {
 }
 
 void ModelComponent::Draw(Framework* a_pRenderingFramework) {
+	if (a_pRenderingFramework->GetInstancedRenderingState()) {
+		// Drawn along with every other entity that shares the model, once the scene has finished drawing.
+		a_pRenderingFramework->AddModelInstance(m_pModel, glm::value_ptr(m_scaleMatrix));
+		return;
+	}
+
 	a_pRenderingFramework->GetShader()->setMat4("model", m_scaleMatrix);
 	a_pRenderingFramework->DrawModel(m_pModel);
 }
 
+void ModelComponent::WriteSnapshot(SceneSnapshot& a_rSnapshot) const {
+	if (!m_pModel) {
+		return;
+	}
+
+	ColliderComponent* pCollider = static_cast<ColliderComponent*>(m_pAttachedEntity->GetComponentOfType(COMPONENT_TYPE_COLLIDER));
+	const glm::vec3 cullingExtents = pCollider ? pCollider->GetBoundary()->GetDimensions() : glm::vec3(0.0f);
+	a_rSnapshot.AddModelInstance(m_pAttachedEntity->GetHandle(),
+		m_pModel,
+		m_scaleMatrix,
+		pCollider ? &cullingExtents : nullptr);
+}
+
+Component* ModelComponent::Clone(Entity* a_pOwner,
+	Scene* a_pScene) {
+	return a_pScene->CreateComponent<ModelComponent>(a_pOwner, *this);
+}
+
 void ModelComponent::LoadModel(const char* a_pFilepath) {
 	// Check if model has been loaded from file already.
 	if (ms_loadedModels.count(a_pFilepath)) {
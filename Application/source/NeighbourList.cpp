@@ -0,0 +1,83 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+// File's header.
+#include "NeighbourList.h"
+#include "BrainComponent.h"
+#include "ColliderComponent.h"
+#include "Entity.h"
+#include "TransformComponent.h"
+
+NeighbourList::NeighbourList(float a_fSkinDistance) : mc_fSkinDistance(a_fSkinDistance > 0.0f ? a_fSkinDistance : 0.0f),
+	m_listStarts(),
+	m_neighbours(),
+	m_buildPositions(),
+	m_builtSlots(),
+	m_uiUpdateCount(0),
+	m_uiBuildCount(0),
+	m_bIsStale(true),
+	m_bHasMovedTooFar(false) {}
+
+void NeighbourList::Update(const SpatialIndex<Entity, glm::vec3>& a_rSpatialIndex,
+	const std::vector<Entity*>& a_rEntities) {
+	++m_uiUpdateCount;
+
+	if (m_bIsStale || m_bHasMovedTooFar) {
+		Rebuild(a_rSpatialIndex, a_rEntities);
+	}
+}
+
+bool NeighbourList::GetNeighbours(unsigned int a_uiSlot,
+	const BoundingBox<glm::vec3>& a_rVolume,
+	std::vector<Entity*>& a_rNeighbours) const {
+	if (m_bIsStale || a_uiSlot + 1 >= m_listStarts.size() || !m_builtSlots[a_uiSlot]) {
+		return false;
+	}
+
+	for (unsigned int i = m_listStarts[a_uiSlot]; i < m_listStarts[a_uiSlot + 1]; ++i) {
+		Entity* pNeighbour = m_neighbours[i];
+		ColliderComponent* pCollider = static_cast<ColliderComponent*>(pNeighbour->GetComponentOfType(COMPONENT_TYPE_COLLIDER));
+
+		// Mirrors the spatial index's query, which tests against each entity's collider.
+		if (pCollider && a_rVolume.Overlaps(pCollider->GetBoundary()->GetBoundingBox())) {
+			a_rNeighbours.push_back(pNeighbour);
+		}
+	}
+
+	return true;
+}
+
+void NeighbourList::Rebuild(const SpatialIndex<Entity, glm::vec3>& a_rSpatialIndex,
+	const std::vector<Entity*>& a_rEntities) {
+	m_listStarts.assign(a_rEntities.size() + 1, 0);
+	m_buildPositions.assign(a_rEntities.size(), glm::vec3(0.0f));
+	m_builtSlots.assign(a_rEntities.size(), false);
+	m_neighbours.clear();
+
+	for (unsigned int i = 0; i < a_rEntities.size(); ++i) {
+		m_listStarts[i] = m_neighbours.size();
+		const Entity* pEntity = a_rEntities[i];
+		const TransformComponent* pTransform = pEntity ? static_cast<TransformComponent*>(pEntity->GetComponentOfType(COMPONENT_TYPE_TRANSFORM)) : nullptr;
+
+		if (!pTransform) {
+			continue;
+		}
+
+		m_buildPositions[i] = *pTransform->GetPosition();
+		m_builtSlots[i] = true;
+		const BrainComponent* pBrain = static_cast<BrainComponent*>(pEntity->GetComponentOfType(COMPONENT_TYPE_BRAIN));
+
+		if (pBrain) {
+			a_rSpatialIndex.Query(BoundingBox<glm::vec3>(m_buildPositions[i],
+				glm::vec3(pBrain->GetNeighbourDistance() + mc_fSkinDistance)),
+				m_neighbours);
+		}
+	}
+
+	m_listStarts[a_rEntities.size()] = m_neighbours.size();
+	++m_uiBuildCount;
+	m_bIsStale = false;
+	m_bHasMovedTooFar = false;
+}
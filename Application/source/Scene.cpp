@@ -8,64 +8,242 @@
 #include "BrainComponent.h"
 #include "Boundary.h"
 #include "ColliderComponent.h"
+#include "FlockSystem.h"
 #include "Framework.h"
 #include "glm/ext.hpp"
-#include "LearnOpenGL/camera.h"
-#include "LearnOpenGL/shader.h"
-#include "ModelComponent.h"
+#include "LinearOctTree.h"
+#include "SceneSnapshot.h"
+#include "SpatialHashGrid.h"
+#include "TransformComponent.h"
 #include "Utilities.h"
+#include <chrono>
 
-// Typedefs.
-typedef std::map<unsigned int, Entity*> EntityMap;
-typedef std::pair<unsigned int, Entity*> EntityPair;
-
-Scene::Scene() : m_uiEntityCount(0),
+Scene::Scene(SPATIAL_INDEX_TYPE a_spatialIndexType,
+	bool a_bUseFlockSystem,
+	float a_fExtent) : m_uiEntityCount(0),
+	m_entityPool(),
+	m_componentPools(),
 	m_sceneEntities(),
-	m_octTree(4,
-		glm::vec3(0.0f),
-		glm::vec3(10.0f)) {}
+	m_archetypes(),
+	m_entityLocations(),
+	m_pSpatialIndex(nullptr),
+	m_spatialIndexType(a_spatialIndexType),
+	m_boundary(glm::vec3(0.0f), glm::vec3(a_fExtent)),
+	m_pFlockSystem(nullptr),
+	m_obstacleBounds(),
+	m_broadphase(),
+	m_contacts(),
+	// Boids move at most a few hundredths of a unit per step, so each build lasts for a number of steps.
+	m_neighbourList(1.0f),
+	m_bUseNeighbourLists(false),
+	m_bUseCellAggregates(false),
+	// Areas up to half as wide as they are far away are summed up, which is the usual Barnes-Hut trade-off.
+	m_fOpeningAngle(0.5f),
+	m_bFrustumCulling(true),
+	m_uiDrawnEntityCount(0),
+	m_uiCulledEntityCount(0),
+	m_clock(),
+	mc_fReevaluationPeriod(0.15f),
+	// Each step reevaluates one bucket, as the bucket count is limited to the reevaluation interval.
+	m_reevaluationSchedule(1, ~0u),
+	m_uiStepCount(0),
+	m_stepTimes(),
+	m_stageTimes() {
+	const glm::vec3 sceneDimensions = m_boundary.GetDimensions();
+
+	if (a_bUseFlockSystem) {
+		// Matches the neighbour distance used by the boids' brains.
+		const float neighbourDistance = 8.0f;
+		m_pFlockSystem = new FlockSystem(BoundingBox<glm::vec3>(glm::vec3(0.0f), sceneDimensions),
+			neighbourDistance,
+			static_cast<unsigned int>(rand()));
+	}
+
+	if (m_spatialIndexType == SPATIAL_INDEX_TYPE_HASH_GRID) {
+		// Matches the boids' maximum neighbour distance so each neighbour query only visits the cells around it.
+		const float cellSize = 8.0f;
+		m_pSpatialIndex = new SpatialHashGrid<Entity, glm::vec3>(glm::vec3(0.0f),
+			sceneDimensions,
+			cellSize);
+	} else if (m_spatialIndexType == SPATIAL_INDEX_TYPE_LINEAR_OCT_TREE) {
+		m_pSpatialIndex = new LinearOctTree<Entity, glm::vec3>(4,
+			glm::vec3(0.0f),
+			sceneDimensions);
+	} else {
+		m_spatialIndexType = SPATIAL_INDEX_TYPE_OCT_TREE;
+		m_pSpatialIndex = new OctTree<Entity, glm::vec3>(4,
+			glm::vec3(0.0f),
+			sceneDimensions);
+	}
+}
 
 Scene::~Scene() {
-	for (EntityMap::const_iterator iterator = m_sceneEntities.cbegin();
-		iterator != m_sceneEntities.cend();
-		++iterator) {
-		Entity* entity = iterator->second;
+	// The entities are freed along with their pool, after the components that are attached to them.
+	for (unsigned int i = 0; i < COMPONENT_TYPE_COUNT; ++i) {
+		delete m_componentPools[i];
+		m_componentPools[i] = nullptr;
+	}
 
-		if (entity) {
-			delete entity;
-			entity = nullptr;
-		}
+	delete m_pSpatialIndex;
+	m_pSpatialIndex = nullptr;
+	delete m_pFlockSystem;
+	m_pFlockSystem = nullptr;
+}
+
+void Scene::Update(float a_fFrameTime) {
+	m_clock.Accumulate(a_fFrameTime);
+
+	while (m_clock.Step()) {
+		// The interval follows the clock's tick rate, so it's brought up-to-date before asking what's due.
+		m_reevaluationSchedule.SetInterval(GetReevaluationInterval());
+		Step(m_clock.GetStepDuration(), m_reevaluationSchedule.IsAnyDue(m_uiStepCount));
 	}
 }
 
-void Scene::Update(float a_fDeltaTime) {
-	for (EntityPair entity : GetAllEntities()) {
-		entity.second->Update(a_fDeltaTime);
+void Scene::Step(float a_fStepDuration,
+	bool a_bReevaluate) {
+	typedef std::chrono::steady_clock Clock;
+	const Clock::time_point startTime = Clock::now();
+	m_reevaluationSchedule.SetInterval(GetReevaluationInterval());
+
+	for (unsigned int i = 0; i < UPDATE_STAGE_COUNT; ++i) {
+		const UPDATE_STAGE stage = static_cast<UPDATE_STAGE>(i);
+		const Clock::time_point stageStartTime = Clock::now();
+		RunStage(stage, a_fStepDuration, a_bReevaluate);
+		m_stageTimes[i].Add(std::chrono::duration<float, std::milli>(Clock::now() - stageStartTime).count());
 	}
+
+	++m_uiStepCount;
+	m_stepTimes.Add(std::chrono::duration<float, std::milli>(Clock::now() - startTime).count());
 }
 
-void Scene::Draw(Framework* a_pRenderingFramework) {
-	m_octTree.Draw();
+void Scene::Draw(Framework* a_pRenderingFramework,
+	const Frustum& a_rViewFrustum) {
+	// Shows how the spatial index has divided up the scene while colliders are being drawn.
+	if (ColliderComponent::GetColliderDrawState()) {
+		m_pSpatialIndex->Draw(a_pRenderingFramework);
+	} else {
+		m_boundary.Draw(a_pRenderingFramework);
+	}
+
+	m_uiDrawnEntityCount = 0;
 
-	if (!m_sceneEntities.empty()) {
-		for (EntityPair entity : m_sceneEntities) {
-			entity.second->Draw(a_pRenderingFramework);
+	if (!m_bFrustumCulling) {
+		for (Entity* pEntity : m_sceneEntities) {
+			if (pEntity) {
+				pEntity->Draw(a_pRenderingFramework);
+			}
+		}
+
+		m_uiDrawnEntityCount = m_uiEntityCount;
+	} else {
+		// The oct-tree rules out whole areas of entities at once, so only the entities it doesn't keep track of need
+		// testing one at a time. Its entities are tested against where they were when it was last updated, which is
+		// at most one frame's movement behind.
+		const bool useOctTree = m_spatialIndexType == SPATIAL_INDEX_TYPE_OCT_TREE;
+
+		if (useOctTree) {
+			static_cast<const OctTree<Entity, glm::vec3>*>(m_pSpatialIndex)->QueryVolume(a_rViewFrustum,
+				[this, a_pRenderingFramework](Entity* a_pEntity) {
+					a_pEntity->Draw(a_pRenderingFramework);
+					++m_uiDrawnEntityCount;
+				});
+		}
+
+		for (Entity* pEntity : m_sceneEntities) {
+			if (!pEntity || (useOctTree && IsInSpatialIndex(pEntity))) {
+				continue;
+			}
+
+			ColliderComponent* pCollider = static_cast<ColliderComponent*>(pEntity->GetComponentOfType(COMPONENT_TYPE_COLLIDER));
+
+			// Entities without a position to test are always drawn.
+			if (pCollider && pCollider->GetBoundary()->GetPosition() &&
+				a_rViewFrustum.Classify(pCollider->GetBoundary()->GetBoundingBox()) == Frustum::CONTAINMENT_OUTSIDE) {
+				continue;
+			}
+
+			pEntity->Draw(a_pRenderingFramework);
+			++m_uiDrawnEntityCount;
+		}
+	}
+
+	m_uiCulledEntityCount = m_uiEntityCount - m_uiDrawnEntityCount;
+
+	// Draws the models that the entities queued up, if they're being drawn together, and every boundary's lines.
+	a_pRenderingFramework->DrawModelInstances();
+	a_pRenderingFramework->DrawLines();
+}
+
+void Scene::WriteSnapshot(SceneSnapshot& a_rSnapshot) const {
+	a_rSnapshot.Clear();
+
+	if (ColliderComponent::GetColliderDrawState()) {
+		m_pSpatialIndex->WriteSnapshot(a_rSnapshot);
+	} else {
+		a_rSnapshot.AddLineBox(m_boundary.GetBoundingBox(), glm::vec3(1.0f));
+	}
+
+	// The entities are stored in order of their slots, which keeps the snapshot's models sorted.
+	for (const Entity* pEntity : m_sceneEntities) {
+		if (pEntity) {
+			pEntity->WriteSnapshot(a_rSnapshot);
 		}
 	}
 }
 
+Entity* Scene::CreateEntity() {
+	PoolHandle handle;
+	Entity* pEntity = m_entityPool.Create(handle);
+	pEntity->SetHandle(handle);
+	return pEntity;
+}
+
+Entity* Scene::CloneEntity(Entity& a_rEntityToCopy) {
+	PoolHandle handle;
+	Entity* pEntity = m_entityPool.Create(handle, a_rEntityToCopy, this);
+	pEntity->SetHandle(handle);
+	return pEntity;
+}
+
 bool Scene::AddEntity(Entity* a_pNewEntity) {
+	// Only entities from the scene's pool have a slot to be stored in.
+	if (!a_pNewEntity || m_entityPool.Get(a_pNewEntity->GetHandle()) != a_pNewEntity) {
+		return false;
+	}
+
+	const unsigned int slot = a_pNewEntity->GetHandle().uiIndex;
+
+	if (slot >= m_sceneEntities.size()) {
+		m_sceneEntities.resize(m_entityPool.GetCapacity(), nullptr);
+		m_entityLocations.resize(m_entityPool.GetCapacity());
+	}
+
 	// Checks if the entity already exists within the scene.
-	if (m_sceneEntities.find(a_pNewEntity->GetID()) != m_sceneEntities.cend()) {
+	if (m_sceneEntities[slot]) {
 		return false;
 	}
 
-	m_sceneEntities.insert(EntityPair(a_pNewEntity->GetID(), a_pNewEntity));
+	m_sceneEntities[slot] = a_pNewEntity;
+	m_neighbourList.Invalidate();
+	EntityLocation& rLocation = m_entityLocations[slot];
+	rLocation.uiArchetype = FindArchetype(a_pNewEntity->GetSignature());
+	rLocation.uiRow = m_archetypes[rLocation.uiArchetype].AddEntity(a_pNewEntity);
+	rLocation.uiBoidID = FlockSystem::msc_uiNoBoid;
 	++m_uiEntityCount;
 	ColliderComponent* pCollider = static_cast<ColliderComponent*>(a_pNewEntity->GetComponentOfType(COMPONENT_TYPE_COLLIDER));
+	BrainComponent* pBrain = static_cast<BrainComponent*>(a_pNewEntity->GetComponentOfType(COMPONENT_TYPE_BRAIN));
+	TransformComponent* pTransform = static_cast<TransformComponent*>(a_pNewEntity->GetComponentOfType(COMPONENT_TYPE_TRANSFORM));
 
-	if (pCollider) {
-		m_octTree.InsertObject(a_pNewEntity, *pCollider->GetBoundary());
+	if (m_pFlockSystem && pBrain && pTransform) {
+		// The flock system keeps track of its own boids, so they don't need to be added to the spatial index.
+		rLocation.uiBoidID = m_pFlockSystem->AddBoid(a_pNewEntity,
+			*pTransform->GetPosition(),
+			pBrain->GetVelocity(),
+			pCollider ? pCollider->GetBoundary()->GetDimensions() : glm::vec3(0.0f));
+	} else if (pCollider) {
+		m_pSpatialIndex->InsertObject(a_pNewEntity, *pCollider->GetBoundary());
+		m_broadphase.AddCollider(slot, pCollider, a_pNewEntity->GetHandle());
 	}
 
 	return true;
@@ -78,15 +256,40 @@ void Scene::AddEntities(Entity* a_pEntityToCopy, unsigned int a_spawnAmount) {
 	}
 
 	for (unsigned int i = 0; i < a_spawnAmount; ++i) {
-		AddEntity(new Entity(*a_pEntityToCopy, this));
+		AddEntity(CloneEntity(*a_pEntityToCopy));
 	}
 }
 
 void Scene::DestroyEntity(Entity* a_pEntityToDestroy) {
-	if (m_sceneEntities.find(a_pEntityToDestroy->GetID()) != m_sceneEntities.cend()) {
-		m_sceneEntities.erase(a_pEntityToDestroy->GetID());
+	if (!a_pEntityToDestroy || m_entityPool.Get(a_pEntityToDestroy->GetHandle()) != a_pEntityToDestroy) {
+		return;
+	}
+
+	const unsigned int slot = a_pEntityToDestroy->GetHandle().uiIndex;
+
+	if (slot < m_sceneEntities.size() && m_sceneEntities[slot] == a_pEntityToDestroy) {
+		const EntityLocation location = m_entityLocations[slot];
+
+		// Every store that the entity is removed from finds it through its location or its slot, so removing it
+		// doesn't depend on how many entities there are.
+		if (!m_pFlockSystem || !m_pFlockSystem->RemoveBoid(location.uiBoidID)) {
+			m_pSpatialIndex->RemoveObject(a_pEntityToDestroy);
+			m_broadphase.RemoveCollider(slot);
+		}
+
+		Entity* pMovedEntity = m_archetypes[location.uiArchetype].RemoveEntity(location.uiRow);
+
+		// The archetype's last entity fills the gap, so its row has changed.
+		if (pMovedEntity) {
+			m_entityLocations[pMovedEntity->GetHandle().uiIndex].uiRow = location.uiRow;
+		}
+
+		m_sceneEntities[slot] = nullptr;
+		m_neighbourList.Invalidate();
 		--m_uiEntityCount;
 	}
+
+	ReleaseEntity(a_pEntityToDestroy);
 }
 
 void Scene::DestroyEntitiesWithTag(std::string a_entityTag, unsigned int a_uiDestroyAmount) {
@@ -94,16 +297,13 @@ void Scene::DestroyEntitiesWithTag(std::string a_entityTag, unsigned int a_uiDes
 		return;
 	}
 
-	for (EntityMap::const_iterator iterator = m_sceneEntities.cbegin();
-		iterator != m_sceneEntities.cend();) {
-		if (iterator->second->GetTag() != a_entityTag) {
-			++iterator;
+	for (Entity* pEntity : m_sceneEntities) {
+		if (!pEntity || pEntity->GetTag() != a_entityTag) {
 			continue;
 		}
 
-		EntityMap::const_iterator entityToDestroy = iterator++;
-		m_sceneEntities.erase(entityToDestroy);
-		--m_uiEntityCount;
+		// Only clears the entity's slot, so the loop carries on safely.
+		DestroyEntity(pEntity);
 		--a_uiDestroyAmount;
 
 		if (a_uiDestroyAmount == 0) {
@@ -111,3 +311,276 @@ void Scene::DestroyEntitiesWithTag(std::string a_entityTag, unsigned int a_uiDes
 		}
 	}
 }
+
+void Scene::UpdateNeighbourList() {
+	// Flock systems find their boids' neighbours themselves.
+	if (m_bUseNeighbourLists && !m_pFlockSystem) {
+		m_neighbourList.Update(*m_pSpatialIndex, m_sceneEntities);
+	}
+}
+
+void Scene::UpdateCellAggregates() {
+	// Flock systems find their boids' neighbours themselves, and only oct-trees keep aggregates.
+	if (!m_bUseCellAggregates || m_pFlockSystem || m_spatialIndexType != SPATIAL_INDEX_TYPE_OCT_TREE) {
+		return;
+	}
+
+	static_cast<OctTree<Entity, glm::vec3>*>(m_pSpatialIndex)->UpdateAggregates([](Entity* a_pEntity,
+		glm::vec3& a_rVelocity) {
+		// Brains only steer by other boids, so nothing else is counted.
+		const BrainComponent* pBrain = static_cast<BrainComponent*>(a_pEntity->GetComponentOfType(COMPONENT_TYPE_BRAIN));
+
+		if (!pBrain || a_pEntity->GetTag() != "Boid") {
+			return false;
+		}
+
+		a_rVelocity = pBrain->GetVelocity();
+		return true;
+	});
+}
+
+unsigned int Scene::GetReevaluationInterval() const {
+	const unsigned int interval = static_cast<unsigned int>(mc_fReevaluationPeriod * m_clock.GetTickRate() + 0.5f);
+	return interval > 0 ? interval : 1;
+}
+
+const char* Scene::GetUpdateStageName(UPDATE_STAGE a_stage) {
+	if (a_stage == UPDATE_STAGE_SPATIAL_INDEX) {
+		return "Spatial Index";
+	} else if (a_stage == UPDATE_STAGE_COLLISION_DETECTION) {
+		return "Collision Detection";
+	} else if (a_stage == UPDATE_STAGE_STEERING) {
+		return "Steering";
+	} else if (a_stage == UPDATE_STAGE_INTEGRATION) {
+		return "Integration";
+	} else if (a_stage == UPDATE_STAGE_RENDER_MATRICES) {
+		return "Render Matrices";
+	}
+
+	return "Unknown";
+}
+
+unsigned int Scene::FindArchetype(ComponentSignature a_signature) {
+	for (unsigned int i = 0; i < m_archetypes.size(); ++i) {
+		if (m_archetypes[i].GetSignature() == a_signature) {
+			return i;
+		}
+	}
+
+	m_archetypes.push_back(Archetype(a_signature));
+	return m_archetypes.size() - 1;
+}
+
+bool Scene::IsInSpatialIndex(Entity* a_pEntity) const {
+	// Mirrors how the entity was sorted when it was added to the scene.
+	if (!a_pEntity->GetComponentOfType(COMPONENT_TYPE_COLLIDER)) {
+		return false;
+	}
+
+	return !m_pFlockSystem ||
+		!a_pEntity->GetComponentOfType(COMPONENT_TYPE_BRAIN) ||
+		!a_pEntity->GetComponentOfType(COMPONENT_TYPE_TRANSFORM);
+}
+
+void Scene::ReleaseEntity(Entity* a_pEntity) {
+	for (unsigned int i = 0; i < COMPONENT_TYPE_COUNT; ++i) {
+		const Component* pComponent = a_pEntity->GetComponentOfType(static_cast<COMPONENT_TYPE>(i));
+		ObjectPoolBase* pPool = pComponent ? m_componentPools[pComponent->GetComponentType()] : nullptr;
+
+		if (pPool) {
+			pPool->Destroy(pComponent->GetPoolHandle());
+		}
+	}
+
+	m_entityPool.Destroy(a_pEntity->GetHandle());
+}
+
+void Scene::RunStage(UPDATE_STAGE a_stage,
+	float a_fStepDuration,
+	bool a_bReevaluate) {
+	// The flock system moves every boid in one batch per stage, and the other entities are batched by archetype.
+	if (a_stage == UPDATE_STAGE_SPATIAL_INDEX) {
+		// Brings the spatial index up-to-date with where the entities moved to last step before anything queries it.
+		m_pSpatialIndex->Update();
+
+		if (m_pFlockSystem) {
+			m_pFlockSystem->SortBoids();
+		} else if (a_bReevaluate) {
+			// The lists and aggregates are only read by brains that reevaluate, so they're only updated on the steps
+			// that do.
+			UpdateNeighbourList();
+			UpdateCellAggregates();
+		}
+	} else if (a_stage == UPDATE_STAGE_COLLISION_DETECTION) {
+		if (!Entity::GetCollisionsState()) {
+			m_contacts.Clear();
+			NotifyContactColliders();
+		} else if (a_bReevaluate) {
+			// Colliders are checked in the same buckets as brains reevaluate in, by their slots, so each step only
+			// refreshes the contacts of a share of them.
+			m_contacts.BeginUpdate();
+			m_broadphase.Update(m_contacts, &m_reevaluationSchedule, m_uiStepCount);
+			m_contacts.EndUpdate(&m_reevaluationSchedule, m_uiStepCount);
+			NotifyContactColliders();
+		}
+
+		m_obstacleBounds.clear();
+	} else if (a_stage == UPDATE_STAGE_STEERING && m_pFlockSystem) {
+		// The boids' forces are set through the brain component, so the user interface controls both.
+		m_pFlockSystem->SetSeparationForce(BrainComponent::GetSeparationForce());
+		m_pFlockSystem->SetAlignmentForce(BrainComponent::GetAlignmentForce());
+		m_pFlockSystem->SetCohesionForce(BrainComponent::GetCohesionForce());
+		m_pFlockSystem->SetWanderForce(BrainComponent::GetWanderForce());
+		m_pFlockSystem->SetCollisionsState(Entity::GetCollisionsState());
+		m_pFlockSystem->SteerBoids(m_obstacleBounds,
+			a_bReevaluate ? &m_reevaluationSchedule : nullptr,
+			m_uiStepCount);
+	} else if (a_stage == UPDATE_STAGE_INTEGRATION) {
+		// Each contact is handled once here, rather than by both of its entities looking through their own. The
+		// contacts only change on steps that reevaluate, so brains keep the separation that was worked out from them
+		// until then.
+		if (a_bReevaluate) {
+			SeparateContacts();
+		}
+
+		if (m_pFlockSystem) {
+			m_pFlockSystem->MoveBoids(a_fStepDuration);
+		}
+	} else if (a_stage == UPDATE_STAGE_RENDER_MATRICES && m_pFlockSystem) {
+		SyncFlockEntities(a_fStepDuration);
+	}
+
+	for (const Archetype& rArchetype : m_archetypes) {
+		// Boids are moved by the flock system instead.
+		if (m_pFlockSystem && rArchetype.HasComponentType(COMPONENT_TYPE_BRAIN)) {
+			continue;
+		}
+
+		// Components are called straight from the archetype's columns rather than through their entities' virtual
+		// calls.
+		if (a_stage == UPDATE_STAGE_COLLISION_DETECTION) {
+			if (m_pFlockSystem) {
+				for (Component* pCollider : rArchetype.GetComponents(COMPONENT_TYPE_COLLIDER)) {
+					m_obstacleBounds.push_back(static_cast<ColliderComponent*>(pCollider)->GetBoundary()->GetBoundingBox());
+				}
+			}
+		} else if (a_stage == UPDATE_STAGE_STEERING) {
+			if (a_bReevaluate) {
+				rArchetype.ReevaluateComponents<BrainComponent>(COMPONENT_TYPE_BRAIN,
+					m_reevaluationSchedule,
+					m_uiStepCount);
+			}
+		} else if (a_stage == UPDATE_STAGE_INTEGRATION) {
+			rArchetype.UpdateComponents<TransformComponent>(COMPONENT_TYPE_TRANSFORM, a_fStepDuration);
+			rArchetype.UpdateComponents<ColliderComponent>(COMPONENT_TYPE_COLLIDER, a_fStepDuration);
+			rArchetype.UpdateComponents<BrainComponent>(COMPONENT_TYPE_BRAIN, a_fStepDuration);
+		} else if (a_stage == UPDATE_STAGE_RENDER_MATRICES) {
+			// The model component depends on the renderer, so it's updated through its base class.
+			rArchetype.UpdateComponents<Component>(COMPONENT_TYPE_MODEL, a_fStepDuration);
+		}
+	}
+}
+
+void Scene::NotifyContactColliders() {
+	for (const ContactCache::ContactEvent& rEvent : m_contacts.GetEvents()) {
+		if (rEvent.type == ContactCache::CONTACT_EVENT_TYPE_STAY) {
+			continue;
+		}
+
+		const PoolHandle handles[] = { rEvent.first, rEvent.second };
+
+		for (const PoolHandle& rHandle : handles) {
+			// Contacts with destroyed entities end the update after they're destroyed, so only one side may be left.
+			Entity* pEntity = GetEntity(rHandle);
+			ColliderComponent* pCollider = pEntity ? static_cast<ColliderComponent*>(pEntity->GetComponentOfType(COMPONENT_TYPE_COLLIDER)) : nullptr;
+
+			if (!pCollider) {
+				continue;
+			}
+
+			if (rEvent.type == ContactCache::CONTACT_EVENT_TYPE_BEGIN) {
+				pCollider->BeginContact();
+			} else {
+				pCollider->EndContact();
+			}
+		}
+	}
+}
+
+void Scene::SeparateContacts() {
+	for (const ContactCache::ContactEvent& rEvent : m_contacts.GetEvents()) {
+		if (rEvent.type == ContactCache::CONTACT_EVENT_TYPE_END) {
+			continue;
+		}
+
+		// Only the entities whose contacts were all checked this step steer away from them, as the others would be
+		// missing some.
+		const bool firstDue = m_reevaluationSchedule.IsDue(m_uiStepCount, rEvent.first.uiIndex);
+		const bool secondDue = m_reevaluationSchedule.IsDue(m_uiStepCount, rEvent.second.uiIndex);
+		Entity* pFirstEntity = GetEntity(rEvent.first);
+		Entity* pSecondEntity = GetEntity(rEvent.second);
+
+		// Skips contacts with entities that have been destroyed since the contact cache was updated.
+		if (!pFirstEntity || !pSecondEntity) {
+			continue;
+		}
+
+		TransformComponent* pFirstTransform = static_cast<TransformComponent*>(pFirstEntity->GetComponentOfType(COMPONENT_TYPE_TRANSFORM));
+		TransformComponent* pSecondTransform = static_cast<TransformComponent*>(pSecondEntity->GetComponentOfType(COMPONENT_TYPE_TRANSFORM));
+
+		if (!pFirstTransform || !pSecondTransform) {
+			continue;
+		}
+
+		BrainComponent* pFirstBrain = firstDue ?
+			static_cast<BrainComponent*>(pFirstEntity->GetComponentOfType(COMPONENT_TYPE_BRAIN)) :
+			nullptr;
+		BrainComponent* pSecondBrain = secondDue ?
+			static_cast<BrainComponent*>(pSecondEntity->GetComponentOfType(COMPONENT_TYPE_BRAIN)) :
+			nullptr;
+
+		if (pFirstBrain) {
+			pFirstBrain->CalculateCollisionVelocity(*pFirstTransform->GetPosition(), *pSecondTransform->GetPosition());
+		}
+
+		if (pSecondBrain) {
+			pSecondBrain->CalculateCollisionVelocity(*pSecondTransform->GetPosition(), *pFirstTransform->GetPosition());
+		}
+	}
+}
+
+void Scene::SyncFlockEntities(float a_fDeltaTime) {
+	for (unsigned int i = 0; i < m_pFlockSystem->GetBoidCount(); ++i) {
+		Entity* pEntity = m_pFlockSystem->GetEntity(i);
+		TransformComponent* pTransform = pEntity ? static_cast<TransformComponent*>(pEntity->GetComponentOfType(COMPONENT_TYPE_TRANSFORM)) : nullptr;
+
+		if (!pTransform) {
+			continue;
+		}
+
+		const glm::vec3 forwardDirection = m_pFlockSystem->GetVelocity(i);
+		glm::vec3 upDirection = (glm::vec3)pTransform->GetMatrixRow(TransformComponent::MATRIX_ROW_UP_VECTOR);
+		upDirection -= forwardDirection * glm::dot(forwardDirection, upDirection);
+
+		if (glm::length(upDirection) > 0.0f) {
+			upDirection = glm::normalize(upDirection);
+		}
+
+		glm::vec3 rightDirection = glm::cross(upDirection, forwardDirection);
+
+		if (glm::length(rightDirection) > 0.0f) {
+			rightDirection = glm::normalize(rightDirection);
+		}
+
+		pTransform->SetMatrixRow(TransformComponent::MATRIX_ROW_UP_VECTOR, upDirection);
+		pTransform->SetMatrixRow(TransformComponent::MATRIX_ROW_RIGHT_VECTOR, rightDirection);
+		pTransform->SetMatrixRow(TransformComponent::MATRIX_ROW_FORWARD_VECTOR, forwardDirection);
+		pTransform->SetMatrixRow(TransformComponent::MATRIX_ROW_POSITION_VECTOR, m_pFlockSystem->GetPosition(i));
+		Component* pModel = pEntity->GetComponentOfType(COMPONENT_TYPE_MODEL);
+
+		// The model copies its position from the transform when it's updated.
+		if (pModel) {
+			pModel->Update(a_fDeltaTime);
+		}
+	}
+}
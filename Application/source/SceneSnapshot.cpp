@@ -0,0 +1,236 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+// File's header.
+#include "SceneSnapshot.h"
+#include "DrawQueue.h"
+#include "Frustum.h"
+#include "glm/gtc/type_ptr.hpp"
+#include <cmath>
+#include <limits>
+
+SceneSnapshot::SceneSnapshot() : m_modelInstances(),
+	m_modelCells(),
+	m_cellModels(),
+	m_uncullableModels(),
+	m_cellCounts(),
+	m_lineBoxes(),
+	m_dTime(0.0),
+	m_dPreviousTime(0.0) {}
+
+void SceneSnapshot::Clear() {
+	m_modelInstances.clear();
+	m_modelCells.clear();
+	m_cellModels.clear();
+	m_uncullableModels.clear();
+	m_lineBoxes.clear();
+}
+
+void SceneSnapshot::AddModelInstance(PoolHandle a_entityHandle,
+	Model* a_pModel,
+	const glm::mat4& a_rModelMatrix,
+	const glm::vec3* a_pCullingExtents) {
+	ModelInstance instance;
+	instance.entityHandle = a_entityHandle;
+	instance.pModel = a_pModel;
+	instance.modelMatrix = a_rModelMatrix;
+	instance.previousPosition = glm::vec3(a_rModelMatrix[3]);
+	instance.cullingExtents = a_pCullingExtents ? *a_pCullingExtents : glm::vec3(0.0f);
+	instance.bCullable = a_pCullingExtents != nullptr;
+	m_modelInstances.push_back(instance);
+}
+
+void SceneSnapshot::AddLineBox(const BoundingBox<glm::vec3>& a_rBox,
+	const glm::vec3& a_rColour) {
+	LineBox lineBox;
+	lineBox.box = a_rBox;
+	lineBox.colour = a_rColour;
+	m_lineBoxes.push_back(lineBox);
+}
+
+void SceneSnapshot::SetPreviousStep(const SceneSnapshot& a_rPreviousSnapshot) {
+	const std::vector<ModelInstance>& rPreviousInstances = a_rPreviousSnapshot.m_modelInstances;
+	unsigned int previousIndex = 0;
+
+	for (ModelInstance& rInstance : m_modelInstances) {
+		// Both snapshots are sorted by entity slot, so the entity's previous position is never behind the last one
+		// that was found.
+		while (previousIndex < rPreviousInstances.size() &&
+			rPreviousInstances[previousIndex].entityHandle.uiIndex < rInstance.entityHandle.uiIndex) {
+			++previousIndex;
+		}
+
+		// Entities that have only just been added to the scene keep their current position.
+		if (previousIndex < rPreviousInstances.size() &&
+			rPreviousInstances[previousIndex].entityHandle == rInstance.entityHandle) {
+			rInstance.previousPosition = glm::vec3(rPreviousInstances[previousIndex].modelMatrix[3]);
+		}
+	}
+
+	m_dPreviousTime = a_rPreviousSnapshot.m_dTime;
+	GroupModelsByCell();
+}
+
+unsigned int SceneSnapshot::Draw(DrawQueue* a_pDrawQueue,
+	float a_fInterpolation,
+	const Frustum* a_pViewFrustum) const {
+	if (!a_pDrawQueue) {
+		return 0;
+	}
+
+	for (const LineBox& rLineBox : m_lineBoxes) {
+		a_pDrawQueue->AddLineBox(&rLineBox.box.GetPosition().x,
+			&rLineBox.box.GetDimensions().x,
+			&rLineBox.colour.x);
+	}
+
+	unsigned int drawnInstanceCount = 0;
+
+	if (m_modelCells.empty() && m_uncullableModels.empty()) {
+		// The models haven't been grouped into cells, so each one is tested on its own.
+		for (const ModelInstance& rInstance : m_modelInstances) {
+			drawnInstanceCount += DrawModelInstance(a_pDrawQueue,
+				rInstance,
+				a_fInterpolation,
+				rInstance.bCullable ? a_pViewFrustum : nullptr);
+		}
+	} else {
+		for (unsigned int model : m_uncullableModels) {
+			drawnInstanceCount += DrawModelInstance(a_pDrawQueue, m_modelInstances[model], a_fInterpolation, nullptr);
+		}
+
+		for (const ModelCell& rCell : m_modelCells) {
+			const Frustum::CONTAINMENT containment = a_pViewFrustum ?
+				a_pViewFrustum->Classify(rCell.bounds) :
+				Frustum::CONTAINMENT_INSIDE;
+
+			if (containment == Frustum::CONTAINMENT_OUTSIDE) {
+				continue;
+			}
+
+			// Only the models in cells that cross the edge of the view need testing one at a time.
+			const Frustum* pModelFrustum = containment == Frustum::CONTAINMENT_INSIDE ? nullptr : a_pViewFrustum;
+
+			for (unsigned int i = rCell.uiFirstModel; i < rCell.uiFirstModel + rCell.uiModelCount; ++i) {
+				drawnInstanceCount += DrawModelInstance(a_pDrawQueue,
+					m_modelInstances[m_cellModels[i]],
+					a_fInterpolation,
+					pModelFrustum);
+			}
+		}
+	}
+
+	a_pDrawQueue->DrawModelInstances();
+	a_pDrawQueue->DrawLines();
+	return drawnInstanceCount;
+}
+
+void SceneSnapshot::GroupModelsByCell() {
+	m_modelCells.clear();
+	m_cellModels.clear();
+	m_uncullableModels.clear();
+	glm::vec3 minimum(0.0f);
+	glm::vec3 maximum(0.0f);
+	unsigned int cullableCount = 0;
+
+	for (unsigned int i = 0; i < m_modelInstances.size(); ++i) {
+		const ModelInstance& rInstance = m_modelInstances[i];
+
+		if (!rInstance.bCullable) {
+			m_uncullableModels.push_back(i);
+			continue;
+		}
+
+		const glm::vec3 position(rInstance.modelMatrix[3]);
+		minimum = cullableCount == 0 ? position : glm::min(minimum, position);
+		maximum = cullableCount == 0 ? position : glm::max(maximum, position);
+		++cullableCount;
+	}
+
+	if (cullableCount == 0) {
+		return;
+	}
+
+	// Cells are cubes, sized so that a grid of them over the models' volume holds about the same number of models in
+	// each cell if the models are spread evenly.
+	const unsigned int cellsPerAxis = glm::clamp(static_cast<unsigned int>(std::ceil(
+		std::cbrt(static_cast<float>(cullableCount) / msc_uiModelsPerCell))),
+		1u,
+		msc_uiMaximumCellsPerAxis);
+	const glm::vec3 cellSize = glm::max(maximum - minimum, glm::vec3(1e-3f)) / static_cast<float>(cellsPerAxis);
+	m_cellCounts.assign(cellsPerAxis * cellsPerAxis * cellsPerAxis, 0);
+	m_cellModels.resize(cullableCount);
+	auto getCell = [&minimum, &cellSize, cellsPerAxis](const glm::vec3& a_rPosition) {
+		const glm::ivec3 cell = glm::clamp(glm::ivec3((a_rPosition - minimum) / cellSize),
+			glm::ivec3(0),
+			glm::ivec3(cellsPerAxis - 1));
+		return (cell.z * cellsPerAxis + cell.y) * cellsPerAxis + cell.x;
+	};
+
+	for (const ModelInstance& rInstance : m_modelInstances) {
+		if (rInstance.bCullable) {
+			++m_cellCounts[getCell(glm::vec3(rInstance.modelMatrix[3]))];
+		}
+	}
+
+	// Turns each cell's count into where its models start, then places each model after the ones before it.
+	unsigned int modelCount = 0;
+
+	for (unsigned int cell = 0; cell < m_cellCounts.size(); ++cell) {
+		const unsigned int cellModelCount = m_cellCounts[cell];
+		m_cellCounts[cell] = modelCount;
+
+		if (cellModelCount > 0) {
+			ModelCell modelCell;
+			modelCell.uiFirstModel = modelCount;
+			modelCell.uiModelCount = cellModelCount;
+			m_modelCells.push_back(modelCell);
+		}
+
+		modelCount += cellModelCount;
+	}
+
+	for (unsigned int i = 0; i < m_modelInstances.size(); ++i) {
+		if (m_modelInstances[i].bCullable) {
+			m_cellModels[m_cellCounts[getCell(glm::vec3(m_modelInstances[i].modelMatrix[3]))]++] = i;
+		}
+	}
+
+	// Fits each cell around its models where they were in the previous step as well as where they are now.
+	for (ModelCell& rCell : m_modelCells) {
+		glm::vec3 cellMinimum(std::numeric_limits<float>::max());
+		glm::vec3 cellMaximum(-std::numeric_limits<float>::max());
+
+		for (unsigned int i = rCell.uiFirstModel; i < rCell.uiFirstModel + rCell.uiModelCount; ++i) {
+			const ModelInstance& rInstance = m_modelInstances[m_cellModels[i]];
+			const glm::vec3 position(rInstance.modelMatrix[3]);
+			cellMinimum = glm::min(cellMinimum,
+				glm::min(position, rInstance.previousPosition) - rInstance.cullingExtents);
+			cellMaximum = glm::max(cellMaximum,
+				glm::max(position, rInstance.previousPosition) + rInstance.cullingExtents);
+		}
+
+		rCell.bounds = BoundingBox<glm::vec3>((cellMinimum + cellMaximum) * 0.5f, (cellMaximum - cellMinimum) * 0.5f);
+	}
+}
+
+bool SceneSnapshot::DrawModelInstance(DrawQueue* a_pDrawQueue,
+	const ModelInstance& a_rInstance,
+	float a_fInterpolation,
+	const Frustum* a_pViewFrustum) const {
+	glm::mat4 modelMatrix = a_rInstance.modelMatrix;
+	const glm::vec3 position = a_rInstance.previousPosition +
+		(glm::vec3(a_rInstance.modelMatrix[3]) - a_rInstance.previousPosition) * a_fInterpolation;
+	modelMatrix[3] = glm::vec4(position, 1.0f);
+
+	if (a_pViewFrustum &&
+		a_pViewFrustum->Classify(BoundingBox<glm::vec3>(position, a_rInstance.cullingExtents)) ==
+		Frustum::CONTAINMENT_OUTSIDE) {
+		return false;
+	}
+
+	a_pDrawQueue->AddModelInstance(a_rInstance.pModel, glm::value_ptr(modelMatrix));
+	return true;
+}
@@ -0,0 +1,191 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+// File's header.
+#include "SweepAndPrune.h"
+#include "ColliderComponent.h"
+#include "StaggeredSchedule.h"
+#include <algorithm>
+
+SweepAndPrune::SweepAndPrune() : m_proxies(),
+	m_endpoints(),
+	m_activeProxies(),
+	m_uiColliderCount(0),
+	m_uiSortAxis(0),
+	m_uiSwapCount(0),
+	m_bHasNewColliders(false),
+	m_bHasRemovedColliders(false) {}
+
+void SweepAndPrune::AddCollider(unsigned int a_uiID,
+	ColliderComponent* a_pCollider,
+	PoolHandle a_entityHandle) {
+	if (!a_pCollider) {
+		return;
+	}
+
+	// A removed collider's ends have to be gone before its ID can be reused.
+	if (m_bHasRemovedColliders) {
+		RemoveStaleEndpoints();
+	}
+
+	if (a_uiID >= m_proxies.size()) {
+		Proxy emptyProxy = {};
+		m_proxies.resize(a_uiID + 1, emptyProxy);
+	} else if (m_proxies[a_uiID].pCollider) {
+		return;
+	}
+
+	const BoundingBox<glm::vec3> bounds = a_pCollider->GetBoundary()->GetBoundingBox();
+	Proxy& rProxy = m_proxies[a_uiID];
+	rProxy.pCollider = a_pCollider;
+	rProxy.entityHandle = a_entityHandle;
+	rProxy.minimum = bounds.GetPosition() - bounds.GetDimensions();
+	rProxy.maximum = bounds.GetPosition() + bounds.GetDimensions();
+	rProxy.uiActiveIndex = 0;
+	rProxy.bDue = true;
+	const Endpoint lowerEnd = { rProxy.minimum[m_uiSortAxis], a_uiID << 1 };
+	const Endpoint upperEnd = { rProxy.maximum[m_uiSortAxis], (a_uiID << 1) | 1 };
+	m_endpoints.push_back(lowerEnd);
+	m_endpoints.push_back(upperEnd);
+	++m_uiColliderCount;
+	m_bHasNewColliders = true;
+}
+
+bool SweepAndPrune::RemoveCollider(unsigned int a_uiID) {
+	if (a_uiID >= m_proxies.size() || !m_proxies[a_uiID].pCollider) {
+		return false;
+	}
+
+	// The collider's ends are dropped in one pass once every collider that's being removed has been.
+	m_proxies[a_uiID].pCollider = nullptr;
+	--m_uiColliderCount;
+	m_bHasRemovedColliders = true;
+	return true;
+}
+
+void SweepAndPrune::Update(ContactCache& a_rContacts,
+	const StaggeredSchedule* a_pSchedule,
+	unsigned int a_uiTick) {
+	m_uiSwapCount = 0;
+
+	if (m_bHasRemovedColliders) {
+		RemoveStaleEndpoints();
+	}
+
+	for (Proxy& rProxy : m_proxies) {
+		if (rProxy.pCollider) {
+			const BoundingBox<glm::vec3> bounds = rProxy.pCollider->GetBoundary()->GetBoundingBox();
+			rProxy.minimum = bounds.GetPosition() - bounds.GetDimensions();
+			rProxy.maximum = bounds.GetPosition() + bounds.GetDimensions();
+			rProxy.bDue = !a_pSchedule || a_pSchedule->IsDue(a_uiTick, rProxy.entityHandle.uiIndex);
+		}
+	}
+
+	const bool unsorted = ChooseSortAxis() || m_bHasNewColliders;
+	m_bHasNewColliders = false;
+
+	for (Endpoint& rEndpoint : m_endpoints) {
+		const Proxy& rProxy = m_proxies[rEndpoint.uiData >> 1];
+		rEndpoint.fValue = (rEndpoint.uiData & 1) ? rProxy.maximum[m_uiSortAxis] : rProxy.minimum[m_uiSortAxis];
+	}
+
+	if (unsorted) {
+		// New ends could be anywhere, so an insertion sort could have to move each one past every other.
+		std::sort(m_endpoints.begin(), m_endpoints.end(), &SweepAndPrune::IsBefore);
+	} else {
+		// The colliders have barely moved since the last update, so each end only needs moving past a few others.
+		for (unsigned int i = 1; i < m_endpoints.size(); ++i) {
+			const Endpoint endpoint = m_endpoints[i];
+			unsigned int j = i;
+
+			while (j > 0 && IsBefore(endpoint, m_endpoints[j - 1])) {
+				m_endpoints[j] = m_endpoints[j - 1];
+				--j;
+			}
+
+			m_endpoints[j] = endpoint;
+			m_uiSwapCount += i - j;
+		}
+	}
+
+	// Sweep along the axis, testing each collider that starts against the ones the sweep is still inside of.
+	m_activeProxies.clear();
+
+	for (const Endpoint& rEndpoint : m_endpoints) {
+		const unsigned int id = rEndpoint.uiData >> 1;
+		Proxy& rProxy = m_proxies[id];
+
+		if (rEndpoint.uiData & 1) {
+			// Fill the collider's place with the last active collider.
+			const ActiveProxy& rLastProxy = m_activeProxies.back();
+			m_proxies[rLastProxy.uiID].uiActiveIndex = rProxy.uiActiveIndex;
+			m_activeProxies[rProxy.uiActiveIndex] = rLastProxy;
+			m_activeProxies.pop_back();
+			continue;
+		}
+
+		for (const ActiveProxy& rOtherProxy : m_activeProxies) {
+			// Few pairs overlap, so every axis is tested without branching rather than stopping at the first that
+			// doesn't. Pairs of colliders that aren't due are kept by the contact cache as they were.
+			const bool overlapping = (rProxy.minimum.x <= rOtherProxy.maximum.x) & (rProxy.maximum.x >= rOtherProxy.minimum.x) &
+				(rProxy.minimum.y <= rOtherProxy.maximum.y) & (rProxy.maximum.y >= rOtherProxy.minimum.y) &
+				(rProxy.minimum.z <= rOtherProxy.maximum.z) & (rProxy.maximum.z >= rOtherProxy.minimum.z) &
+				(rProxy.bDue | rOtherProxy.bDue);
+
+			if (overlapping) {
+				a_rContacts.AddContact(rOtherProxy.entityHandle, rProxy.entityHandle);
+			}
+		}
+
+		const ActiveProxy activeProxy = { id, rProxy.entityHandle, rProxy.minimum, rProxy.maximum, rProxy.bDue };
+		rProxy.uiActiveIndex = m_activeProxies.size();
+		m_activeProxies.push_back(activeProxy);
+	}
+}
+
+bool SweepAndPrune::ChooseSortAxis() {
+	if (m_uiColliderCount < 2) {
+		return false;
+	}
+
+	glm::vec3 sum(0.0f);
+	glm::vec3 squaredSum(0.0f);
+
+	for (const Proxy& rProxy : m_proxies) {
+		if (rProxy.pCollider) {
+			const glm::vec3 centre = (rProxy.minimum + rProxy.maximum) * 0.5f;
+			sum += centre;
+			squaredSum += centre * centre;
+		}
+	}
+
+	const glm::vec3 mean = sum / static_cast<float>(m_uiColliderCount);
+	const glm::vec3 variance = squaredSum / static_cast<float>(m_uiColliderCount) - mean * mean;
+	unsigned int widestAxis = 0;
+
+	for (unsigned int i = 1; i < 3; ++i) {
+		if (variance[i] > variance[widestAxis]) {
+			widestAxis = i;
+		}
+	}
+
+	// How much further the colliders must be spread along another axis before it's sorted along instead. Colliders
+	// that are spread evenly would otherwise switch axis, and be sorted from scratch, on almost every update.
+	const float switchRatio = 1.5f;
+
+	if (widestAxis == m_uiSortAxis || variance[widestAxis] <= variance[m_uiSortAxis] * switchRatio) {
+		return false;
+	}
+
+	m_uiSortAxis = widestAxis;
+	return true;
+}
+
+void SweepAndPrune::RemoveStaleEndpoints() {
+	m_endpoints.erase(std::remove_if(m_endpoints.begin(), m_endpoints.end(), [this](const Endpoint& a_rEndpoint) {
+		return !m_proxies[a_rEndpoint.uiData >> 1].pCollider;
+	}), m_endpoints.end());
+	m_bHasRemovedColliders = false;
+}
@@ -0,0 +1,112 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+// File's header.
+#include "ThreadPool.h"
+
+ThreadPool::ThreadPool(unsigned int a_uiThreadCount) : m_bStopping(false),
+	m_uiLoopNumber(0),
+	m_uiBusyWorkers(0),
+	m_task(nullptr),
+	m_pUserData(nullptr),
+	m_uiCount(0),
+	m_uiRangeSize(1),
+	m_uiNextRange(0),
+	m_mutex(),
+	m_loopStarted(),
+	m_loopFinished(),
+	m_workers() {
+	if (a_uiThreadCount == 0) {
+		a_uiThreadCount = std::thread::hardware_concurrency();
+	}
+
+	// The thread that starts each loop also runs it, so it doesn't need a worker of its own.
+	for (unsigned int i = 1; i < a_uiThreadCount; ++i) {
+		m_workers.push_back(std::thread(&ThreadPool::RunWorker, this));
+	}
+}
+
+ThreadPool::~ThreadPool() {
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_bStopping = true;
+	}
+
+	m_loopStarted.notify_all();
+
+	for (std::thread& rWorker : m_workers) {
+		rWorker.join();
+	}
+}
+
+void ThreadPool::ParallelFor(unsigned int a_uiCount,
+	Task a_task,
+	void* a_pUserData) {
+	if (a_uiCount == 0 || !a_task) {
+		return;
+	}
+
+	if (m_workers.empty()) {
+		a_task(0, a_uiCount, a_pUserData);
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_task = a_task;
+		m_pUserData = a_pUserData;
+		m_uiCount = a_uiCount;
+		// Several ranges for each thread lets threads that finish early take work from ones that are slower.
+		const unsigned int rangesPerThread = 4;
+		m_uiRangeSize = (a_uiCount + GetThreadCount() * rangesPerThread - 1) / (GetThreadCount() * rangesPerThread);
+		m_uiNextRange = 0;
+		m_uiBusyWorkers = m_workers.size();
+		++m_uiLoopNumber;
+	}
+
+	m_loopStarted.notify_all();
+	RunRanges();
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_loopFinished.wait(lock, [this]() {
+		return m_uiBusyWorkers == 0;
+	});
+}
+
+void ThreadPool::RunWorker() {
+	unsigned int lastLoopNumber = 0;
+	std::unique_lock<std::mutex> lock(m_mutex);
+
+	while (true) {
+		m_loopStarted.wait(lock, [this, lastLoopNumber]() {
+			return m_bStopping || m_uiLoopNumber != lastLoopNumber;
+		});
+
+		if (m_bStopping) {
+			return;
+		}
+
+		lastLoopNumber = m_uiLoopNumber;
+		lock.unlock();
+		RunRanges();
+		lock.lock();
+
+		if (--m_uiBusyWorkers == 0) {
+			m_loopFinished.notify_one();
+		}
+	}
+}
+
+void ThreadPool::RunRanges() {
+	while (true) {
+		const unsigned int begin = m_uiNextRange.fetch_add(1) * m_uiRangeSize;
+
+		if (begin >= m_uiCount) {
+			return;
+		}
+
+		const unsigned int end = begin + m_uiRangeSize < m_uiCount ? begin + m_uiRangeSize : m_uiCount;
+		m_task(begin, end, m_pUserData);
+	}
+}
@@ -5,7 +5,7 @@
 
 // File's header.
 #include "TransformComponent.h"
-#include "LearnOpenGL/shader.h"
+#include "Scene.h"
 
 // Typedefs.
 typedef Component Parent;
@@ -21,6 +21,11 @@ TransformComponent::TransformComponent(Entity* a_pOwner,
 	m_componentType = a_rTransformToCopy.m_componentType;
 }
 
+Component* TransformComponent::Clone(Entity* a_pOwner,
+	Scene* a_pScene) {
+	return a_pScene->CreateComponent<TransformComponent>(a_pOwner, *this);
+}
+
 void TransformComponent::SetMatrixRow(MATRIX_ROW a_row, glm::vec3 a_vector) {
 	m_matrix[a_row] = glm::vec4(a_vector,
 		(a_row == MATRIX_ROW_POSITION_VECTOR ? 1.0f : 0.0f));
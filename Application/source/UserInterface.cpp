@@ -11,6 +11,10 @@
 #include "BrainComponent.h"
 #include "ColliderComponent.h"
 #include "Entity.h"
+#include "Framework.h"
+#include "Scene.h"
+#include <cfloat>
+#include <vector>
 
 void UserInterface::Draw() const {
 	// Start the Dear ImGui frame
@@ -30,6 +34,8 @@ void UserInterface::Draw() const {
 		ImGui::NewLine();
 		DrawBoidControls();
 		ImGui::NewLine();
+		DrawRenderingControls();
+		ImGui::NewLine();
 		DrawTimeControls();
 	}
 
@@ -74,9 +80,30 @@ void UserInterface::DrawBoidControls() const {
 	ImGui::SliderFloat("Wander Force", &wanderForce, minimumForceMultiplier, maximumForceMultiplier);
 	BrainComponent::SetWanderForce(wanderForce);
 
+	// Topological boids steer by a fixed number of their nearest boids, however spread out the flock is, rather than
+	// by every boid within a fixed distance.
+	bool topologicalNeighbourhood = BrainComponent::GetNeighbourhoodType() == BrainComponent::NEIGHBOURHOOD_TYPE_TOPOLOGICAL;
+	ImGui::Checkbox("Topological Neighbours", &topologicalNeighbourhood);
+	BrainComponent::SetNeighbourhoodType(topologicalNeighbourhood ? BrainComponent::NEIGHBOURHOOD_TYPE_TOPOLOGICAL :
+		BrainComponent::NEIGHBOURHOOD_TYPE_METRIC);
+
+	if (topologicalNeighbourhood) {
+		const int minimumNeighbourCount = 1;
+		const int maximumNeighbourCount = 20;
+		int neighbourCount = static_cast<int>(BrainComponent::GetTopologicalNeighbourCount());
+		ImGui::SliderInt("Nearest Neighbours", &neighbourCount, minimumNeighbourCount, maximumNeighbourCount);
+		BrainComponent::SetTopologicalNeighbourCount(static_cast<unsigned int>(neighbourCount));
+	}
+
 	bool drawColliders = ColliderComponent::GetColliderDrawState();
 	ImGui::Checkbox("Draw Colliders", &drawColliders);
 	ColliderComponent::SetColliderDrawState(drawColliders);
+
+	// Draws every boid that shares a model with one draw call for each of its meshes, rather than one per boid.
+	Framework* pFramework = Framework::GetInstance();
+	bool instancedRendering = pFramework->GetInstancedRenderingState();
+	ImGui::Checkbox("Instanced Rendering", &instancedRendering);
+	pFramework->SetInstancedRenderingState(instancedRendering);
 }
 
 void UserInterface::DrawPhysicsControls() const {
@@ -85,6 +112,91 @@ void UserInterface::DrawPhysicsControls() const {
 	bool collisionsOn = Entity::GetCollisionsState();
 	ImGui::Checkbox("Boid Collisions On", &collisionsOn);
 	Entity::SetCollisionsState(collisionsOn);
+
+	if (!m_pApplication || !m_pApplication->GetScene()) {
+		return;
+	}
+
+	Scene* pScene = m_pApplication->GetScene();
+	// Shows how many collisions the broadphase found, and how much re-sorting the colliders' movement needed.
+	const SweepAndPrune& rBroadphase = pScene->GetBroadphase();
+	const ContactCache& rContacts = pScene->GetContacts();
+	const char* axisNames[] = { "X", "Y", "Z" };
+	ImGui::Text("Colliders: %u  Collisions: %u  Sort Axis: %s  Swaps: %u",
+		rBroadphase.GetColliderCount(),
+		rContacts.GetContactCount(),
+		axisNames[rBroadphase.GetSortAxis()],
+		rBroadphase.GetSwapCount());
+	ImGui::Text("Contacts Begun: %u  Stayed: %u  Ended: %u",
+		rContacts.GetEventCount(ContactCache::CONTACT_EVENT_TYPE_BEGIN),
+		rContacts.GetEventCount(ContactCache::CONTACT_EVENT_TYPE_STAY),
+		rContacts.GetEventCount(ContactCache::CONTACT_EVENT_TYPE_END));
+
+	// Boids that are moved by a flock system find their neighbours without the spatial index.
+	if (!pScene->GetFlockSystem()) {
+		bool useNeighbourLists = pScene->GetNeighbourListState();
+		ImGui::Checkbox("Neighbour Lists", &useNeighbourLists);
+		pScene->SetNeighbourListState(useNeighbourLists);
+
+		if (useNeighbourLists) {
+			const NeighbourList& rNeighbourList = pScene->GetNeighbourList();
+			ImGui::Text("Rebuilds: %u of %u checks (%.1f%%)",
+				rNeighbourList.GetBuildCount(),
+				rNeighbourList.GetUpdateCount(),
+				rNeighbourList.GetRebuildRate() * 100.0f);
+		}
+
+		// Only oct-trees keep totals for each of their areas.
+		if (pScene->GetOctTree()) {
+			bool useCellAggregates = pScene->GetCellAggregateState();
+			ImGui::Checkbox("Cell Aggregates", &useCellAggregates);
+			pScene->SetCellAggregateState(useCellAggregates);
+
+			if (useCellAggregates) {
+				// Wider angles perceive nearer areas of boids through their totals, which is faster but less accurate.
+				const float maximumOpeningAngle = 1.5f;
+				float openingAngle = pScene->GetOpeningAngle();
+				ImGui::SliderFloat("Opening Angle", &openingAngle, 0.0f, maximumOpeningAngle);
+				pScene->SetOpeningAngle(openingAngle);
+				const float minimumPerceptionDistance = 8.0f;
+				const float maximumPerceptionDistance = 64.0f;
+				float perceptionDistance = BrainComponent::GetPerceptionDistance();
+				ImGui::SliderFloat("Perception Distance",
+					&perceptionDistance,
+					minimumPerceptionDistance,
+					maximumPerceptionDistance);
+				BrainComponent::SetPerceptionDistance(perceptionDistance);
+			}
+		}
+	}
+
+	// Only oct-trees can change how they're updated.
+	if (pScene->GetSpatialIndexType() != Scene::SPATIAL_INDEX_TYPE_OCT_TREE) {
+		return;
+	}
+
+	// Rebuilding the oct-tree each frame keeps it balanced, whereas refitting it only moves the entities that have
+	// left their area.
+	bool rebuildOctTree = pScene->GetOctTreeUpdateMode() == OctTree<Entity, glm::vec3>::UPDATE_MODE_REBUILD;
+	ImGui::Checkbox("Rebuild Oct-Tree Each Frame", &rebuildOctTree);
+	pScene->SetOctTreeUpdateMode(rebuildOctTree ? OctTree<Entity, glm::vec3>::UPDATE_MODE_REBUILD :
+		OctTree<Entity, glm::vec3>::UPDATE_MODE_REFIT);
+}
+
+void UserInterface::DrawRenderingControls() const {
+	if (!m_pApplication || !m_pApplication->GetScene()) {
+		return;
+	}
+
+	// UI section header.
+	ImGui::Text("Rendering");
+	Scene* pScene = m_pApplication->GetScene();
+
+	// Skips drawing the entities that are outside of the camera's view.
+	bool frustumCulling = pScene->GetFrustumCullingState();
+	ImGui::Checkbox("Frustum Culling", &frustumCulling);
+	pScene->SetFrustumCullingState(frustumCulling);
+	ImGui::Text("Drawn: %u  Culled: %u", m_pApplication->GetDrawnEntityCount(), m_pApplication->GetCulledEntityCount());
 }
 
 void UserInterface::DrawTimeControls() const {
@@ -99,6 +211,64 @@ void UserInterface::DrawTimeControls() const {
 	ImGui::Checkbox("Paused", &applicationPaused);
 	m_pApplication->SetPauseState(applicationPaused);
 
-	bool updateOnce = ImGui::Button("Update Once", ImVec2(100, 20));
-	m_pApplication->SetUpdateOnceState(updateOnce);
+	// Only set when clicked, as the simulation may run on another thread and not have updated since the last click.
+	if (ImGui::Button("Update Once", ImVec2(100, 20))) {
+		m_pApplication->SetUpdateOnceState(true);
+	}
+
+	if (!m_pApplication->GetScene()) {
+		return;
+	}
+
+	// The scene moves in fixed steps, so changing the tick rate changes how smoothly and how expensively it's
+	// simulated, but not how it behaves.
+	Scene* pScene = m_pApplication->GetScene();
+	const FixedTimestep& rClock = pScene->GetClock();
+	const int minimumTickRate = 10;
+	const int maximumTickRate = 240;
+	int tickRate = static_cast<int>(rClock.GetTickRate() + 0.5f);
+	ImGui::SliderInt("Tick Rate", &tickRate, minimumTickRate, maximumTickRate);
+	pScene->SetTickRate(static_cast<float>(tickRate));
+	const int maximumStepCount = 10;
+	int stepCount = static_cast<int>(rClock.GetMaximumStepCount());
+	ImGui::SliderInt("Max Steps Per Frame", &stepCount, 1, maximumStepCount);
+	pScene->SetMaximumStepCount(static_cast<unsigned int>(stepCount));
+	ImGui::Text("Tick: %u  Alpha: %.2f", rClock.GetTickCount(), rClock.GetAlpha());
+
+	// Splitting the boids into groups that steer on different steps spreads the cost of steering evenly, instead
+	// of every boid steering on the same step.
+	int bucketCount = static_cast<int>(pScene->GetReevaluationBucketCount());
+	ImGui::SliderInt("Steering Groups", &bucketCount, 1, static_cast<int>(pScene->GetReevaluationInterval()));
+	pScene->SetReevaluationBucketCount(static_cast<unsigned int>(bucketCount));
+
+	// Shows how many steps took each range of times, so that slow steps stand out.
+	const FrameTimeHistogram& rStepTimes = pScene->GetStepTimes();
+	const std::vector<unsigned int>& rBins = rStepTimes.GetBins();
+	std::vector<float> binHeights(rBins.begin(), rBins.end());
+	ImGui::PlotHistogram("Step Times",
+		binHeights.data(),
+		static_cast<int>(binHeights.size()),
+		0,
+		nullptr,
+		0.0f,
+		FLT_MAX,
+		ImVec2(0, 60));
+	ImGui::Text("Mean: %.2f ms  p99: %.2f ms  Max: %.2f ms",
+		rStepTimes.GetMeanTime(),
+		rStepTimes.GetPercentile(99.0f),
+		rStepTimes.GetMaximumTime());
+
+	// Shows which stages of each step the time goes to.
+	for (unsigned int i = 0; i < Scene::UPDATE_STAGE_COUNT; ++i) {
+		const Scene::UPDATE_STAGE stage = static_cast<Scene::UPDATE_STAGE>(i);
+		const FrameTimeHistogram& rStageTimes = pScene->GetStageTimes(stage);
+		ImGui::Text("%s: %.2f ms  Max: %.2f ms",
+			Scene::GetUpdateStageName(stage),
+			rStageTimes.GetMeanTime(),
+			rStageTimes.GetMaximumTime());
+	}
+
+	if (ImGui::Button("Reset Step Times", ImVec2(150, 20))) {
+		pScene->ClearStepTimes();
+	}
 }
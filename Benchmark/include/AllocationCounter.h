@@ -0,0 +1,24 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 17/10/2026
+//////////////////////////////
+
+#ifndef ALLOCATION_COUNTER_H
+#define ALLOCATION_COUNTER_H
+
+// Header includes.
+#include <cstddef>
+
+/// <summary>
+/// Counts every heap allocation that's made through the global new operators, so benchmarks can report how many
+/// allocations the code they measure makes.
+/// </summary>
+namespace AllocationCounter {
+	/// <summary>
+	/// Returns the number of heap allocations that have been made since the program started.
+	/// </summary>
+	/// <returns> The number of heap allocations. </returns>
+	std::size_t GetAllocationCount();
+}
+
+#endif // !ALLOCATION_COUNTER_H
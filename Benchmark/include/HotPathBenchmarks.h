@@ -0,0 +1,25 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+#ifndef HOT_PATH_BENCHMARKS_H
+#define HOT_PATH_BENCHMARKS_H
+
+// Forward declarations.
+class BenchmarkSuite;
+
+/// <summary>
+/// Micro-benchmarks for the code that runs for every boid, every frame: inserting into and querying the oct-tree,
+/// testing boundaries for overlaps, steering boids with their brains, and registering their collisions.
+/// </summary>
+namespace HotPathBenchmarks {
+	/// <summary>
+	/// Adds every hot path benchmark to a suite, each with boid counts from 100 to 100,000 and a range of densities
+	/// and neighbour distances.
+	/// </summary>
+	/// <param name="a_rSuite"> The suite to add the benchmarks to. </param>
+	void Register(BenchmarkSuite& a_rSuite);
+}
+
+#endif // !HOT_PATH_BENCHMARKS_H
@@ -0,0 +1,219 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+#ifndef MICRO_BENCHMARK_H
+#define MICRO_BENCHMARK_H
+
+// Header includes.
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <ctime>
+#include <string>
+#include <utility>
+#include <vector>
+
+/// <summary>
+/// The size and shape of the flock that a micro-benchmark is run with.
+/// </summary>
+struct BenchmarkParameters {
+	/// <summary>
+	/// Returns the width, height, and depth of a cube that holds every boid at the benchmark's density, as measured
+	/// outward from its centre.
+	/// </summary>
+	float GetSceneExtent() const;
+	/// <summary>
+	/// Returns the parameters written the way they appear in a benchmark's name, e.g. "boids:1000/density:10/distance:8".
+	/// </summary>
+	std::string GetName() const;
+
+	unsigned int uiBoidCount;
+	/// <summary>
+	/// The number of boids in every 1,000 cubic units of the scene.
+	/// </summary>
+	float fDensity;
+	/// <summary>
+	/// The distance from a boid to the edge of its neighbourhood along each axis.
+	/// </summary>
+	float fNeighbourDistance;
+};
+
+/// <summary>
+/// Controls and times a single run of a micro-benchmark, in the same way as Google Benchmark's state.
+/// Anything a benchmark does before its first call to KeepRunning isn't timed.
+/// </summary>
+class BenchmarkState {
+public:
+	BenchmarkState(const BenchmarkParameters& a_rParameters,
+		std::size_t a_uiIterationCount);
+	~BenchmarkState() {}
+
+	/// <summary>
+	/// Starts the timer on the first call, then returns true until the benchmark has run every iteration.
+	/// </summary>
+	/// <returns> True if the benchmark should run another iteration. </returns>
+	bool KeepRunning();
+	/// <summary>
+	/// Stops timing work that shouldn't be measured, such as tearing down an iteration.
+	/// </summary>
+	void PauseTiming();
+	void ResumeTiming();
+
+	/// <summary>
+	/// Sets the number of items, such as boids or queries, that each iteration processes.
+	/// </summary>
+	inline void SetItemsPerIteration(double a_dItemCount);
+	/// <summary>
+	/// Reports an extra value alongside the benchmark's timings. Benchmarks should report something computed from
+	/// their results, so that the measured work can't be optimised away.
+	/// </summary>
+	/// <param name="a_pName"> The value's name in the results. </param>
+	/// <param name="a_dValue"> The value. </param>
+	void SetCounter(const char* a_pName,
+		double a_dValue);
+
+	inline const BenchmarkParameters& GetParameters() const;
+	inline std::size_t GetIterationCount() const;
+	inline double GetItemsPerIteration() const;
+	/// <summary>
+	/// Returns the wall-clock time (in seconds) spent running the timed iterations.
+	/// </summary>
+	inline double GetRealTime() const;
+	/// <summary>
+	/// Returns the processor time (in seconds) that the program spent running the timed iterations.
+	/// </summary>
+	inline double GetCpuTime() const;
+	inline const std::vector<std::pair<std::string, double>>& GetCounters() const;
+
+private:
+	typedef std::chrono::steady_clock Clock;
+
+	bool m_bTiming;
+	std::size_t m_uiIteration;
+	const std::size_t mc_uiIterationCount;
+	double m_dItemsPerIteration;
+	double m_dRealTime;
+	double m_dCpuTime;
+	Clock::time_point m_realStartTime;
+	std::clock_t m_cpuStartTime;
+	const BenchmarkParameters mc_parameters;
+	std::vector<std::pair<std::string, double>> m_counters;
+};
+
+void BenchmarkState::SetItemsPerIteration(double a_dItemCount) {
+	m_dItemsPerIteration = a_dItemCount;
+}
+
+const BenchmarkParameters& BenchmarkState::GetParameters() const {
+	return mc_parameters;
+}
+
+std::size_t BenchmarkState::GetIterationCount() const {
+	return mc_uiIterationCount;
+}
+
+double BenchmarkState::GetItemsPerIteration() const {
+	return m_dItemsPerIteration;
+}
+
+double BenchmarkState::GetRealTime() const {
+	return m_dRealTime;
+}
+
+double BenchmarkState::GetCpuTime() const {
+	return m_dCpuTime;
+}
+
+const std::vector<std::pair<std::string, double>>& BenchmarkState::GetCounters() const {
+	return m_counters;
+}
+
+/// <summary>
+/// Runs every registered micro-benchmark over its parameters, prints a line for each run, and can write the results
+/// as JSON in the same format as Google Benchmark, so results can be compared between commits by existing tools.
+/// </summary>
+class BenchmarkSuite {
+public:
+	typedef void (*BenchmarkFunction)(BenchmarkState& a_rState);
+
+	BenchmarkSuite();
+	~BenchmarkSuite() {}
+
+	/// <summary>
+	/// Adds a benchmark that's run once for every set of parameters.
+	/// </summary>
+	/// <param name="a_pName"> The benchmark's name, which the parameters are appended to. </param>
+	/// <param name="a_function"> Sets up and runs the benchmark. </param>
+	/// <param name="a_rParameters"> Every set of parameters to run the benchmark with. </param>
+	void Register(const char* a_pName,
+		BenchmarkFunction a_function,
+		const std::vector<BenchmarkParameters>& a_rParameters);
+	/// <summary>
+	/// Runs the benchmarks whose full names contain the filter, printing their results as they finish.
+	/// </summary>
+	/// <param name="a_pFilter"> Only benchmarks with this in their names are run. Every benchmark runs if it's
+	/// empty. </param>
+	/// <param name="a_pJsonFile"> Written with the results as JSON, or nullptr to skip writing them. </param>
+	void Run(const char* a_pFilter,
+		std::FILE* a_pJsonFile);
+
+	/// <summary>
+	/// Sets the least amount of time (in seconds) that each benchmark is timed for. The number of iterations grows
+	/// until a run takes at least this long.
+	/// </summary>
+	inline void SetMinimumTime(double a_dSeconds);
+	/// <summary>
+	/// Skips any run with more boids than this.
+	/// </summary>
+	inline void SetMaximumBoidCount(unsigned int a_uiBoidCount);
+
+private:
+	/// <summary>
+	/// The results of the final run of one benchmark with one set of parameters.
+	/// </summary>
+	struct Result {
+		std::string name;
+		BenchmarkParameters parameters;
+		std::size_t uiIterationCount;
+		/// <summary>
+		/// The wall-clock time (in nanoseconds) that each iteration took.
+		/// </summary>
+		double dRealTime;
+		/// <summary>
+		/// The processor time (in nanoseconds) that each iteration took.
+		/// </summary>
+		double dCpuTime;
+		double dItemsPerSecond;
+		std::vector<std::pair<std::string, double>> counters;
+	};
+
+	struct Benchmark {
+		std::string name;
+		BenchmarkFunction function;
+		std::vector<BenchmarkParameters> parameters;
+	};
+
+	/// <summary>
+	/// Runs a benchmark with more iterations each time, until a run takes at least the minimum time.
+	/// </summary>
+	Result RunBenchmark(const Benchmark& a_rBenchmark,
+		const BenchmarkParameters& a_rParameters) const;
+	void WriteJson(std::FILE* a_pJsonFile,
+		const std::vector<Result>& a_rResults) const;
+
+	double m_dMinimumTime;
+	unsigned int m_uiMaximumBoidCount;
+	std::vector<Benchmark> m_benchmarks;
+};
+
+void BenchmarkSuite::SetMinimumTime(double a_dSeconds) {
+	m_dMinimumTime = a_dSeconds;
+}
+
+void BenchmarkSuite::SetMaximumBoidCount(unsigned int a_uiBoidCount) {
+	m_uiMaximumBoidCount = a_uiBoidCount;
+}
+
+#endif // !MICRO_BENCHMARK_H
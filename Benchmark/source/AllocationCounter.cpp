@@ -0,0 +1,54 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 17/10/2026
+//////////////////////////////
+
+// File's header.
+#include "AllocationCounter.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+	std::atomic<std::size_t> allocationCount(0);
+
+	void* Allocate(std::size_t a_size) {
+		allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+		// Zero sized allocations must still return a unique pointer.
+		if (void* pMemory = std::malloc(a_size > 0 ? a_size : 1)) {
+			return pMemory;
+		}
+
+		throw std::bad_alloc();
+	}
+}
+
+std::size_t AllocationCounter::GetAllocationCount() {
+	return allocationCount.load(std::memory_order_relaxed);
+}
+
+// Replacements for the global new and delete operators, which are used by every allocation in the program.
+void* operator new(std::size_t a_size) {
+	return Allocate(a_size);
+}
+
+void* operator new[](std::size_t a_size) {
+	return Allocate(a_size);
+}
+
+void operator delete(void* a_pMemory) noexcept {
+	std::free(a_pMemory);
+}
+
+void operator delete[](void* a_pMemory) noexcept {
+	std::free(a_pMemory);
+}
+
+void operator delete(void* a_pMemory, std::size_t) noexcept {
+	std::free(a_pMemory);
+}
+
+void operator delete[](void* a_pMemory, std::size_t) noexcept {
+	std::free(a_pMemory);
+}
@@ -0,0 +1,644 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+// File's header.
+#include "HotPathBenchmarks.h"
+#include "BrainComponent.h"
+#include "Boundary.h"
+#include "BoundingBox.h"
+#include "ColliderComponent.h"
+#include "ContactCache.h"
+#include "Entity.h"
+#include "glm/glm.hpp"
+#include "LinearOctTree.h"
+#include "MicroBenchmark.h"
+#include "NeighbourList.h"
+#include "OctTree.h"
+#include "Scene.h"
+#include "SpatialHashGrid.h"
+#include "SpatialIndex.h"
+#include "SweepAndPrune.h"
+#include "TransformComponent.h"
+#include <cstdlib>
+#include <random>
+#include <utility>
+#include <vector>
+
+// Typedefs.
+typedef Boundary<glm::vec3> BoidBoundary;
+typedef OctTree<BoidBoundary, glm::vec3> BoidOctTree;
+typedef SpatialIndex<BoidBoundary, glm::vec3> BoidSpatialIndex;
+
+namespace {
+	/// <summary>
+	/// Matches the dimensions of a boid's collider.
+	/// </summary>
+	const glm::vec3 boidDimensions(0.33f, 0.15f, 0.33f);
+	/// <summary>
+	/// The amount of time (in seconds) that brains move their boids for, matching a step of the scene's clock.
+	/// </summary>
+	const float componentUpdateStep = 1.0f / 60.0f;
+	/// <summary>
+	/// The most boundary pairs that are tested for overlaps in each iteration, to keep the memory they need small
+	/// with large flocks.
+	/// </summary>
+	const std::size_t maximumOverlapPairCount = 1 << 20;
+
+	/// <summary>
+	/// Boids scattered randomly around a cube that's sized to fit them at the benchmark's density.
+	/// </summary>
+	struct ScatteredBoids {
+		ScatteredBoids(const BenchmarkParameters& a_rParameters) : extent(a_rParameters.GetSceneExtent()),
+			positions(),
+			boundaries() {
+			std::mt19937 randomGenerator(a_rParameters.uiBoidCount);
+			std::uniform_real_distribution<float> randomPosition(-extent, extent);
+			// Every boundary points at a position, so reserve the memory up front to keep the positions from moving.
+			positions.reserve(a_rParameters.uiBoidCount);
+			boundaries.reserve(a_rParameters.uiBoidCount);
+
+			for (unsigned int i = 0; i < a_rParameters.uiBoidCount; ++i) {
+				positions.push_back(glm::vec3(randomPosition(randomGenerator),
+					randomPosition(randomGenerator),
+					randomPosition(randomGenerator)));
+				boundaries.push_back(BoidBoundary(&positions.back(), boidDimensions));
+			}
+		}
+
+		float extent;
+		std::vector<glm::vec3> positions;
+		std::vector<BoidBoundary> boundaries;
+	};
+
+	/// <summary>
+	/// Creates a scene of boids that are moved by their own brain components, the same way as the application's
+	/// boids are when the flock system is turned off, or by the scene's flock system.
+	/// </summary>
+	Scene* CreateBoidScene(const BenchmarkParameters& a_rParameters,
+		bool a_bUseFlockSystem = false) {
+		// The brains wander using the standard random number generator.
+		srand(a_rParameters.uiBoidCount);
+		const float extent = a_rParameters.GetSceneExtent();
+		Scene* pScene = new Scene(Scene::SPATIAL_INDEX_TYPE_OCT_TREE, a_bUseFlockSystem, extent);
+		std::mt19937 randomGenerator(a_rParameters.uiBoidCount);
+		std::uniform_real_distribution<float> randomPosition(-extent, extent);
+
+		for (unsigned int i = 0; i < a_rParameters.uiBoidCount; ++i) {
+			Entity* pBoid = pScene->CreateEntity();
+			TransformComponent* pTransform = pScene->CreateComponent<TransformComponent>(pBoid);
+			pTransform->SetMatrixRow(TransformComponent::MATRIX_ROW_POSITION_VECTOR,
+				glm::vec3(randomPosition(randomGenerator),
+					randomPosition(randomGenerator),
+					randomPosition(randomGenerator)));
+			pBoid->AddComponent(COMPONENT_TYPE_TRANSFORM, static_cast<Component*>(pTransform));
+			ColliderComponent* pCollider = pScene->CreateComponent<ColliderComponent>(pBoid);
+			pCollider->SetDimensions(boidDimensions);
+			pBoid->AddComponent(COMPONENT_TYPE_COLLIDER, pCollider);
+			BrainComponent* pBrain = pScene->CreateComponent<BrainComponent>(pBoid, pScene);
+			pBoid->AddComponent(COMPONENT_TYPE_BRAIN, static_cast<Component*>(pBrain));
+			pBoid->SetTag("Boid");
+			pScene->AddEntity(pBoid);
+		}
+
+		// Builds the spatial index without moving any boids.
+		pScene->Step(0.0f, false);
+		return pScene;
+	}
+
+	/// <summary>
+	/// Collects one type of component from every entity in a scene.
+	/// </summary>
+	template <typename TComponent>
+	std::vector<TComponent*> GetComponents(const Scene& a_rScene,
+		COMPONENT_TYPE a_componentType) {
+		std::vector<TComponent*> components;
+
+		for (const Archetype& rArchetype : a_rScene.GetArchetypes()) {
+			for (Component* pComponent : rArchetype.GetComponents(a_componentType)) {
+				components.push_back(static_cast<TComponent*>(pComponent));
+			}
+		}
+
+		return components;
+	}
+
+	/// <summary>
+	/// Builds an oct-tree of every boid, including growing its sub-trees.
+	/// </summary>
+	void BenchmarkOctTreeInsertObject(BenchmarkState& a_rState) {
+		ScatteredBoids boids(a_rState.GetParameters());
+		std::size_t insertedCount = 0;
+
+		while (a_rState.KeepRunning()) {
+			BoidOctTree* pOctTree = new BoidOctTree(4, glm::vec3(0.0f), glm::vec3(boids.extent));
+
+			for (BoidBoundary& rBoundary : boids.boundaries) {
+				insertedCount += pOctTree->InsertObject(&rBoundary, rBoundary) ? 1 : 0;
+			}
+
+			a_rState.PauseTiming();
+			delete pOctTree;
+			a_rState.ResumeTiming();
+		}
+
+		a_rState.SetItemsPerIteration(static_cast<double>(boids.boundaries.size()));
+		a_rState.SetCounter("inserted_per_iteration",
+			static_cast<double>(insertedCount) / a_rState.GetIterationCount());
+	}
+
+	/// <summary>
+	/// Queries an oct-tree for every boid's neighbours, the way that the boids' colliders do.
+	/// </summary>
+	void BenchmarkOctTreeQuery(BenchmarkState& a_rState) {
+		ScatteredBoids boids(a_rState.GetParameters());
+		BoidOctTree octTree(4, glm::vec3(0.0f), glm::vec3(boids.extent));
+
+		for (BoidBoundary& rBoundary : boids.boundaries) {
+			octTree.InsertObject(&rBoundary, rBoundary);
+		}
+
+		octTree.Update();
+		const glm::vec3 queryDimensions(a_rState.GetParameters().fNeighbourDistance);
+		std::size_t neighbourCount = 0;
+
+		while (a_rState.KeepRunning()) {
+			for (const glm::vec3& rPosition : boids.positions) {
+				octTree.Query(BoundingBox<glm::vec3>(rPosition, queryDimensions), [&neighbourCount](BoidBoundary*) {
+					++neighbourCount;
+				});
+			}
+		}
+
+		a_rState.SetItemsPerIteration(static_cast<double>(boids.positions.size()));
+		a_rState.SetCounter("neighbours_per_query",
+			static_cast<double>(neighbourCount) / (a_rState.GetIterationCount() * boids.positions.size()));
+	}
+
+	/// <summary>
+	/// Finds each boid's nearest boids in an oct-tree, the same number as topological boids steer by, however far away
+	/// they are.
+	/// </summary>
+	void BenchmarkOctTreeQueryNearest(BenchmarkState& a_rState) {
+		ScatteredBoids boids(a_rState.GetParameters());
+		BoidOctTree octTree(4, glm::vec3(0.0f), glm::vec3(boids.extent));
+
+		for (BoidBoundary& rBoundary : boids.boundaries) {
+			octTree.InsertObject(&rBoundary, rBoundary);
+		}
+
+		octTree.Update();
+		// Includes the boid itself, as the brains do.
+		const unsigned int nearestCount = BrainComponent::GetTopologicalNeighbourCount() + 1;
+		std::vector<BoidOctTree::NearestObject> nearestBoids;
+		double totalDistance = 0.0;
+
+		while (a_rState.KeepRunning()) {
+			for (const glm::vec3& rPosition : boids.positions) {
+				octTree.QueryNearest(rPosition, nearestCount, nearestBoids);
+				totalDistance += nearestBoids.empty() ? 0.0 : glm::sqrt(nearestBoids.back().fSquaredDistance);
+			}
+		}
+
+		a_rState.SetItemsPerIteration(static_cast<double>(boids.positions.size()));
+		a_rState.SetCounter("furthest_neighbour_distance",
+			totalDistance / (a_rState.GetIterationCount() * boids.positions.size()));
+	}
+
+	/// <summary>
+	/// Removes nine in every ten boids from a spatial index in one go, as destroying boids from the user interface does,
+	/// then brings the index up-to-date. Filling the index beforehand isn't timed.
+	/// </summary>
+	/// <param name="a_rState"> The benchmark's state. </param>
+	/// <param name="a_pCreateIndex"> Creates an empty index that covers the boids' cube, with the benchmark's
+	/// neighbour distance as its cell size if it has one. </param>
+	void RunSpatialIndexRemoveObject(BenchmarkState& a_rState,
+		BoidSpatialIndex* (*a_pCreateIndex)(float a_fExtent, float a_fCellSize)) {
+		ScatteredBoids boids(a_rState.GetParameters());
+		const std::size_t removedCount = boids.boundaries.size() - boids.boundaries.size() / 10;
+		std::size_t remainingCount = 0;
+
+		while (a_rState.KeepRunning()) {
+			a_rState.PauseTiming();
+			BoidSpatialIndex* pIndex = a_pCreateIndex(boids.extent, a_rState.GetParameters().fNeighbourDistance);
+
+			for (BoidBoundary& rBoundary : boids.boundaries) {
+				pIndex->InsertObject(&rBoundary, rBoundary);
+			}
+
+			pIndex->Update();
+			a_rState.ResumeTiming();
+
+			for (std::size_t i = 0; i < removedCount; ++i) {
+				pIndex->RemoveObject(&boids.boundaries[i]);
+			}
+
+			pIndex->Update();
+			a_rState.PauseTiming();
+			remainingCount += pIndex->GetObjectCount();
+			delete pIndex;
+			a_rState.ResumeTiming();
+		}
+
+		a_rState.SetItemsPerIteration(static_cast<double>(removedCount));
+		a_rState.SetCounter("remaining_per_iteration",
+			static_cast<double>(remainingCount) / a_rState.GetIterationCount());
+	}
+
+	BoidSpatialIndex* CreateOctTree(float a_fExtent,
+		float) {
+		return new BoidOctTree(4, glm::vec3(0.0f), glm::vec3(a_fExtent));
+	}
+
+	BoidSpatialIndex* CreateSpatialHashGrid(float a_fExtent,
+		float a_fCellSize) {
+		return new SpatialHashGrid<BoidBoundary, glm::vec3>(glm::vec3(0.0f), glm::vec3(a_fExtent), a_fCellSize);
+	}
+
+	BoidSpatialIndex* CreateLinearOctTree(float a_fExtent,
+		float) {
+		return new LinearOctTree<BoidBoundary, glm::vec3>(4, glm::vec3(0.0f), glm::vec3(a_fExtent));
+	}
+
+	void BenchmarkOctTreeRemoveObject(BenchmarkState& a_rState) {
+		RunSpatialIndexRemoveObject(a_rState, CreateOctTree);
+	}
+
+	void BenchmarkSpatialHashGridRemoveObject(BenchmarkState& a_rState) {
+		RunSpatialIndexRemoveObject(a_rState, CreateSpatialHashGrid);
+	}
+
+	void BenchmarkLinearOctTreeRemoveObject(BenchmarkState& a_rState) {
+		RunSpatialIndexRemoveObject(a_rState, CreateLinearOctTree);
+	}
+
+	/// <summary>
+	/// Destroys nine in every ten boids of a scene that moves them with its flock system, as destroying boids from the
+	/// user interface does. Filling the scene beforehand isn't timed.
+	/// </summary>
+	void BenchmarkSceneDestroyEntity(BenchmarkState& a_rState) {
+		std::size_t removedCount = 0;
+		std::size_t remainingCount = 0;
+
+		while (a_rState.KeepRunning()) {
+			a_rState.PauseTiming();
+			Scene* pScene = CreateBoidScene(a_rState.GetParameters(), true);
+			std::vector<Entity*> boids;
+
+			for (Entity* pEntity : pScene->GetAllEntities()) {
+				if (pEntity) {
+					boids.push_back(pEntity);
+				}
+			}
+
+			removedCount = boids.size() - boids.size() / 10;
+			a_rState.ResumeTiming();
+
+			for (std::size_t i = 0; i < removedCount; ++i) {
+				pScene->DestroyEntity(boids[i]);
+			}
+
+			a_rState.PauseTiming();
+			remainingCount += pScene->GetEntityCount();
+			delete pScene;
+			a_rState.ResumeTiming();
+		}
+
+		a_rState.SetItemsPerIteration(static_cast<double>(removedCount));
+		a_rState.SetCounter("remaining_per_iteration",
+			static_cast<double>(remainingCount) / a_rState.GetIterationCount());
+	}
+
+	/// <summary>
+	/// Tests boids' boundaries for overlaps against the neighbours that an oct-tree finds for them.
+	/// </summary>
+	void BenchmarkBoundaryOverlaps(BenchmarkState& a_rState) {
+		ScatteredBoids boids(a_rState.GetParameters());
+		BoidOctTree octTree(4, glm::vec3(0.0f), glm::vec3(boids.extent));
+
+		for (BoidBoundary& rBoundary : boids.boundaries) {
+			octTree.InsertObject(&rBoundary, rBoundary);
+		}
+
+		octTree.Update();
+		const glm::vec3 queryDimensions(a_rState.GetParameters().fNeighbourDistance);
+		std::vector<std::pair<const BoidBoundary*, const BoidBoundary*>> pairs;
+
+		for (std::size_t i = 0; i < boids.boundaries.size() && pairs.size() < maximumOverlapPairCount; ++i) {
+			const BoidBoundary* pBoundary = &boids.boundaries[i];
+			octTree.Query(BoundingBox<glm::vec3>(boids.positions[i], queryDimensions), [&pairs, pBoundary](BoidBoundary* a_pNeighbour) {
+				if (a_pNeighbour != pBoundary) {
+					pairs.push_back(std::make_pair(pBoundary, a_pNeighbour));
+				}
+			});
+		}
+
+		std::size_t overlapCount = 0;
+
+		while (a_rState.KeepRunning()) {
+			for (const std::pair<const BoidBoundary*, const BoidBoundary*>& rPair : pairs) {
+				overlapCount += rPair.first->Overlaps(*rPair.second) ? 1 : 0;
+			}
+		}
+
+		a_rState.SetItemsPerIteration(static_cast<double>(pairs.size()));
+		a_rState.SetCounter("overlaps_per_pair",
+			pairs.empty() ? 0.0 : static_cast<double>(overlapCount) / (a_rState.GetIterationCount() * pairs.size()));
+	}
+
+	/// <summary>
+	/// Updates every boid's brain so that each one finds its neighbours and calculates a new movement velocity.
+	/// The scene's spatial index is brought up-to-date between iterations without being timed.
+	/// </summary>
+	void BenchmarkBrainComponentUpdate(BenchmarkState& a_rState) {
+		Scene* pScene = CreateBoidScene(a_rState.GetParameters());
+		const std::vector<BrainComponent*> brains = GetComponents<BrainComponent>(*pScene, COMPONENT_TYPE_BRAIN);
+
+		while (a_rState.KeepRunning()) {
+			for (BrainComponent* pBrain : brains) {
+				pBrain->Reevaluate();
+				pBrain->Update(componentUpdateStep);
+			}
+
+			a_rState.PauseTiming();
+			pScene->Step(0.0f, false);
+			a_rState.ResumeTiming();
+		}
+
+		float totalSpeed = 0.0f;
+
+		for (const BrainComponent* pBrain : brains) {
+			totalSpeed += glm::length(pBrain->GetVelocity());
+		}
+
+		a_rState.SetItemsPerIteration(static_cast<double>(brains.size()));
+		a_rState.SetCounter("mean_speed", brains.empty() ? 0.0 : totalSpeed / brains.size());
+		delete pScene;
+	}
+
+	/// <summary>
+	/// Updates every boid's brain the same way as the brain component benchmark, but with each boid steering by its
+	/// nearest boids instead of every boid within its neighbour distance, so the work per boid stays the same as the
+	/// flock gets denser.
+	/// </summary>
+	void BenchmarkBrainComponentUpdateTopological(BenchmarkState& a_rState) {
+		Scene* pScene = CreateBoidScene(a_rState.GetParameters());
+		const std::vector<BrainComponent*> brains = GetComponents<BrainComponent>(*pScene, COMPONENT_TYPE_BRAIN);
+		const BrainComponent::NEIGHBOURHOOD_TYPE previousNeighbourhoodType = BrainComponent::GetNeighbourhoodType();
+		BrainComponent::SetNeighbourhoodType(BrainComponent::NEIGHBOURHOOD_TYPE_TOPOLOGICAL);
+
+		while (a_rState.KeepRunning()) {
+			for (BrainComponent* pBrain : brains) {
+				pBrain->Reevaluate();
+				pBrain->Update(componentUpdateStep);
+			}
+
+			a_rState.PauseTiming();
+			pScene->Step(0.0f, false);
+			a_rState.ResumeTiming();
+		}
+
+		BrainComponent::SetNeighbourhoodType(previousNeighbourhoodType);
+		float totalSpeed = 0.0f;
+
+		for (const BrainComponent* pBrain : brains) {
+			totalSpeed += glm::length(pBrain->GetVelocity());
+		}
+
+		a_rState.SetItemsPerIteration(static_cast<double>(brains.size()));
+		a_rState.SetCounter("mean_speed", brains.empty() ? 0.0 : totalSpeed / brains.size());
+		delete pScene;
+	}
+
+	/// <summary>
+	/// Updates every boid's brain the same way as the brain component benchmark, but with each boid perceiving every
+	/// boid within the benchmark's neighbour distance through the scene's oct-tree. Areas of the oct-tree that are
+	/// narrow enough for the opening angle are perceived through their totals, and updating those totals is timed
+	/// along with the brains.
+	/// </summary>
+	/// <param name="a_rState"> The benchmark's state. </param>
+	/// <param name="a_fOpeningAngle"> The scene's opening angle. Zero perceives every boid one by one. </param>
+	void RunBrainComponentUpdateWithCellAggregates(BenchmarkState& a_rState,
+		float a_fOpeningAngle) {
+		Scene* pScene = CreateBoidScene(a_rState.GetParameters());
+		pScene->SetCellAggregateState(true);
+		pScene->SetOpeningAngle(a_fOpeningAngle);
+		const std::vector<BrainComponent*> brains = GetComponents<BrainComponent>(*pScene, COMPONENT_TYPE_BRAIN);
+		const float previousPerceptionDistance = BrainComponent::GetPerceptionDistance();
+		BrainComponent::SetPerceptionDistance(a_rState.GetParameters().fNeighbourDistance);
+
+		while (a_rState.KeepRunning()) {
+			pScene->UpdateCellAggregates();
+
+			for (BrainComponent* pBrain : brains) {
+				pBrain->Reevaluate();
+				pBrain->Update(componentUpdateStep);
+			}
+
+			a_rState.PauseTiming();
+			pScene->Step(0.0f, false);
+			a_rState.ResumeTiming();
+		}
+
+		BrainComponent::SetPerceptionDistance(previousPerceptionDistance);
+		std::size_t perceivedCount = 0;
+
+		for (const BrainComponent* pBrain : brains) {
+			perceivedCount += pBrain->GetNeighbourCount();
+		}
+
+		a_rState.SetItemsPerIteration(static_cast<double>(brains.size()));
+		a_rState.SetCounter("perceived_per_boid",
+			brains.empty() ? 0.0 : static_cast<double>(perceivedCount) / brains.size());
+		delete pScene;
+	}
+
+	/// <summary>
+	/// Perceives every boid within a wide neighbour distance one by one, for comparing against cell aggregates.
+	/// </summary>
+	void BenchmarkBrainComponentUpdateWidePerception(BenchmarkState& a_rState) {
+		RunBrainComponentUpdateWithCellAggregates(a_rState, 0.0f);
+	}
+
+	/// <summary>
+	/// Perceives every boid within a wide neighbour distance, with distant areas of boids perceived through their
+	/// totals.
+	/// </summary>
+	void BenchmarkBrainComponentUpdateWithCellAggregates(BenchmarkState& a_rState) {
+		// Matches the scene's default opening angle.
+		const float openingAngle = 0.5f;
+		RunBrainComponentUpdateWithCellAggregates(a_rState, openingAngle);
+	}
+
+	/// <summary>
+	/// Updates every boid's brain the same way as the brain component benchmark, but with each boid finding its
+	/// neighbours from the scene's neighbour lists. Checking whether the lists need rebuilding, and rebuilding them,
+	/// is timed along with the brains.
+	/// </summary>
+	void BenchmarkBrainComponentUpdateWithNeighbourLists(BenchmarkState& a_rState) {
+		Scene* pScene = CreateBoidScene(a_rState.GetParameters());
+		pScene->SetNeighbourListState(true);
+		const std::vector<BrainComponent*> brains = GetComponents<BrainComponent>(*pScene, COMPONENT_TYPE_BRAIN);
+
+		while (a_rState.KeepRunning()) {
+			pScene->UpdateNeighbourList();
+
+			for (BrainComponent* pBrain : brains) {
+				pBrain->Reevaluate();
+				pBrain->Update(componentUpdateStep);
+			}
+
+			a_rState.PauseTiming();
+			pScene->Step(0.0f, false);
+			a_rState.ResumeTiming();
+		}
+
+		const NeighbourList& rNeighbourList = pScene->GetNeighbourList();
+		a_rState.SetItemsPerIteration(static_cast<double>(brains.size()));
+		a_rState.SetCounter("rebuild_rate", rNeighbourList.GetRebuildRate());
+		a_rState.SetCounter("listed_per_boid",
+			brains.empty() ? 0.0 : static_cast<double>(rNeighbourList.GetNeighbourCount()) / brains.size());
+		delete pScene;
+	}
+
+	/// <summary>
+	/// Finds every pair of boids whose colliders overlap with a sweep-and-prune broadphase, and updates a contact cache
+	/// with them to find which contacts have begun and ended. Every boid moves a step in its own direction between
+	/// iterations without being timed, so the broadphase has to re-sort the colliders' bounds as it would in the
+	/// scene.
+	/// </summary>
+	void BenchmarkSweepAndPruneUpdate(BenchmarkState& a_rState) {
+		Scene* pScene = CreateBoidScene(a_rState.GetParameters());
+		const std::vector<TransformComponent*> transforms = GetComponents<TransformComponent>(*pScene,
+			COMPONENT_TYPE_TRANSFORM);
+		const std::vector<ColliderComponent*> colliders = GetComponents<ColliderComponent>(*pScene,
+			COMPONENT_TYPE_COLLIDER);
+		SweepAndPrune broadphase;
+		ContactCache contacts;
+		std::vector<glm::vec3> steps;
+		std::mt19937 randomGenerator(a_rState.GetParameters().uiBoidCount);
+		std::uniform_real_distribution<float> randomStep(-componentUpdateStep, componentUpdateStep);
+
+		for (unsigned int i = 0; i < colliders.size(); ++i) {
+			broadphase.AddCollider(i, colliders[i], colliders[i]->GetEntity()->GetHandle());
+			steps.push_back(glm::vec3(randomStep(randomGenerator),
+				randomStep(randomGenerator),
+				randomStep(randomGenerator)));
+		}
+
+		// Sorts the new colliders into place and begins their first contacts, which isn't part of a typical update.
+		contacts.BeginUpdate();
+		broadphase.Update(contacts);
+		contacts.EndUpdate();
+		std::size_t swapCount = 0;
+		std::size_t changedContactCount = 0;
+
+		while (a_rState.KeepRunning()) {
+			a_rState.PauseTiming();
+
+			for (unsigned int i = 0; i < transforms.size(); ++i) {
+				transforms[i]->SetMatrixRow(TransformComponent::MATRIX_ROW_POSITION_VECTOR,
+					*transforms[i]->GetPosition() + steps[i]);
+			}
+
+			a_rState.ResumeTiming();
+			contacts.BeginUpdate();
+			broadphase.Update(contacts);
+			contacts.EndUpdate();
+			swapCount += broadphase.GetSwapCount();
+			changedContactCount += contacts.GetEventCount(ContactCache::CONTACT_EVENT_TYPE_BEGIN) +
+				contacts.GetEventCount(ContactCache::CONTACT_EVENT_TYPE_END);
+		}
+
+		a_rState.SetItemsPerIteration(static_cast<double>(colliders.size()));
+		a_rState.SetCounter("collisions_per_boid",
+			colliders.empty() ? 0.0 : 2.0 * contacts.GetContactCount() / colliders.size());
+		a_rState.SetCounter("swaps_per_iteration", static_cast<double>(swapCount) / a_rState.GetIterationCount());
+		a_rState.SetCounter("contact_changes_per_iteration",
+			static_cast<double>(changedContactCount) / a_rState.GetIterationCount());
+		delete pScene;
+	}
+
+	/// <summary>
+	/// Returns every combination of the boid counts, densities, and neighbour distances.
+	/// </summary>
+	/// <param name="a_rNeighbourDistances"> The neighbour distances to combine. </param>
+	/// <param name="a_uiMaximumBoidCount"> Larger boid counts are left out, for benchmarks that would take too long
+	/// with them. </param>
+	std::vector<BenchmarkParameters> CombineParameters(const std::vector<float>& a_rNeighbourDistances,
+		unsigned int a_uiMaximumBoidCount = ~0u) {
+		const unsigned int boidCounts[] = { 100, 1000, 10000, 100000 };
+		// From a sparse flock up to a crowd as dense as the application's.
+		const float densities[] = { 1.0f, 10.0f, 100.0f };
+		std::vector<BenchmarkParameters> parameters;
+
+		for (unsigned int boidCount : boidCounts) {
+			if (boidCount > a_uiMaximumBoidCount) {
+				continue;
+			}
+
+			for (float density : densities) {
+				for (float neighbourDistance : a_rNeighbourDistances) {
+					const BenchmarkParameters combination = { boidCount, density, neighbourDistance };
+					parameters.push_back(combination);
+				}
+			}
+		}
+
+		return parameters;
+	}
+}
+
+void HotPathBenchmarks::Register(BenchmarkSuite& a_rSuite) {
+	// Matches the neighbour distance used by the boids' brains.
+	const float brainNeighbourDistance = 8.0f;
+	// Matches how far the boids perceive with cell aggregates. Perceiving this far one by one in the largest, densest
+	// flocks takes minutes, so those flocks are left out.
+	const float perceptionDistance = 24.0f;
+	const unsigned int maximumPerceptionBoidCount = 10000;
+	// Colliders only reach as far as their average dimension.
+	const float colliderNeighbourDistance = (boidDimensions.x + boidDimensions.y + boidDimensions.z) / 3.0f;
+	const std::vector<float> neighbourDistances = { 2.0f, brainNeighbourDistance };
+	// Inserting doesn't depend on a neighbour distance, so it's only run with the brains' one.
+	a_rSuite.Register("OctTree::InsertObject",
+		BenchmarkOctTreeInsertObject,
+		CombineParameters(std::vector<float>(1, brainNeighbourDistance)));
+	a_rSuite.Register("OctTree::Query", BenchmarkOctTreeQuery, CombineParameters(neighbourDistances));
+	// Nearest neighbours are found however far away they are, so it's only run with the brains' distance too.
+	a_rSuite.Register("OctTree::QueryNearest",
+		BenchmarkOctTreeQueryNearest,
+		CombineParameters(std::vector<float>(1, brainNeighbourDistance)));
+	// Removing doesn't depend on a neighbour distance either, besides the hash grid's cell size.
+	a_rSuite.Register("OctTree::RemoveObject",
+		BenchmarkOctTreeRemoveObject,
+		CombineParameters(std::vector<float>(1, brainNeighbourDistance)));
+	a_rSuite.Register("SpatialHashGrid::RemoveObject",
+		BenchmarkSpatialHashGridRemoveObject,
+		CombineParameters(std::vector<float>(1, brainNeighbourDistance)));
+	a_rSuite.Register("LinearOctTree::RemoveObject",
+		BenchmarkLinearOctTreeRemoveObject,
+		CombineParameters(std::vector<float>(1, brainNeighbourDistance)));
+	a_rSuite.Register("Scene::DestroyEntity",
+		BenchmarkSceneDestroyEntity,
+		CombineParameters(std::vector<float>(1, brainNeighbourDistance)));
+	a_rSuite.Register("Boundary::Overlaps", BenchmarkBoundaryOverlaps, CombineParameters(neighbourDistances));
+	a_rSuite.Register("BrainComponent::Update",
+		BenchmarkBrainComponentUpdate,
+		CombineParameters(std::vector<float>(1, brainNeighbourDistance)));
+	a_rSuite.Register("BrainComponent::UpdateTopological",
+		BenchmarkBrainComponentUpdateTopological,
+		CombineParameters(std::vector<float>(1, brainNeighbourDistance)));
+	a_rSuite.Register("BrainComponent::UpdateWithNeighbourLists",
+		BenchmarkBrainComponentUpdateWithNeighbourLists,
+		CombineParameters(std::vector<float>(1, brainNeighbourDistance)));
+	a_rSuite.Register("BrainComponent::UpdateWidePerception",
+		BenchmarkBrainComponentUpdateWidePerception,
+		CombineParameters(std::vector<float>(1, perceptionDistance), maximumPerceptionBoidCount));
+	a_rSuite.Register("BrainComponent::UpdateWithCellAggregates",
+		BenchmarkBrainComponentUpdateWithCellAggregates,
+		CombineParameters(std::vector<float>(1, perceptionDistance), maximumPerceptionBoidCount));
+	a_rSuite.Register("SweepAndPrune::Update",
+		BenchmarkSweepAndPruneUpdate,
+		CombineParameters(std::vector<float>(1, colliderNeighbourDistance)));
+}
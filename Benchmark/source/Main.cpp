@@ -0,0 +1,493 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 17/10/2026
+//////////////////////////////
+
+// Measures the performance of the simulation's systems without creating a window or rendering context.
+
+#include "AllocationCounter.h"
+#include "Boundary.h"
+#include "BoundingBox.h"
+#include "FlockKernels.h"
+#include "FlockSystem.h"
+#include "glm/glm.hpp"
+#include "HotPathBenchmarks.h"
+#include "LinearOctTree.h"
+#include "MicroBenchmark.h"
+#include "OctTree.h"
+#include "SpatialHashGrid.h"
+#include "StaggeredSchedule.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <thread>
+#include <vector>
+
+// Typedefs.
+typedef Boundary<glm::vec3> BoidBoundary;
+typedef OctTree<BoidBoundary, glm::vec3> BoidOctTree;
+typedef SpatialHashGrid<BoidBoundary, glm::vec3> BoidHashGrid;
+typedef LinearOctTree<BoidBoundary, glm::vec3> BoidLinearOctTree;
+typedef std::chrono::high_resolution_clock Clock;
+
+namespace {
+	/// <summary>
+	/// Matches the neighbour distance used by the boids' brains.
+	/// </summary>
+	const float neighbourDistance = 8.0f;
+	/// <summary>
+	/// The width, height, and depth of a scene containing 10,000 boids, as measured outward from its centre.
+	/// Scenes with more or fewer boids are resized to keep the same number of boids in each neighbourhood.
+	/// </summary>
+	const float sceneExtent = 100.0f;
+	/// <summary>
+	/// The number of times every boid queries the index for each measurement.
+	/// </summary>
+	const unsigned int queryPasses = 10;
+	/// <summary>
+	/// The furthest that a boid can move between two updates of an index.
+	/// </summary>
+	const float boidStep = 0.5f;
+
+	/// <summary>
+	/// The results from measuring one way of querying an index.
+	/// </summary>
+	struct QueryResult {
+		double nanosecondsPerQuery;
+		double allocationsPerQuery;
+		double neighboursPerQuery;
+	};
+
+	/// <summary>
+	/// A number of boids that are spread evenly across a scene.
+	/// </summary>
+	struct BoidSet {
+		BoidSet(unsigned int a_uiCount,
+			unsigned int a_uiSeed) : extent(sceneExtent * std::cbrt(a_uiCount / 10000.0f)),
+			randomGenerator(a_uiSeed),
+			positions(),
+			boundaries() {
+			std::uniform_real_distribution<float> randomPosition(-extent, extent);
+			// Every boundary points at a position, so reserve the memory up front to keep the positions from moving.
+			positions.reserve(a_uiCount);
+			boundaries.reserve(a_uiCount);
+
+			for (unsigned int i = 0; i < a_uiCount; ++i) {
+				positions.push_back(glm::vec3(randomPosition(randomGenerator),
+					randomPosition(randomGenerator),
+					randomPosition(randomGenerator)));
+				// Matches the dimensions of a boid's collider.
+				boundaries.push_back(BoidBoundary(&positions.back(), glm::vec3(0.33f, 0.15f, 0.33f)));
+			}
+		}
+
+		/// <summary>
+		/// Moves every boid a short random distance, keeping them inside the scene.
+		/// </summary>
+		void Move() {
+			std::uniform_real_distribution<float> randomStep(-boidStep, boidStep);
+
+			for (glm::vec3& rPosition : positions) {
+				rPosition = glm::clamp(rPosition + glm::vec3(randomStep(randomGenerator),
+					randomStep(randomGenerator),
+					randomStep(randomGenerator)),
+					glm::vec3(-extent),
+					glm::vec3(extent));
+			}
+		}
+
+		float extent;
+		std::mt19937 randomGenerator;
+		std::vector<glm::vec3> positions;
+		std::vector<BoidBoundary> boundaries;
+	};
+
+	double ElapsedMilliseconds(const Clock::time_point& a_rStartTime) {
+		return std::chrono::duration<double, std::milli>(Clock::now() - a_rStartTime).count();
+	}
+
+	void PrintResult(const char* a_pName,
+		const QueryResult& a_rResult) {
+		std::printf("%-28s %10.1f ns/query %8.3f allocations/query %8.1f neighbours/query\n",
+			a_pName,
+			a_rResult.nanosecondsPerQuery,
+			a_rResult.allocationsPerQuery,
+			a_rResult.neighboursPerQuery);
+	}
+
+	/// <summary>
+	/// Times every boid querying an index for its neighbours.
+	/// </summary>
+	/// <param name="a_rIndex"> The index to query. </param>
+	/// <param name="a_rPositions"> The boids' positions. </param>
+	/// <param name="a_query"> Queries the index for a single boid and returns the number of neighbours found. </param>
+	/// <returns> The measured results. </returns>
+	template <typename TIndex, typename TQuery>
+	QueryResult MeasureQueries(const TIndex& a_rIndex,
+		const std::vector<glm::vec3>& a_rPositions,
+		TQuery a_query) {
+		const glm::vec3 queryDimensions(neighbourDistance);
+		std::size_t neighbourCount = 0;
+
+		// Run one pass beforehand so any reusable memory has grown to its final size before being measured.
+		for (const glm::vec3& rPosition : a_rPositions) {
+			a_query(a_rIndex, BoundingBox<glm::vec3>(rPosition, queryDimensions));
+		}
+
+		const std::size_t allocationsBefore = AllocationCounter::GetAllocationCount();
+		const Clock::time_point startTime = Clock::now();
+
+		for (unsigned int pass = 0; pass < queryPasses; ++pass) {
+			for (const glm::vec3& rPosition : a_rPositions) {
+				neighbourCount += a_query(a_rIndex, BoundingBox<glm::vec3>(rPosition, queryDimensions));
+			}
+		}
+
+		const double elapsedNanoseconds = ElapsedMilliseconds(startTime) * 1000000.0;
+		const std::size_t allocations = AllocationCounter::GetAllocationCount() - allocationsBefore;
+		const double queryCount = static_cast<double>(queryPasses) * a_rPositions.size();
+		QueryResult result;
+		result.nanosecondsPerQuery = elapsedNanoseconds / queryCount;
+		result.allocationsPerQuery = allocations / queryCount;
+		result.neighboursPerQuery = neighbourCount / queryCount;
+		return result;
+	}
+
+	/// <summary>
+	/// Counts the neighbours found by a visitor query, which is how the boids' colliders search an index.
+	/// </summary>
+	template <typename TIndex>
+	std::size_t CountNeighbours(const TIndex& a_rIndex,
+		const BoundingBox<glm::vec3>& a_rQueryVolume) {
+		std::size_t neighbourCount = 0;
+		a_rIndex.Query(a_rQueryVolume, [&neighbourCount](BoidBoundary*) {
+			++neighbourCount;
+		});
+		return neighbourCount;
+	}
+
+	/// <summary>
+	/// Checks that the oct-tree's queries don't allocate any memory, using the same number of boids as the
+	/// application is expected to handle.
+	/// </summary>
+	void RunOctTreeAllocationBenchmark() {
+		const unsigned int boidCount = 10000;
+		BoidSet boids(boidCount, 1);
+		BoidOctTree octTree(4, glm::vec3(0.0f), glm::vec3(boids.extent));
+
+		for (BoidBoundary& rBoundary : boids.boundaries) {
+			octTree.InsertObject(&rBoundary, rBoundary);
+		}
+
+		octTree.Update();
+		std::printf("Oct-tree queries: %u boids, %.1f neighbour distance\n", boidCount, neighbourDistance);
+		// A buffer that's reused by every query, the same way each boid's brain reuses its own.
+		std::vector<BoidBoundary*> neighbours;
+		PrintResult("Query into reused buffer",
+			MeasureQueries(octTree, boids.positions, [&neighbours](const BoidOctTree& a_rOctTree,
+				const BoundingBox<glm::vec3>& a_rQueryVolume) {
+				neighbours.clear();
+				a_rOctTree.Query(a_rQueryVolume, neighbours);
+				return neighbours.size();
+			}));
+		PrintResult("Query with visitor",
+			MeasureQueries(octTree, boids.positions, CountNeighbours<BoidOctTree>));
+		std::printf("\n");
+	}
+
+	/// <summary>
+	/// Builds an index, updates it after the boids have moved, and queries it for every boid's neighbours.
+	/// </summary>
+	/// <param name="a_pName"> The name of the index that's printed alongside its results. </param>
+	/// <param name="a_rIndex"> An empty index that covers the boids' scene. </param>
+	/// <param name="a_rBoids"> The boids to register with the index. </param>
+	template <typename TIndex>
+	void MeasureSpatialIndex(const char* a_pName,
+		TIndex& a_rIndex,
+		BoidSet& a_rBoids) {
+		Clock::time_point startTime = Clock::now();
+
+		for (BoidBoundary& rBoundary : a_rBoids.boundaries) {
+			a_rIndex.InsertObject(&rBoundary, rBoundary);
+		}
+
+		// Every index is updated once before it's queried each frame, so that's included in building them.
+		a_rIndex.Update();
+		const double buildMilliseconds = ElapsedMilliseconds(startTime);
+		a_rBoids.Move();
+		startTime = Clock::now();
+		a_rIndex.Update();
+		const double updateMilliseconds = ElapsedMilliseconds(startTime);
+		const QueryResult queryResult = MeasureQueries(a_rIndex, a_rBoids.positions, CountNeighbours<TIndex>);
+		std::printf("%-16s %7u boids %10.3f ms build %10.3f ms update %10.1f ns/query %8.1f neighbours/query\n",
+			a_pName,
+			static_cast<unsigned int>(a_rBoids.positions.size()),
+			buildMilliseconds,
+			updateMilliseconds,
+			queryResult.nanosecondsPerQuery,
+			queryResult.neighboursPerQuery);
+	}
+
+	/// <summary>
+	/// Compares the oct-tree against the hash grid and the linear oct-tree as the number of boids grows.
+	/// </summary>
+	void RunSpatialIndexBenchmark() {
+		const unsigned int boidCounts[] = { 1000, 10000, 100000 };
+		std::printf("Spatial index comparison: %.1f neighbour distance\n", neighbourDistance);
+
+		for (unsigned int boidCount : boidCounts) {
+			// Every index is given identical boids that move identically.
+			BoidSet octTreeBoids(boidCount, boidCount);
+			BoidOctTree octTree(4, glm::vec3(0.0f), glm::vec3(octTreeBoids.extent));
+			MeasureSpatialIndex("Oct-tree", octTree, octTreeBoids);
+			BoidSet hashGridBoids(boidCount, boidCount);
+			BoidHashGrid hashGrid(glm::vec3(0.0f), glm::vec3(hashGridBoids.extent), neighbourDistance);
+			MeasureSpatialIndex("Hash grid", hashGrid, hashGridBoids);
+			BoidSet linearOctTreeBoids(boidCount, boidCount);
+			BoidLinearOctTree linearOctTree(4, glm::vec3(0.0f), glm::vec3(linearOctTreeBoids.extent));
+			MeasureSpatialIndex("Linear oct-tree", linearOctTree, linearOctTreeBoids);
+		}
+
+		std::printf("\n");
+	}
+
+	/// <summary>
+	/// Boids scattered randomly around a scene that's the same size as the application's, stored the way the flock
+	/// system stores them.
+	/// </summary>
+	struct KernelBoids {
+		KernelBoids(unsigned int a_uiCount,
+			unsigned int a_uiSeed) : positions(),
+			velocities(),
+			dimensions(a_uiCount, glm::vec3(0.33f, 0.15f, 0.33f)) {
+			std::mt19937 randomGenerator(a_uiSeed);
+			std::uniform_real_distribution<float> randomPosition(-10.0f, 10.0f);
+			std::uniform_real_distribution<float> randomVelocity(-1.0f, 1.0f);
+
+			for (unsigned int i = 0; i < a_uiCount; ++i) {
+				positions.push_back(glm::vec3(randomPosition(randomGenerator),
+					randomPosition(randomGenerator),
+					randomPosition(randomGenerator)));
+				velocities.push_back(glm::vec3(randomVelocity(randomGenerator),
+					randomVelocity(randomGenerator),
+					randomVelocity(randomGenerator)));
+			}
+
+			// Put some boids on top of each other so that touching boids are checked too.
+			for (unsigned int i = 1; i < a_uiCount; i += 37) {
+				positions[i] = positions[i - 1];
+			}
+		}
+
+		FlockKernels::Neighbourhood GetNeighbourhood(unsigned int a_uiBoid) const {
+			const FlockKernels::Neighbourhood neighbourhood = {
+				positions[a_uiBoid],
+				glm::vec3(neighbourDistance),
+				dimensions[a_uiBoid],
+				a_uiBoid
+			};
+			return neighbourhood;
+		}
+
+		std::vector<glm::vec3> positions;
+		std::vector<glm::vec3> velocities;
+		std::vector<glm::vec3> dimensions;
+	};
+
+	/// <summary>
+	/// Times each instruction set adding up every boid's neighbours in a scene that's the same size as the
+	/// application's.
+	/// </summary>
+	void RunFlockKernelBenchmark() {
+		const unsigned int boidCount = 4096;
+		const unsigned int queryCount = 1024;
+		const KernelBoids boids(boidCount, 2);
+		std::vector<unsigned int> touchingBoids(boidCount);
+		std::printf("Flock kernels: %u boids checked by each of %u boids\n", boidCount, queryCount);
+
+		for (unsigned int instructionSet = FlockKernels::INSTRUCTION_SET_SCALAR;
+			instructionSet < FlockKernels::INSTRUCTION_SET_COUNT;
+			++instructionSet) {
+			const FlockKernels::INSTRUCTION_SET set = static_cast<FlockKernels::INSTRUCTION_SET>(instructionSet);
+
+			if (!FlockKernels::IsSupported(set)) {
+				continue;
+			}
+
+			glm::vec3 alignment(0.0f);
+			glm::vec3 cohesion(0.0f);
+			unsigned int touchingCount = 0;
+			const Clock::time_point startTime = Clock::now();
+
+			for (unsigned int boid = 0; boid < queryCount; ++boid) {
+				touchingCount += FlockKernels::AccumulateNeighbours(set,
+					boids.GetNeighbourhood(boid),
+					boids.positions.data(),
+					boids.velocities.data(),
+					boids.dimensions.data(),
+					0,
+					boidCount,
+					alignment,
+					cohesion,
+					touchingBoids.data());
+			}
+
+			const double elapsedMilliseconds = ElapsedMilliseconds(startTime);
+			// Print the results so the work can't be optimised away.
+			std::printf("%-8s %10.3f ns/boid checked %10.3f ms total (%u touching, %.1f)\n",
+				FlockKernels::GetInstructionSetName(set),
+				elapsedMilliseconds * 1000000.0 / (static_cast<double>(boidCount) * queryCount),
+				elapsedMilliseconds,
+				touchingCount,
+				alignment.x + cohesion.x);
+		}
+
+		std::printf("\n");
+	}
+
+	/// <summary>
+	/// Fills a flock system with boids scattered randomly around a scene that's the same size as the application's.
+	/// </summary>
+	void AddRandomBoids(FlockSystem& a_rFlockSystem,
+		unsigned int a_uiBoidCount,
+		float a_fSceneExtent) {
+		const glm::vec3 boidDimensions(0.33f, 0.15f, 0.33f);
+		std::mt19937 randomGenerator(a_uiBoidCount);
+		std::uniform_real_distribution<float> randomPosition(-a_fSceneExtent, a_fSceneExtent);
+
+		for (unsigned int i = 0; i < a_uiBoidCount; ++i) {
+			a_rFlockSystem.AddBoid(nullptr,
+				glm::vec3(randomPosition(randomGenerator),
+					randomPosition(randomGenerator),
+					randomPosition(randomGenerator)),
+				glm::vec3(0.0f),
+				boidDimensions);
+		}
+	}
+
+	/// <summary>
+	/// Times the flock system moving boids around a scene that's the same size as the application's, using from one
+	/// thread up to every hardware thread.
+	/// </summary>
+	void RunFlockSystemBenchmark() {
+		const unsigned int boidCounts[] = { 500, 5000 };
+		const unsigned int frameCount = 120;
+		const float deltaTime = 1.0f / 60.0f;
+		// Steers every boid on the same frame, as often as the scene does at its default tick rate.
+		const StaggeredSchedule steeringSchedule(9, 1);
+		const float applicationSceneExtent = 10.0f;
+		const unsigned int seed = 1;
+		const std::vector<BoundingBox<glm::vec3>> obstacles;
+		const unsigned int hardwareThreadCount = std::max(std::thread::hardware_concurrency(), 1u);
+		// Doubles the number of threads until every hardware thread is used.
+		std::vector<unsigned int> threadCounts;
+
+		for (unsigned int threadCount = 1; threadCount < hardwareThreadCount; threadCount *= 2) {
+			threadCounts.push_back(threadCount);
+		}
+
+		threadCounts.push_back(hardwareThreadCount);
+		std::printf("Flock system: %u frames, %.1f neighbour distance, %u hardware threads\n",
+			frameCount,
+			neighbourDistance,
+			hardwareThreadCount);
+
+		for (unsigned int boidCount : boidCounts) {
+			double singleThreadMilliseconds = 0.0;
+
+			for (unsigned int threadCount : threadCounts) {
+				FlockSystem flockSystem(BoundingBox<glm::vec3>(glm::vec3(0.0f), glm::vec3(applicationSceneExtent)),
+					neighbourDistance,
+					seed,
+					threadCount);
+				AddRandomBoids(flockSystem, boidCount, applicationSceneExtent);
+				const Clock::time_point startTime = Clock::now();
+
+				for (unsigned int frame = 0; frame < frameCount; ++frame) {
+					flockSystem.Update(deltaTime, obstacles, &steeringSchedule, frame);
+				}
+
+				const double elapsedMilliseconds = ElapsedMilliseconds(startTime);
+
+				if (threadCount == 1) {
+					singleThreadMilliseconds = elapsedMilliseconds;
+				}
+
+				std::printf("%7u boids %3u threads %10.3f ms/frame %14.0f boid-updates/s %6.2fx\n",
+					boidCount,
+					threadCount,
+					elapsedMilliseconds / frameCount,
+					boidCount * frameCount / (elapsedMilliseconds / 1000.0),
+					singleThreadMilliseconds / elapsedMilliseconds);
+			}
+		}
+
+		std::printf("\n");
+	}
+}
+
+int main(int argc, char* argv[]) {
+	// "--micro" runs the hot path micro-benchmarks instead of the reports. Only the ones with the text given by
+	// "--filter" in their names are run, each for at least the number of seconds given by "--min-time", and with no
+	// more boids than "--max-boids". "--json" writes their results to a file in Google Benchmark's format.
+	bool runMicroBenchmarks = false;
+	const char* pFilter = nullptr;
+	const char* pJsonPath = nullptr;
+	double minimumTime = 0.5;
+	unsigned int maximumBoidCount = ~0u;
+
+	for (int i = 1; i < argc; ++i) {
+		if (std::strcmp(argv[i], "--micro") == 0) {
+			runMicroBenchmarks = true;
+		}
+
+		if (i + 1 >= argc) {
+			continue;
+		}
+
+		if (std::strcmp(argv[i], "--filter") == 0) {
+			pFilter = argv[i + 1];
+		} else if (std::strcmp(argv[i], "--json") == 0) {
+			pJsonPath = argv[i + 1];
+		} else if (std::strcmp(argv[i], "--min-time") == 0) {
+			minimumTime = std::strtod(argv[i + 1], nullptr);
+		} else if (std::strcmp(argv[i], "--max-boids") == 0) {
+			maximumBoidCount = static_cast<unsigned int>(std::strtoul(argv[i + 1], nullptr, 10));
+		}
+	}
+
+	if (runMicroBenchmarks) {
+		std::FILE* pJsonFile = nullptr;
+
+		if (pJsonPath) {
+			pJsonFile = std::fopen(pJsonPath, "w");
+
+			if (!pJsonFile) {
+				std::fprintf(stderr, "Couldn't open %s for writing.\n", pJsonPath);
+				return 1;
+			}
+		}
+
+		BenchmarkSuite suite;
+		suite.SetMinimumTime(minimumTime);
+		suite.SetMaximumBoidCount(maximumBoidCount);
+		HotPathBenchmarks::Register(suite);
+		suite.Run(pFilter, pJsonFile);
+
+		if (pJsonFile) {
+			std::fclose(pJsonFile);
+		}
+
+		return 0;
+	}
+
+	RunOctTreeAllocationBenchmark();
+	RunSpatialIndexBenchmark();
+	RunFlockKernelBenchmark();
+	RunFlockSystemBenchmark();
+	return 0;
+}
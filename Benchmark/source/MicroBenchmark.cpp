@@ -0,0 +1,207 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+// File's header.
+#include "MicroBenchmark.h"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+float BenchmarkParameters::GetSceneExtent() const {
+	const float volume = uiBoidCount / fDensity * 1000.0f;
+	return std::cbrt(volume) * 0.5f;
+}
+
+std::string BenchmarkParameters::GetName() const {
+	char name[96];
+	std::snprintf(name, sizeof(name), "boids:%u/density:%g/distance:%g", uiBoidCount, fDensity, fNeighbourDistance);
+	return name;
+}
+
+BenchmarkState::BenchmarkState(const BenchmarkParameters& a_rParameters,
+	std::size_t a_uiIterationCount) : m_bTiming(false),
+	m_uiIteration(0),
+	mc_uiIterationCount(a_uiIterationCount),
+	m_dItemsPerIteration(0.0),
+	m_dRealTime(0.0),
+	m_dCpuTime(0.0),
+	m_realStartTime(),
+	m_cpuStartTime(0),
+	mc_parameters(a_rParameters),
+	m_counters() {}
+
+bool BenchmarkState::KeepRunning() {
+	if (m_uiIteration == 0 && !m_bTiming) {
+		ResumeTiming();
+	}
+
+	if (m_uiIteration < mc_uiIterationCount) {
+		++m_uiIteration;
+		return true;
+	}
+
+	PauseTiming();
+	return false;
+}
+
+void BenchmarkState::PauseTiming() {
+	if (!m_bTiming) {
+		return;
+	}
+
+	m_dRealTime += std::chrono::duration<double>(Clock::now() - m_realStartTime).count();
+	m_dCpuTime += static_cast<double>(std::clock() - m_cpuStartTime) / CLOCKS_PER_SEC;
+	m_bTiming = false;
+}
+
+void BenchmarkState::ResumeTiming() {
+	if (m_bTiming) {
+		return;
+	}
+
+	m_bTiming = true;
+	m_cpuStartTime = std::clock();
+	m_realStartTime = Clock::now();
+}
+
+void BenchmarkState::SetCounter(const char* a_pName,
+	double a_dValue) {
+	for (std::pair<std::string, double>& rCounter : m_counters) {
+		if (rCounter.first == a_pName) {
+			rCounter.second = a_dValue;
+			return;
+		}
+	}
+
+	m_counters.push_back(std::pair<std::string, double>(a_pName, a_dValue));
+}
+
+BenchmarkSuite::BenchmarkSuite() : m_dMinimumTime(0.5),
+	m_uiMaximumBoidCount(~0u),
+	m_benchmarks() {}
+
+void BenchmarkSuite::Register(const char* a_pName,
+	BenchmarkFunction a_function,
+	const std::vector<BenchmarkParameters>& a_rParameters) {
+	Benchmark benchmark;
+	benchmark.name = a_pName;
+	benchmark.function = a_function;
+	benchmark.parameters = a_rParameters;
+	m_benchmarks.push_back(benchmark);
+}
+
+void BenchmarkSuite::Run(const char* a_pFilter,
+	std::FILE* a_pJsonFile) {
+	std::vector<Result> results;
+	std::printf("%-72s %14s %14s %12s %16s\n", "Benchmark", "Time", "CPU", "Iterations", "Items/s");
+
+	for (const Benchmark& rBenchmark : m_benchmarks) {
+		for (const BenchmarkParameters& rParameters : rBenchmark.parameters) {
+			const std::string name = rBenchmark.name + "/" + rParameters.GetName();
+
+			if (rParameters.uiBoidCount > m_uiMaximumBoidCount ||
+				(a_pFilter && name.find(a_pFilter) == std::string::npos)) {
+				continue;
+			}
+
+			results.push_back(RunBenchmark(rBenchmark, rParameters));
+			const Result& rResult = results.back();
+			std::printf("%-72s %11.0f ns %11.0f ns %12u %16.0f",
+				rResult.name.c_str(),
+				rResult.dRealTime,
+				rResult.dCpuTime,
+				static_cast<unsigned int>(rResult.uiIterationCount),
+				rResult.dItemsPerSecond);
+
+			for (const std::pair<std::string, double>& rCounter : rResult.counters) {
+				std::printf(" %s=%g", rCounter.first.c_str(), rCounter.second);
+			}
+
+			std::printf("\n");
+			// Results are printed as they finish, so show them straight away during long runs.
+			std::fflush(stdout);
+		}
+	}
+
+	if (a_pJsonFile) {
+		WriteJson(a_pJsonFile, results);
+	}
+}
+
+BenchmarkSuite::Result BenchmarkSuite::RunBenchmark(const Benchmark& a_rBenchmark,
+	const BenchmarkParameters& a_rParameters) const {
+	const std::size_t maximumIterationCount = 1000000000;
+	std::size_t iterationCount = 1;
+
+	while (true) {
+		BenchmarkState state(a_rParameters, iterationCount);
+		a_rBenchmark.function(state);
+
+		if (state.GetRealTime() >= m_dMinimumTime || iterationCount >= maximumIterationCount) {
+			Result result;
+			result.name = a_rBenchmark.name + "/" + a_rParameters.GetName();
+			result.parameters = a_rParameters;
+			result.uiIterationCount = iterationCount;
+			result.dRealTime = state.GetRealTime() * 1e9 / iterationCount;
+			result.dCpuTime = state.GetCpuTime() * 1e9 / iterationCount;
+			result.dItemsPerSecond = state.GetRealTime() > 0.0 ?
+				state.GetItemsPerIteration() * iterationCount / state.GetRealTime() :
+				0.0;
+			result.counters = state.GetCounters();
+			return result;
+		}
+
+		// Aim a little past the minimum time so the next run is likely to be the last, like Google Benchmark does,
+		// but never grow by more than ten times in case the last run was too short to time accurately.
+		const double multiplier = state.GetRealTime() > 0.0 ?
+			std::min(10.0, m_dMinimumTime * 1.4 / state.GetRealTime()) :
+			10.0;
+		iterationCount = std::min(maximumIterationCount,
+			std::max(iterationCount + 1, static_cast<std::size_t>(iterationCount * multiplier)));
+	}
+}
+
+void BenchmarkSuite::WriteJson(std::FILE* a_pJsonFile,
+	const std::vector<Result>& a_rResults) const {
+	char date[32];
+	const std::time_t currentTime = std::time(nullptr);
+	std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&currentTime));
+	std::fprintf(a_pJsonFile, "{\n");
+	std::fprintf(a_pJsonFile, "  \"context\": {\n");
+	std::fprintf(a_pJsonFile, "    \"date\": \"%s\",\n", date);
+	std::fprintf(a_pJsonFile, "    \"num_cpus\": %u,\n", std::thread::hardware_concurrency());
+#ifdef NDEBUG
+	std::fprintf(a_pJsonFile, "    \"library_build_type\": \"release\"\n");
+#else
+	std::fprintf(a_pJsonFile, "    \"library_build_type\": \"debug\"\n");
+#endif // NDEBUG
+	std::fprintf(a_pJsonFile, "  },\n");
+	std::fprintf(a_pJsonFile, "  \"benchmarks\": [");
+
+	for (std::size_t i = 0; i < a_rResults.size(); ++i) {
+		const Result& rResult = a_rResults[i];
+		// Names only contain letters, digits, and the characters ":/.", so they never need escaping.
+		std::fprintf(a_pJsonFile, "%s\n    {\n", i > 0 ? "," : "");
+		std::fprintf(a_pJsonFile, "      \"name\": \"%s\",\n", rResult.name.c_str());
+		std::fprintf(a_pJsonFile, "      \"run_name\": \"%s\",\n", rResult.name.c_str());
+		std::fprintf(a_pJsonFile, "      \"run_type\": \"iteration\",\n");
+		std::fprintf(a_pJsonFile, "      \"iterations\": %u,\n", static_cast<unsigned int>(rResult.uiIterationCount));
+		std::fprintf(a_pJsonFile, "      \"real_time\": %.17g,\n", rResult.dRealTime);
+		std::fprintf(a_pJsonFile, "      \"cpu_time\": %.17g,\n", rResult.dCpuTime);
+		std::fprintf(a_pJsonFile, "      \"time_unit\": \"ns\",\n");
+		std::fprintf(a_pJsonFile, "      \"items_per_second\": %.17g,\n", rResult.dItemsPerSecond);
+		std::fprintf(a_pJsonFile, "      \"boids\": %u,\n", rResult.parameters.uiBoidCount);
+		std::fprintf(a_pJsonFile, "      \"density\": %.17g,\n", rResult.parameters.fDensity);
+		std::fprintf(a_pJsonFile, "      \"neighbour_distance\": %.17g", rResult.parameters.fNeighbourDistance);
+
+		for (const std::pair<std::string, double>& rCounter : rResult.counters) {
+			std::fprintf(a_pJsonFile, ",\n      \"%s\": %.17g", rCounter.first.c_str(), rCounter.second);
+		}
+
+		std::fprintf(a_pJsonFile, "\n    }");
+	}
+
+	std::fprintf(a_pJsonFile, "\n  ]\n}\n");
+}
@@ -0,0 +1,56 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+#ifndef DRAW_QUEUE_H
+#define DRAW_QUEUE_H
+
+// Forward declarations.
+class Model;
+
+/// <summary>
+/// Collects lines and copies of models so they can be drawn together, with as few draw calls as possible.
+/// Code that only queues things to draw, such as boundaries and spatial indices, draws through this interface so it
+/// doesn't need to link against the framework or OpenGL.
+/// </summary>
+class DrawQueue {
+public:
+	virtual ~DrawQueue() {}
+
+	/// <summary>
+	/// Queues a copy of a model to be drawn by the next call to DrawModelInstances.
+	/// </summary>
+	/// <param name="a_pModel"> The 3D model to draw on-screen. </param>
+	/// <param name="a_pModelMatrix"> The copy's model matrix, as sixteen floats in column-major order. </param>
+	virtual void AddModelInstance(Model* a_pModel,
+		const float* a_pModelMatrix) = 0;
+	/// <summary>
+	/// Draws every queued copy of every model, then empties the queue.
+	/// </summary>
+	virtual void DrawModelInstances() = 0;
+	/// <summary>
+	/// Queues a line to be drawn by the next call to DrawLines.
+	/// </summary>
+	/// <param name="a_pStart"> The x, y, and z coordinates of the line's first end. </param>
+	/// <param name="a_pEnd"> The x, y, and z coordinates of the line's second end. </param>
+	/// <param name="a_pColour"> The line's red, green, and blue colour values, from zero to one. </param>
+	virtual void AddLine(const float* a_pStart,
+		const float* a_pEnd,
+		const float* a_pColour) = 0;
+	/// <summary>
+	/// Queues a line along each of a box's twelve edges to be drawn by the next call to DrawLines.
+	/// </summary>
+	/// <param name="a_pCentre"> The x, y, and z coordinates of the box's centre. </param>
+	/// <param name="a_pExtents"> The box's width, height, and depth as measured outward from its centre. </param>
+	/// <param name="a_pColour"> The lines' red, green, and blue colour values, from zero to one. </param>
+	virtual void AddLineBox(const float* a_pCentre,
+		const float* a_pExtents,
+		const float* a_pColour) = 0;
+	/// <summary>
+	/// Draws every queued line, then empties the queue.
+	/// </summary>
+	virtual void DrawLines() = 0;
+};
+
+#endif // !DRAW_QUEUE_H
@@ -6,6 +6,12 @@
 #ifndef FRAMEWORK_H
 #define FRAMEWORK_H
 
+// Header includes.
+#include "DrawQueue.h"
+#include <map>
+#include <set>
+#include <vector>
+
 // Forward declarations.
 struct GLFWwindow;
 class Camera;
@@ -16,9 +22,12 @@ class Shader;
 /// A simple rendering program that handles creating a window to display 3D models
 /// and supports the use of an interactable camera to inspect the models.
 /// This is intended to act as a singleton class.
+/// Lines and copies of models are queued up through the DrawQueue interface, which the simulation draws through.
 /// </summary>
-class Framework {
+class Framework : public DrawQueue {
 public:
+	virtual ~Framework() {}
+
 	/// <summary>
 	/// Sets up the program's dependency programs and some important member variables.
 	/// </summary>
@@ -27,16 +36,19 @@ public:
 	/// <param name="a_height"> The display window's measurement in pixels across its y-axis. </param>
 	/// <param name="a_pVertexShader"> The program's shader for manipulating vertices. </param>
 	/// <param name="a_pFragmentShader"> The program's shader for colouring pixels. </param>
+	/// <param name="a_pInstancedVertexShader"> The program's shader for manipulating the vertices of many copies of a
+	/// model at once. It uses the same shader as single models for colouring pixels. </param>
 	/// <returns></returns>
 	bool Initialize(const char* a_windowName,
 		const int a_width,
 		const int a_height,
 		const char* a_pVertexShader,
 		const char* a_pFragmentShader,
+		const char* a_pInstancedVertexShader,
 		const char* a_pLineVertexShader,
 		const char* a_pLineFragmentShader);
 	/// <summary>
-	/// Updates the program's current state.
+	/// Updates the program's current state, including the camera matrices that every shader reads.
 	/// Always and only call once per frame.
 	/// </summary>
 	void Update();
@@ -46,9 +58,43 @@ public:
 	/// <param name="a_pModel"> The 3D model to draw on-screen. </param>
 	void DrawModel(Model* a_pModel);
 	/// <summary>
+	/// Queues a copy of a model to be drawn by the next call to DrawModelInstances.
+	/// </summary>
+	/// <param name="a_pModel"> The 3D model to draw on-screen. </param>
+	/// <param name="a_pModelMatrix"> The copy's model matrix, as sixteen floats in column-major order. </param>
+	virtual void AddModelInstance(Model* a_pModel,
+		const float* a_pModelMatrix);
+	/// <summary>
+	/// Draws every queued copy of every model, with one draw call for each of a model's meshes, then empties the
+	/// queue.
+	/// </summary>
+	virtual void DrawModelInstances();
+	/// <summary>
 	/// Draws a line within a 3D space.
 	/// </summary>
 	void UseLineShader();
+	/// <summary>
+	/// Queues a line to be drawn by the next call to DrawLines.
+	/// </summary>
+	/// <param name="a_pStart"> The x, y, and z coordinates of the line's first end. </param>
+	/// <param name="a_pEnd"> The x, y, and z coordinates of the line's second end. </param>
+	/// <param name="a_pColour"> The line's red, green, and blue colour values, from zero to one. </param>
+	virtual void AddLine(const float* a_pStart,
+		const float* a_pEnd,
+		const float* a_pColour);
+	/// <summary>
+	/// Queues a line along each of a box's twelve edges to be drawn by the next call to DrawLines.
+	/// </summary>
+	/// <param name="a_pCentre"> The x, y, and z coordinates of the box's centre. </param>
+	/// <param name="a_pExtents"> The box's width, height, and depth as measured outward from its centre. </param>
+	/// <param name="a_pColour"> The lines' red, green, and blue colour values, from zero to one. </param>
+	virtual void AddLineBox(const float* a_pCentre,
+		const float* a_pExtents,
+		const float* a_pColour);
+	/// <summary>
+	/// Draws every queued line with a single draw call, then empties the queue.
+	/// </summary>
+	virtual void DrawLines();
 	void Destory();
 
 	/// <summary>
@@ -83,6 +129,7 @@ public:
 	/// </summary>
 	/// <returns> An instance of this class. </returns>
 	static Framework* GetInstance();
+	inline void SetInstancedRenderingState(bool a_bInstancedRendering);
 	inline const bool GetInitializationState() const;
 	/// <summary>
 	/// Returns the program's display window.
@@ -100,6 +147,11 @@ public:
 	/// </summary>
 	/// <returns> A pointer to the program's shader. </returns>
 	inline const Shader* GetShader() const;
+	/// <summary>
+	/// Returns true if models should be queued with AddModelInstance and drawn together, rather than drawn one at a
+	/// time.
+	/// </summary>
+	inline bool GetInstancedRenderingState() const;
 	inline const unsigned int GetScreenWidth() const;
 	inline const unsigned int GetScreenHeight() const;
 
@@ -108,6 +160,17 @@ private:
 	Framework(const Framework& a_rFramework);
 	Framework& operator=(const Framework&);
 
+	/// <summary>
+	/// Points a mesh's vertex array at the instance buffer's model matrices, the first time the mesh is drawn
+	/// instanced.
+	/// </summary>
+	/// <param name="a_uiVertexArray"> The mesh's vertex array object. </param>
+	void SetUpInstanceAttributes(unsigned int a_uiVertexArray);
+	/// <summary>
+	/// Copies the camera's projection and view matrices into the camera uniform buffer.
+	/// </summary>
+	void UpdateCameraUniforms();
+
 	bool m_bInitialized;
 	const unsigned int mc_uiScreenWidth;
 	const unsigned int mc_uiScreenHeight;
@@ -128,6 +191,21 @@ private:
 	/// True after one update loop has been executed and the previous-frame's cursor coordinates have been set.
 	/// </summary>
 	bool m_bLastCursorCoordinatesSet;
+	bool m_bInstancedRendering;
+	/// <summary>
+	/// A buffer that's refilled with the model matrices of every copy of a model before they're drawn.
+	/// </summary>
+	unsigned int m_uiInstanceBuffer;
+	/// <summary>
+	/// A uniform buffer holding the camera's projection and view matrices, which is bound to every shader's camera
+	/// block so the matrices are only uploaded once a frame.
+	/// </summary>
+	unsigned int m_uiCameraUniformBuffer;
+	/// <summary>
+	/// The vertex array and buffer that every queued line is copied into before they're drawn together.
+	/// </summary>
+	unsigned int m_uiLineVertexArray;
+	unsigned int m_uiLineVertexBuffer;
 	/// <summary>
 	/// A pointer to the class' singleton instance.
 	/// </summary>
@@ -145,9 +223,27 @@ private:
 	/// </summary>
 	Shader* m_pModelShader;
 	/// <summary>
+	/// A shader for rendering many copies of a textured 3D model at once.
+	/// </summary>
+	Shader* m_pInstancedModelShader;
+	/// <summary>
 	/// A shader for rendering lines in a 3D space.
 	/// </summary>
 	Shader* m_pLineShader;
+	/// <summary>
+	/// The model matrices of every queued copy of each model, sixteen floats to a matrix. The collections are emptied
+	/// after they're drawn, rather than removed, so their memory is reused every frame.
+	/// </summary>
+	std::map<Model*, std::vector<float>> m_modelInstances;
+	/// <summary>
+	/// The vertex arrays of the meshes that have had their instance attributes set up.
+	/// </summary>
+	std::set<unsigned int> m_instancedVertexArrays;
+	/// <summary>
+	/// The position and colour of every queued line's vertices, six floats to a vertex. Emptied after the lines are
+	/// drawn, rather than freed, so its memory is reused every frame.
+	/// </summary>
+	std::vector<float> m_lineVertices;
 };
 
 const bool Framework::GetInitializationState() const {
@@ -170,6 +266,14 @@ const Shader* Framework::GetShader() const {
 	return m_pModelShader;
 }
 
+bool Framework::GetInstancedRenderingState() const {
+	return m_bInstancedRendering && m_pInstancedModelShader;
+}
+
+void Framework::SetInstancedRenderingState(bool a_bInstancedRendering) {
+	m_bInstancedRendering = a_bInstancedRendering;
+}
+
 const unsigned int Framework::GetScreenWidth() const {
 	return mc_uiScreenWidth;
 }
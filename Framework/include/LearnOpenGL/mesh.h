@@ -55,7 +55,39 @@ public:
     }
 
     // render the mesh
-    void Draw(Shader shader) 
+    void Draw(const Shader &shader) 
+    {
+        BindTextures(shader);
+        
+        // draw mesh
+        glBindVertexArray(VAO);
+        glDrawElements(GL_TRIANGLES, indices.size(), GL_UNSIGNED_INT, 0);
+        glBindVertexArray(0);
+
+        // always good practice to set everything back to defaults once configured.
+        glActiveTexture(GL_TEXTURE0);
+    }
+
+    // render many copies of the mesh with one draw call. the shader reads each copy's model matrix from the
+    // instance attributes that have been set up on the mesh's vertex array.
+    void DrawInstanced(const Shader &shader, unsigned int instanceCount)
+    {
+        BindTextures(shader);
+
+        glBindVertexArray(VAO);
+        glDrawElementsInstanced(GL_TRIANGLES, indices.size(), GL_UNSIGNED_INT, 0, instanceCount);
+        glBindVertexArray(0);
+
+        glActiveTexture(GL_TEXTURE0);
+    }
+
+private:
+    /*  Render data  */
+    unsigned int VBO, EBO;
+
+    /*  Functions    */
+    // binds the mesh's textures to the shader's samplers
+    void BindTextures(const Shader &shader)
     {
         // bind appropriate textures
         unsigned int diffuseNr  = 1;
@@ -78,25 +110,12 @@ public:
 			    number = std::to_string(heightNr++); // transfer unsigned int to stream
 
 													 // now set the sampler to the correct texture unit
-            glUniform1i(glGetUniformLocation(shader.ID, (name + number).c_str()), i);
+            shader.setInt(name + number, i);
             // and finally bind the texture
             glBindTexture(GL_TEXTURE_2D, textures[i].id);
         }
-        
-        // draw mesh
-        glBindVertexArray(VAO);
-        glDrawElements(GL_TRIANGLES, indices.size(), GL_UNSIGNED_INT, 0);
-        glBindVertexArray(0);
-
-        // always good practice to set everything back to defaults once configured.
-        glActiveTexture(GL_TEXTURE0);
     }
 
-private:
-    /*  Render data  */
-    unsigned int VBO, EBO;
-
-    /*  Functions    */
     // initializes all the buffer objects/arrays
     void setupMesh()
     {
@@ -37,8 +37,9 @@ public:
         loadModel(path);
     }
 
-    // draws the model, and thus all its meshes
-    void Draw(Shader shader)
+    // draws the model, and thus all its meshes. the shader is passed by reference so that its cached uniform
+    // locations aren't copied for every mesh.
+    void Draw(const Shader &shader)
     {
         for(unsigned int i = 0; i < meshes.size(); i++)
             meshes[i].Draw(shader);
@@ -27,16 +27,26 @@ Framework::Framework() : m_bInitialized(false),
 	m_fDeltaTime(0.0f),
 	m_fTimeOfLastFrame(0.0f),
 	m_bLastCursorCoordinatesSet(false),
+	m_bInstancedRendering(true),
+	m_uiInstanceBuffer(0),
+	m_uiCameraUniformBuffer(0),
+	m_uiLineVertexArray(0),
+	m_uiLineVertexBuffer(0),
 	m_pWindow(nullptr),
 	m_pCamera(new Camera(glm::vec3(0.0f, 0.0f, -20.0f))),
 	m_pModelShader(nullptr),
-	m_pLineShader(nullptr) {}
+	m_pInstancedModelShader(nullptr),
+	m_pLineShader(nullptr),
+	m_modelInstances(),
+	m_instancedVertexArrays(),
+	m_lineVertices() {}
 
 bool Framework::Initialize(const char* a_windowName,
 	const int a_width,
 	const int a_height,
 	const char* a_pModelVertexShader,
 	const char* a_pModelFragmentShader,
+	const char* a_pInstancedModelVertexShader,
 	const char* a_pLineVertexShader,
 	const char* a_pLineFragmentShader) {
 #pragma region GLFW Setup
@@ -96,7 +106,42 @@ bool Framework::Initialize(const char* a_windowName,
 #pragma endregion
 
 	m_pModelShader = new Shader(a_pModelVertexShader, a_pModelFragmentShader);
+	m_pInstancedModelShader = new Shader(a_pInstancedModelVertexShader, a_pModelFragmentShader);
+	glGenBuffers(1, &m_uiInstanceBuffer);
+	// Matches the binding point of the camera block in the shaders.
+	const GLuint cameraBlockBinding = 0;
+	glGenBuffers(1, &m_uiCameraUniformBuffer);
+	glBindBuffer(GL_UNIFORM_BUFFER, m_uiCameraUniformBuffer);
+	glBufferData(GL_UNIFORM_BUFFER, 2 * sizeof(glm::mat4), nullptr, GL_DYNAMIC_DRAW);
+	glBindBuffer(GL_UNIFORM_BUFFER, 0);
+	glBindBufferBase(GL_UNIFORM_BUFFER, cameraBlockBinding, m_uiCameraUniformBuffer);
 	m_pLineShader = new Shader(a_pLineVertexShader, a_pLineFragmentShader);
+	// Every line is drawn from the same buffer, so its attributes only need setting up once.
+	const GLint coordinatesPerVertex = 3;
+	const GLint coloursPerVertex = 3;
+	const GLsizei lineVertexSize = (coordinatesPerVertex + coloursPerVertex) * sizeof(float);
+	const GLuint positionAttributeIndex = 0;
+	const GLuint colourAttributeIndex = 1;
+	glGenVertexArrays(1, &m_uiLineVertexArray);
+	glGenBuffers(1, &m_uiLineVertexBuffer);
+	glBindVertexArray(m_uiLineVertexArray);
+	glBindBuffer(GL_ARRAY_BUFFER, m_uiLineVertexBuffer);
+	glVertexAttribPointer(positionAttributeIndex,
+		coordinatesPerVertex,
+		GL_FLOAT,
+		GL_FALSE,
+		lineVertexSize,
+		(void*)0);
+	glEnableVertexAttribArray(positionAttributeIndex);
+	glVertexAttribPointer(colourAttributeIndex,
+		coloursPerVertex,
+		GL_FLOAT,
+		GL_FALSE,
+		lineVertexSize,
+		(void*)(coordinatesPerVertex * sizeof(float)));
+	glEnableVertexAttribArray(colourAttributeIndex);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	glBindVertexArray(0);
 
 	// Configure global opengl state.
 	glEnable(GL_DEPTH_TEST);
@@ -118,29 +163,172 @@ void Framework::Update() {
 	m_fDeltaTime = currentTime - m_fTimeOfLastFrame;
 	m_fTimeOfLastFrame = currentTime;
 	ProcessInput(m_pWindow);
+	UpdateCameraUniforms();
 }
 
 void Framework::DrawModel(Model* a_pModel) {
-	if (!m_pModelShader || !m_pCamera || !a_pModel) {
+	if (!m_pModelShader || !a_pModel) {
 		return;
 	}
 
-	// Don't forget to enable shader before setting uniforms.
+	// The view and projection transforms are already in the camera uniform buffer.
 	m_pModelShader->use();
-	// view/projection transforms.
-	m_pModelShader->setMat4("projection", m_pCamera->GetProjectionMatrix(mc_uiScreenWidth, mc_uiScreenHeight));
-	m_pModelShader->setMat4("view", m_pCamera->GetViewMatrix());
 	a_pModel->Draw(*m_pModelShader);
 }
 
+void Framework::AddModelInstance(Model* a_pModel,
+	const float* a_pModelMatrix) {
+	if (!a_pModel || !a_pModelMatrix) {
+		return;
+	}
+
+	const unsigned int floatsPerMatrix = 16;
+	std::vector<float>& rMatrices = m_modelInstances[a_pModel];
+	rMatrices.insert(rMatrices.end(), a_pModelMatrix, a_pModelMatrix + floatsPerMatrix);
+}
+
+void Framework::DrawModelInstances() {
+	if (!m_pInstancedModelShader) {
+		return;
+	}
+
+	const unsigned int floatsPerMatrix = 16;
+	m_pInstancedModelShader->use();
+
+	for (std::map<Model*, std::vector<float>>::iterator iterator = m_modelInstances.begin();
+		iterator != m_modelInstances.end();
+		++iterator) {
+		std::vector<float>& rMatrices = iterator->second;
+
+		if (rMatrices.empty()) {
+			continue;
+		}
+
+		const GLsizeiptr matricesSize = rMatrices.size() * sizeof(float);
+		glBindBuffer(GL_ARRAY_BUFFER, m_uiInstanceBuffer);
+		// Give the buffer new storage before filling it, so the driver doesn't have to wait for the previous draw
+		// calls to finish reading the old matrices.
+		glBufferData(GL_ARRAY_BUFFER, matricesSize, nullptr, GL_STREAM_DRAW);
+		glBufferSubData(GL_ARRAY_BUFFER, 0, matricesSize, rMatrices.data());
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+		const unsigned int instanceCount = static_cast<unsigned int>(rMatrices.size() / floatsPerMatrix);
+
+		for (Mesh& rMesh : iterator->first->meshes) {
+			SetUpInstanceAttributes(rMesh.VAO);
+			rMesh.DrawInstanced(*m_pInstancedModelShader, instanceCount);
+		}
+
+		rMatrices.clear();
+	}
+}
+
+void Framework::SetUpInstanceAttributes(unsigned int a_uiVertexArray) {
+	if (m_instancedVertexArrays.count(a_uiVertexArray)) {
+		return;
+	}
+
+	// A matrix attribute takes up four locations, one for each of its columns. The mesh's own attributes use
+	// locations zero to four.
+	const GLuint firstAttributeIndex = 5;
+	const GLint floatsPerColumn = 4;
+	const GLsizei matrixSize = floatsPerColumn * floatsPerColumn * sizeof(float);
+	glBindVertexArray(a_uiVertexArray);
+	glBindBuffer(GL_ARRAY_BUFFER, m_uiInstanceBuffer);
+
+	for (GLuint column = 0; column < 4; ++column) {
+		glEnableVertexAttribArray(firstAttributeIndex + column);
+		glVertexAttribPointer(firstAttributeIndex + column,
+			floatsPerColumn,
+			GL_FLOAT,
+			GL_FALSE,
+			matrixSize,
+			(void*)(column * floatsPerColumn * sizeof(float)));
+		// Move on to the next matrix once per instance, rather than once per vertex.
+		glVertexAttribDivisor(firstAttributeIndex + column, 1);
+	}
+
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	glBindVertexArray(0);
+	m_instancedVertexArrays.insert(a_uiVertexArray);
+}
+
 void Framework::UseLineShader() {
-	if (!m_pLineShader || !m_pCamera) {
+	if (!m_pLineShader) {
 		return;
 	}
 
 	m_pLineShader->use();
-	m_pLineShader->setMat4("projection", m_pCamera->GetProjectionMatrix(mc_uiScreenWidth, mc_uiScreenHeight));
-	m_pLineShader->setMat4("view", m_pCamera->GetViewMatrix());
+}
+
+void Framework::UpdateCameraUniforms() {
+	if (!m_pCamera || m_uiCameraUniformBuffer == 0) {
+		return;
+	}
+
+	// Laid out the same as the shaders' std140 camera block: the projection matrix followed by the view matrix.
+	const glm::mat4 cameraMatrices[2] = {
+		m_pCamera->GetProjectionMatrix(mc_uiScreenWidth, mc_uiScreenHeight),
+		m_pCamera->GetViewMatrix()
+	};
+	glBindBuffer(GL_UNIFORM_BUFFER, m_uiCameraUniformBuffer);
+	glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(cameraMatrices), cameraMatrices);
+	glBindBuffer(GL_UNIFORM_BUFFER, 0);
+}
+
+void Framework::AddLine(const float* a_pStart,
+	const float* a_pEnd,
+	const float* a_pColour) {
+	m_lineVertices.insert(m_lineVertices.end(), a_pStart, a_pStart + 3);
+	m_lineVertices.insert(m_lineVertices.end(), a_pColour, a_pColour + 3);
+	m_lineVertices.insert(m_lineVertices.end(), a_pEnd, a_pEnd + 3);
+	m_lineVertices.insert(m_lineVertices.end(), a_pColour, a_pColour + 3);
+}
+
+void Framework::AddLineBox(const float* a_pCentre,
+	const float* a_pExtents,
+	const float* a_pColour) {
+	// The box's corners, numbered so that each bit of the index picks the upper (1) or lower (0) extent along the
+	// x (1), y (2), and z (4) axes.
+	const unsigned int cornerCount = 8;
+	float corners[cornerCount][3];
+
+	for (unsigned int i = 0; i < cornerCount; ++i) {
+		corners[i][0] = a_pCentre[0] + ((i & 1) ? a_pExtents[0] : -a_pExtents[0]);
+		corners[i][1] = a_pCentre[1] + ((i & 2) ? a_pExtents[1] : -a_pExtents[1]);
+		corners[i][2] = a_pCentre[2] + ((i & 4) ? a_pExtents[2] : -a_pExtents[2]);
+	}
+
+	// Each edge joins two corners that only differ along one axis.
+	const unsigned int edgeCount = 12;
+	const unsigned int edges[edgeCount][2] = {
+		{ 0, 1 }, { 2, 3 }, { 4, 5 }, { 6, 7 },
+		{ 0, 2 }, { 1, 3 }, { 4, 6 }, { 5, 7 },
+		{ 0, 4 }, { 1, 5 }, { 2, 6 }, { 3, 7 }
+	};
+
+	for (unsigned int i = 0; i < edgeCount; ++i) {
+		AddLine(corners[edges[i][0]], corners[edges[i][1]], a_pColour);
+	}
+}
+
+void Framework::DrawLines() {
+	if (m_lineVertices.empty() || m_uiLineVertexBuffer == 0) {
+		return;
+	}
+
+	const GLsizei floatsPerVertex = 6;
+	glBindBuffer(GL_ARRAY_BUFFER, m_uiLineVertexBuffer);
+	// Orphans the buffer's previous storage so the driver doesn't wait for last frame's lines to finish drawing.
+	glBufferData(GL_ARRAY_BUFFER,
+		m_lineVertices.size() * sizeof(float),
+		m_lineVertices.data(),
+		GL_STREAM_DRAW);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	UseLineShader();
+	glBindVertexArray(m_uiLineVertexArray);
+	glDrawArrays(GL_LINES, 0, m_lineVertices.size() / floatsPerVertex);
+	glBindVertexArray(0);
+	m_lineVertices.clear();
 }
 
 void Framework::Destory() {
@@ -148,6 +336,16 @@ void Framework::Destory() {
 	m_pCamera = nullptr;
 	delete m_pModelShader;
 	m_pModelShader = nullptr;
+	delete m_pInstancedModelShader;
+	m_pInstancedModelShader = nullptr;
+	glDeleteBuffers(1, &m_uiInstanceBuffer);
+	m_uiInstanceBuffer = 0;
+	glDeleteBuffers(1, &m_uiCameraUniformBuffer);
+	m_uiCameraUniformBuffer = 0;
+	glDeleteVertexArrays(1, &m_uiLineVertexArray);
+	m_uiLineVertexArray = 0;
+	glDeleteBuffers(1, &m_uiLineVertexBuffer);
+	m_uiLineVertexBuffer = 0;
 	delete m_pLineShader;
 	m_pLineShader = nullptr;
 	// Clean up imgui
@@ -0,0 +1,41 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+#ifndef BRAIN_TESTS_H
+#define BRAIN_TESTS_H
+
+/// <summary>
+/// Checks that the boids' brains steer the same way however their neighbours are found.
+/// </summary>
+namespace BrainTests {
+	/// <summary>
+	/// Checks that boids perceiving each other through cell aggregates with an opening angle of zero steer exactly as
+	/// they do when every boid within the perception distance is found one by one, that wider opening angles perceive
+	/// the same number of boids, and that distant boids given as totals pull on alignment and cohesion as much as the
+	/// same boids given one by one.
+	/// </summary>
+	/// <returns> True if every boid matched. </returns>
+	bool CheckCellAggregatesMatchExactSteering();
+	/// <summary>
+	/// Checks that boids with metric neighbourhoods, and no cell aggregates, still steer by the formulas they used
+	/// before cell aggregates were added, which average and normalise each force after every neighbour.
+	/// </summary>
+	/// <returns> True if every boid matched. </returns>
+	bool CheckMetricSteeringMatchesBaseline();
+	/// <summary>
+	/// Checks that boids with topological neighbourhoods find as many other boids as they should, and never
+	/// themselves, even when several boids share a position.
+	/// </summary>
+	/// <returns> True if every boid matched. </returns>
+	bool CheckTopologicalNeighboursExcludeSelf();
+	/// <summary>
+	/// Checks that boids finding their neighbours from the scene's neighbour lists find the same ones as querying the
+	/// spatial index while they move, and that the lists are rebuilt once they've moved far enough but not every step.
+	/// </summary>
+	/// <returns> True if every boid matched. </returns>
+	bool CheckNeighbourListsMatchQueries();
+}
+
+#endif // !BRAIN_TESTS_H
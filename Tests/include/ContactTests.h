@@ -0,0 +1,22 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+#ifndef CONTACT_TESTS_H
+#define CONTACT_TESTS_H
+
+/// <summary>
+/// Checks that the broadphase and contact cache find the same contacts as testing every pair of colliders.
+/// </summary>
+namespace ContactTests {
+	/// <summary>
+	/// Checks that staggered updates list exactly the overlapping pairs that a due collider is in, keep the contacts
+	/// between colliders that aren't due, and hold exactly the overlapping pairs once every collider has been due
+	/// since the colliders last moved.
+	/// </summary>
+	/// <returns> True if every update matched. </returns>
+	bool CheckStaggeredContactsMatchBruteForce();
+}
+
+#endif // !CONTACT_TESTS_H
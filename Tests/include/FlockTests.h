@@ -0,0 +1,32 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+#ifndef FLOCK_TESTS_H
+#define FLOCK_TESTS_H
+
+/// <summary>
+/// Checks that the flock system's faster paths behave the same as its simplest ones, and as the boids' brains.
+/// </summary>
+namespace FlockTests {
+	/// <summary>
+	/// Checks that every supported instruction set finds the same neighbours as the scalar kernel, and adds up their
+	/// contributions to within float rounding, over runs of boids of every length up to a few registers wide.
+	/// </summary>
+	/// <returns> True if every run matched. </returns>
+	bool CheckKernelsMatchScalar();
+	/// <summary>
+	/// Checks that every supported instruction set adds up the same neighbours' velocities and directions as a boid's
+	/// brain does, for boids in the same places with the same velocities.
+	/// </summary>
+	/// <returns> True if every boid matched. </returns>
+	bool CheckKernelsMatchBrains();
+	/// <summary>
+	/// Checks that a flock moves identically when it's updated by one thread and by every hardware thread.
+	/// </summary>
+	/// <returns> True if every boid ended up in the same place. </returns>
+	bool CheckThreadCountIsDeterministic();
+}
+
+#endif // !FLOCK_TESTS_H
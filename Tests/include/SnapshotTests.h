@@ -0,0 +1,21 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+#ifndef SNAPSHOT_TESTS_H
+#define SNAPSHOT_TESTS_H
+
+/// <summary>
+/// Checks that scene snapshots draw the same models however they're culled.
+/// </summary>
+namespace SnapshotTests {
+	/// <summary>
+	/// Checks that culling a snapshot's models by cell draws exactly the models that testing each one against the
+	/// camera's view would, wherever they are drawn between the previous step and the newest one.
+	/// </summary>
+	/// <returns> True if every view drew the same models. </returns>
+	bool CheckCellCullingMatchesModels();
+}
+
+#endif // !SNAPSHOT_TESTS_H
@@ -0,0 +1,33 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+#ifndef SPATIAL_INDEX_TESTS_H
+#define SPATIAL_INDEX_TESTS_H
+
+/// <summary>
+/// Checks that every spatial index finds the same objects as checking each object in turn.
+/// </summary>
+namespace SpatialIndexTests {
+	/// <summary>
+	/// Checks that the oct-tree, hash grid and linear oct-tree find every object whose bounds overlap a volume, and
+	/// no others, as objects move, leave the indices' areas and are removed.
+	/// </summary>
+	/// <returns> True if every query matched. </returns>
+	bool CheckQueriesMatchBruteForce();
+	/// <summary>
+	/// Checks that the oct-tree, hash grid and linear oct-tree find the nearest objects to a position, in order,
+	/// for positions both inside and outside of their areas.
+	/// </summary>
+	/// <returns> True if every query matched. </returns>
+	bool CheckNearestQueriesMatchBruteForce();
+	/// <summary>
+	/// Checks that the oct-tree's volume queries, as used to cull objects against the camera's frustum, find every
+	/// object that the volume can't rule out, including objects that have left the oct-tree's area.
+	/// </summary>
+	/// <returns> True if every query matched. </returns>
+	bool CheckVolumeQueriesMatchBruteForce();
+}
+
+#endif // !SPATIAL_INDEX_TESTS_H
@@ -0,0 +1,415 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+// File's header.
+#include "BrainTests.h"
+#include "BoundingBox.h"
+#include "BrainComponent.h"
+#include "ColliderComponent.h"
+#include "Entity.h"
+#include "glm/glm.hpp"
+#include "OctTree.h"
+#include "Scene.h"
+#include "TransformComponent.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+namespace {
+	typedef OctTree<Entity, glm::vec3>::Aggregate Aggregate;
+
+	const unsigned int boidCount = 1000;
+	/// <summary>
+	/// The width, height, and depth of the scene, as measured outward from its centre. Wider than the application's
+	/// so that the perception distance doesn't reach across all of it.
+	/// </summary>
+	const float sceneExtent = 20.0f;
+	/// <summary>
+	/// Each force is normalised and weighted by a value below one, so the steering velocities are at most a few units
+	/// long and only drift apart by the rounding of adding their neighbours up in a different order.
+	/// </summary>
+	const float tolerance = 1e-4f;
+
+	/// <summary>
+	/// Adds a boid that steers by its own brain to a scene.
+	/// </summary>
+	void AddBoid(Scene& a_rScene,
+		const glm::vec3& a_rPosition) {
+		const glm::vec3 boidDimensions(0.33f, 0.15f, 0.33f);
+		Entity* pBoid = a_rScene.CreateEntity();
+		TransformComponent* pTransform = a_rScene.CreateComponent<TransformComponent>(pBoid);
+		pTransform->SetMatrixRow(TransformComponent::MATRIX_ROW_POSITION_VECTOR, a_rPosition);
+		pBoid->AddComponent(COMPONENT_TYPE_TRANSFORM, static_cast<Component*>(pTransform));
+		ColliderComponent* pCollider = a_rScene.CreateComponent<ColliderComponent>(pBoid);
+		pCollider->SetDimensions(boidDimensions);
+		pBoid->AddComponent(COMPONENT_TYPE_COLLIDER, pCollider);
+		BrainComponent* pBrain = a_rScene.CreateComponent<BrainComponent>(pBoid, &a_rScene);
+		pBoid->AddComponent(COMPONENT_TYPE_BRAIN, static_cast<Component*>(pBrain));
+		pBoid->SetTag("Boid");
+		a_rScene.AddEntity(pBoid);
+	}
+
+	/// <summary>
+	/// Fills a scene with boids that each steer by their own brain, scattered randomly around it.
+	/// </summary>
+	void AddRandomBoids(Scene& a_rScene) {
+		std::mt19937 randomGenerator(boidCount);
+		std::uniform_real_distribution<float> randomPosition(-sceneExtent, sceneExtent);
+
+		for (unsigned int i = 0; i < boidCount; ++i) {
+			AddBoid(a_rScene,
+				glm::vec3(randomPosition(randomGenerator),
+					randomPosition(randomGenerator),
+					randomPosition(randomGenerator)));
+		}
+	}
+
+	glm::vec3 GetPosition(const Entity* a_pEntity) {
+		const TransformComponent* pTransform = static_cast<TransformComponent*>(a_pEntity->GetComponentOfType(COMPONENT_TYPE_TRANSFORM));
+		return (glm::vec3)pTransform->GetMatrixRow(TransformComponent::MATRIX_ROW_POSITION_VECTOR);
+	}
+
+	/// <summary>
+	/// Steers a boid the way brains did before distant boids could be summed up, by adding each neighbour to every
+	/// force and averaging and normalising after each one. Boids sharing the boid's position are left out, as they
+	/// would be pushed apart at random.
+	/// </summary>
+	glm::vec3 CalculateBaselineFlockingVelocity(const Entity* a_pEntity,
+		const glm::vec3& a_rPosition,
+		const pEntityVector& a_rNearbyEntities) {
+		const float neighbourCount = static_cast<float>(a_rNearbyEntities.size());
+		glm::vec3 separationVelocity(0.0f);
+		glm::vec3 alignmentVelocity(0.0f);
+		glm::vec3 cohesionVelocity(0.0f);
+
+		for (const Entity* pNearbyEntity : a_rNearbyEntities) {
+			const BrainComponent* pNearbyBrain = static_cast<BrainComponent*>(pNearbyEntity->GetComponentOfType(COMPONENT_TYPE_BRAIN));
+
+			if (pNearbyEntity == a_pEntity || !pNearbyBrain || GetPosition(pNearbyEntity) == a_rPosition) {
+				continue;
+			}
+
+			const glm::vec3 directionToNearbyEntity = GetPosition(pNearbyEntity) - a_rPosition;
+			separationVelocity -= directionToNearbyEntity;
+
+			if (glm::length(separationVelocity) > 0.0f) {
+				separationVelocity = glm::normalize(separationVelocity / neighbourCount);
+			}
+
+			alignmentVelocity += pNearbyBrain->GetVelocity();
+
+			if (glm::length(alignmentVelocity) > 0.0f) {
+				alignmentVelocity = glm::normalize(alignmentVelocity / neighbourCount);
+			}
+
+			cohesionVelocity += directionToNearbyEntity;
+
+			if (glm::length(cohesionVelocity) > 0.0f) {
+				cohesionVelocity = glm::normalize(cohesionVelocity / neighbourCount - a_rPosition);
+			}
+		}
+
+		return separationVelocity * BrainComponent::GetSeparationForce() +
+			alignmentVelocity * BrainComponent::GetAlignmentForce() +
+			cohesionVelocity * BrainComponent::GetCohesionForce();
+	}
+}
+
+bool BrainTests::CheckCellAggregatesMatchExactSteering() {
+	// The brains wander using the standard random number generator.
+	srand(boidCount);
+	const unsigned int frameCount = 30;
+	const float deltaTime = 1.0f / 60.0f;
+	// Matches the scene's default opening angle.
+	const float openingAngle = 0.5f;
+	const float previousSeparationForce = BrainComponent::GetSeparationForce();
+	Scene scene(Scene::SPATIAL_INDEX_TYPE_OCT_TREE, false, sceneExtent);
+	AddRandomBoids(scene);
+	scene.SetCellAggregateState(true);
+	scene.SetOpeningAngle(0.0f);
+
+	// Gets the boids moving, so that alignment has velocities to line up with.
+	for (unsigned int frame = 0; frame < frameCount; ++frame) {
+		scene.Step(deltaTime, true);
+	}
+
+	const Aggregate noDistantBoids = {};
+	pEntityVector nearbyEntities;
+	pEntityVector exactEntities;
+	pEntityVector splitEntities;
+	Aggregate distantBoids;
+	unsigned int exactMismatchCount = 0;
+	unsigned int countMismatchCount = 0;
+	unsigned int splitMismatchCount = 0;
+	unsigned int checkCount = 0;
+
+	// Finds every boid within the perception distance one by one, as an opening angle of zero should.
+	auto findExactEntities = [&scene, &exactEntities](const glm::vec3& a_rPosition) {
+		exactEntities.clear();
+		scene.GetSpatialIndex().Query(BoundingBox<glm::vec3>(a_rPosition,
+			glm::vec3(BrainComponent::GetPerceptionDistance())),
+			exactEntities);
+	};
+
+	for (const Entity* pEntity : scene.GetAllEntities()) {
+		const BrainComponent* pBrain = pEntity ?
+			static_cast<BrainComponent*>(pEntity->GetComponentOfType(COMPONENT_TYPE_BRAIN)) :
+			nullptr;
+
+		if (!pBrain) {
+			continue;
+		}
+
+		const glm::vec3 position = GetPosition(pEntity);
+		findExactEntities(position);
+		const glm::vec3 exactVelocity = pBrain->CalculateFlockingVelocity(position, exactEntities, noDistantBoids);
+		pBrain->GetNeighbouringEntities(position, nearbyEntities, distantBoids);
+		const glm::vec3 velocity = pBrain->CalculateFlockingVelocity(position, nearbyEntities, distantBoids);
+		++checkCount;
+
+		if (distantBoids.uiCount != 0 || glm::length(velocity - exactVelocity) > tolerance) {
+			++exactMismatchCount;
+		}
+	}
+
+	// Wider opening angles sum up some of the boids instead, but still perceive every one of them. The aggregates
+	// are only updated when the scene steps, so the opening angle is changed before stepping.
+	scene.SetOpeningAngle(openingAngle);
+	scene.Step(deltaTime, true);
+	unsigned int aggregatedCount = 0;
+
+	for (const Entity* pEntity : scene.GetAllEntities()) {
+		const BrainComponent* pBrain = pEntity ?
+			static_cast<BrainComponent*>(pEntity->GetComponentOfType(COMPONENT_TYPE_BRAIN)) :
+			nullptr;
+
+		if (!pBrain) {
+			continue;
+		}
+
+		// The spatial index holds the positions that the boids had before the step moved them.
+		const glm::vec3 position = GetPosition(pEntity) - pBrain->GetVelocity() * deltaTime;
+		findExactEntities(position);
+		pBrain->GetNeighbouringEntities(position, nearbyEntities, distantBoids);
+		aggregatedCount += distantBoids.uiCount;
+
+		if (nearbyEntities.size() + distantBoids.uiCount != exactEntities.size()) {
+			++countMismatchCount;
+		}
+	}
+
+	// Hands the boids beyond the neighbour distance over as totals and checks that they steer the boid just as much as
+	// when they're given one by one. Separation is switched off as it's meant to leave the totals out.
+	BrainComponent::SetSeparationForce(0.0f);
+
+	for (const Entity* pEntity : scene.GetAllEntities()) {
+		const BrainComponent* pBrain = pEntity ?
+			static_cast<BrainComponent*>(pEntity->GetComponentOfType(COMPONENT_TYPE_BRAIN)) :
+			nullptr;
+
+		if (!pBrain) {
+			continue;
+		}
+
+		const glm::vec3 position = GetPosition(pEntity);
+		findExactEntities(position);
+		splitEntities.clear();
+		distantBoids = noDistantBoids;
+
+		for (Entity* pNearbyEntity : exactEntities) {
+			const BrainComponent* pNearbyBrain = static_cast<BrainComponent*>(pNearbyEntity->GetComponentOfType(COMPONENT_TYPE_BRAIN));
+			const glm::vec3 offset = GetPosition(pNearbyEntity) - position;
+			const float neighbourDistance = pBrain->GetNeighbourDistance();
+
+			if (pNearbyEntity == pEntity || !pNearbyBrain || glm::dot(offset, offset) <= neighbourDistance * neighbourDistance) {
+				splitEntities.push_back(pNearbyEntity);
+			} else {
+				++distantBoids.uiCount;
+				distantBoids.positionSum += GetPosition(pNearbyEntity);
+				distantBoids.valueSum += pNearbyBrain->GetVelocity();
+			}
+		}
+
+		const glm::vec3 exactVelocity = pBrain->CalculateFlockingVelocity(position, exactEntities, noDistantBoids);
+		const glm::vec3 splitVelocity = pBrain->CalculateFlockingVelocity(position, splitEntities, distantBoids);
+
+		if (glm::length(splitVelocity - exactVelocity) > tolerance) {
+			++splitMismatchCount;
+		}
+	}
+
+	BrainComponent::SetSeparationForce(previousSeparationForce);
+	std::printf("Brains: %u boids at an opening angle of 0 checked against exact steering: %u mismatched\n",
+		checkCount,
+		exactMismatchCount);
+	std::printf("Brains: %u boids at an opening angle of %g checked for perceiving every boid: %u mismatched "
+		"(%u perceived through aggregates)\n",
+		checkCount,
+		openingAngle,
+		countMismatchCount,
+		aggregatedCount);
+	std::printf("Brains: %u boids steered by distant totals checked against steering one by one: %u mismatched\n",
+		checkCount,
+		splitMismatchCount);
+	return exactMismatchCount == 0 && countMismatchCount == 0 && splitMismatchCount == 0 && aggregatedCount > 0;
+}
+
+bool BrainTests::CheckMetricSteeringMatchesBaseline() {
+	srand(boidCount);
+	const unsigned int frameCount = 30;
+	const float deltaTime = 1.0f / 60.0f;
+	Scene scene(Scene::SPATIAL_INDEX_TYPE_OCT_TREE, false, sceneExtent);
+	AddRandomBoids(scene);
+
+	for (unsigned int frame = 0; frame < frameCount; ++frame) {
+		scene.Step(deltaTime, true);
+	}
+
+	pEntityVector nearbyEntities;
+	Aggregate distantBoids;
+	unsigned int mismatchCount = 0;
+	unsigned int checkCount = 0;
+	unsigned int neighbourCount = 0;
+
+	for (const Entity* pEntity : scene.GetAllEntities()) {
+		const BrainComponent* pBrain = pEntity ?
+			static_cast<BrainComponent*>(pEntity->GetComponentOfType(COMPONENT_TYPE_BRAIN)) :
+			nullptr;
+
+		if (!pBrain) {
+			continue;
+		}
+
+		const glm::vec3 position = GetPosition(pEntity);
+		pBrain->GetNeighbouringEntities(position, nearbyEntities, distantBoids);
+		const glm::vec3 velocity = pBrain->CalculateFlockingVelocity(position, nearbyEntities, distantBoids);
+		const glm::vec3 baselineVelocity = CalculateBaselineFlockingVelocity(pEntity, position, nearbyEntities);
+		neighbourCount += nearbyEntities.size();
+		++checkCount;
+
+		if (distantBoids.uiCount != 0 || glm::length(velocity - baselineVelocity) > tolerance) {
+			++mismatchCount;
+		}
+	}
+
+	std::printf("Brains: %u boids with metric neighbourhoods checked against the baseline formulas: %u mismatched "
+		"(%.1f neighbours each)\n",
+		checkCount,
+		mismatchCount,
+		checkCount > 0 ? static_cast<float>(neighbourCount) / checkCount : 0.0f);
+	return mismatchCount == 0 && checkCount == boidCount;
+}
+
+bool BrainTests::CheckTopologicalNeighboursExcludeSelf() {
+	// More boids share a position than each boid has neighbours, so the spatial index can find any of them first.
+	const unsigned int stackedBoidCount = BrainComponent::GetTopologicalNeighbourCount() + 2;
+	const BrainComponent::NEIGHBOURHOOD_TYPE neighbourhoodType = BrainComponent::GetNeighbourhoodType();
+	Scene scene(Scene::SPATIAL_INDEX_TYPE_OCT_TREE, false, sceneExtent);
+	AddRandomBoids(scene);
+
+	for (unsigned int i = 0; i < stackedBoidCount; ++i) {
+		AddBoid(scene, glm::vec3(0.0f));
+	}
+
+	BrainComponent::SetNeighbourhoodType(BrainComponent::NEIGHBOURHOOD_TYPE_TOPOLOGICAL);
+	pEntityVector nearbyEntities;
+	Aggregate distantBoids;
+	unsigned int mismatchCount = 0;
+	unsigned int checkCount = 0;
+
+	for (const Entity* pEntity : scene.GetAllEntities()) {
+		const BrainComponent* pBrain = pEntity ?
+			static_cast<BrainComponent*>(pEntity->GetComponentOfType(COMPONENT_TYPE_BRAIN)) :
+			nullptr;
+
+		if (!pBrain) {
+			continue;
+		}
+
+		pBrain->GetNeighbouringEntities(GetPosition(pEntity), nearbyEntities, distantBoids);
+		std::sort(nearbyEntities.begin(), nearbyEntities.end());
+		++checkCount;
+
+		if (nearbyEntities.size() != BrainComponent::GetTopologicalNeighbourCount() ||
+			std::find(nearbyEntities.begin(), nearbyEntities.end(), pEntity) != nearbyEntities.end() ||
+			std::adjacent_find(nearbyEntities.begin(), nearbyEntities.end()) != nearbyEntities.end()) {
+			++mismatchCount;
+		}
+	}
+
+	BrainComponent::SetNeighbourhoodType(neighbourhoodType);
+	std::printf("Brains: %u boids with topological neighbourhoods, %u of them sharing a position, checked for %u "
+		"other neighbours each: %u mismatched\n",
+		checkCount,
+		stackedBoidCount,
+		BrainComponent::GetTopologicalNeighbourCount(),
+		mismatchCount);
+	return mismatchCount == 0 && checkCount == boidCount + stackedBoidCount;
+}
+
+bool BrainTests::CheckNeighbourListsMatchQueries() {
+	srand(boidCount);
+	// Long enough for the boids to move further than the lists' skin several times over.
+	const unsigned int frameCount = 180;
+	const unsigned int checkInterval = 10;
+	const float deltaTime = 1.0f / 60.0f;
+	Scene scene(Scene::SPATIAL_INDEX_TYPE_OCT_TREE, false, sceneExtent);
+	AddRandomBoids(scene);
+	scene.SetNeighbourListState(true);
+	pEntityVector nearbyEntities;
+	pEntityVector queriedEntities;
+	Aggregate distantBoids;
+	unsigned int mismatchCount = 0;
+	unsigned int checkCount = 0;
+
+	for (unsigned int frame = 0; frame < frameCount; ++frame) {
+		scene.Step(deltaTime, true);
+
+		if (frame % checkInterval != 0) {
+			continue;
+		}
+
+		// Brings the spatial index up-to-date with where the boids moved to, as it would be when they next steer,
+		// without moving them or checking the lists.
+		scene.Step(0.0f, false);
+
+		for (const Entity* pEntity : scene.GetAllEntities()) {
+			const BrainComponent* pBrain = pEntity ?
+				static_cast<BrainComponent*>(pEntity->GetComponentOfType(COMPONENT_TYPE_BRAIN)) :
+				nullptr;
+
+			if (!pBrain) {
+				continue;
+			}
+
+			const glm::vec3 position = GetPosition(pEntity);
+			pBrain->GetNeighbouringEntities(position, nearbyEntities, distantBoids);
+			queriedEntities.clear();
+			scene.GetSpatialIndex().Query(BoundingBox<glm::vec3>(position, glm::vec3(pBrain->GetNeighbourDistance())),
+				queriedEntities);
+			std::sort(nearbyEntities.begin(), nearbyEntities.end());
+			std::sort(queriedEntities.begin(), queriedEntities.end());
+			++checkCount;
+
+			if (nearbyEntities != queriedEntities) {
+				++mismatchCount;
+			}
+		}
+	}
+
+	const NeighbourList& rNeighbourList = scene.GetNeighbourList();
+	std::printf("Brains: %u boids with neighbour lists checked against spatial index queries: %u mismatched (rebuilt "
+		"on %u of %u steps)\n",
+		checkCount,
+		mismatchCount,
+		rNeighbourList.GetBuildCount(),
+		rNeighbourList.GetUpdateCount());
+	return mismatchCount == 0 &&
+		checkCount > 0 &&
+		rNeighbourList.GetBuildCount() > 1 &&
+		rNeighbourList.GetBuildCount() < rNeighbourList.GetUpdateCount();
+}
@@ -0,0 +1,181 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+// File's header.
+#include "ContactTests.h"
+#include "BoundingBox.h"
+#include "ColliderComponent.h"
+#include "ContactCache.h"
+#include "Entity.h"
+#include "glm/glm.hpp"
+#include "Scene.h"
+#include "StaggeredSchedule.h"
+#include "SweepAndPrune.h"
+#include "TransformComponent.h"
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace {
+	typedef std::pair<unsigned int, unsigned int> SlotPair;
+
+	const unsigned int colliderCount = 2000;
+	/// <summary>
+	/// Small enough for each collider to overlap a few others, with the last colliders stacked on one point so that
+	/// a burst of contacts begins and ends as they spread out.
+	/// </summary>
+	const float sceneExtent = 6.0f;
+	const unsigned int stackedColliderCount = 200;
+	const unsigned int movingUpdateCount = 30;
+	const float colliderStep = 0.1f;
+
+	/// <summary>
+	/// Orders a pair of slots so that either order of the same two colliders gives the same pair.
+	/// </summary>
+	SlotPair MakeSlotPair(unsigned int a_uiFirstSlot,
+		unsigned int a_uiSecondSlot) {
+		return a_uiFirstSlot < a_uiSecondSlot ? SlotPair(a_uiFirstSlot, a_uiSecondSlot) :
+			SlotPair(a_uiSecondSlot, a_uiFirstSlot);
+	}
+
+	/// <summary>
+	/// Tests every pair of colliders, with touching colliders counted as overlapping as the broadphase does.
+	/// </summary>
+	/// <param name="a_pSchedule"> Only pairs that a due collider is in are found. Null to find every pair. </param>
+	std::vector<SlotPair> FindOverlappingPairs(const std::vector<ColliderComponent*>& a_rColliders,
+		const StaggeredSchedule* a_pSchedule,
+		unsigned int a_uiTick) {
+		std::vector<SlotPair> pairs;
+
+		for (unsigned int i = 0; i < a_rColliders.size(); ++i) {
+			const BoundingBox<glm::vec3> first = a_rColliders[i]->GetBoundary()->GetBoundingBox();
+			const unsigned int firstSlot = a_rColliders[i]->GetEntity()->GetHandle().uiIndex;
+			const bool firstDue = !a_pSchedule || a_pSchedule->IsDue(a_uiTick, firstSlot);
+
+			for (unsigned int j = i + 1; j < a_rColliders.size(); ++j) {
+				const BoundingBox<glm::vec3> second = a_rColliders[j]->GetBoundary()->GetBoundingBox();
+				const unsigned int secondSlot = a_rColliders[j]->GetEntity()->GetHandle().uiIndex;
+
+				if (!firstDue && !a_pSchedule->IsDue(a_uiTick, secondSlot)) {
+					continue;
+				}
+
+				const glm::vec3 offset = glm::abs(first.GetPosition() - second.GetPosition());
+				const glm::vec3 reach = first.GetDimensions() + second.GetDimensions();
+
+				if (offset.x <= reach.x && offset.y <= reach.y && offset.z <= reach.z) {
+					pairs.push_back(MakeSlotPair(firstSlot, secondSlot));
+				}
+			}
+		}
+
+		std::sort(pairs.begin(), pairs.end());
+		return pairs;
+	}
+
+	/// <summary>
+	/// Returns the pairs in the contact cache's last update that haven't ended, sorted.
+	/// </summary>
+	/// <param name="a_rUncheckedEndCount"> Set to the number of contacts that ended without either of their colliders
+	/// being due, which should have been kept. </param>
+	std::vector<SlotPair> GetTouchingPairs(const ContactCache& a_rContacts,
+		const StaggeredSchedule& a_rSchedule,
+		unsigned int a_uiTick,
+		unsigned int& a_rUncheckedEndCount) {
+		std::vector<SlotPair> pairs;
+		a_rUncheckedEndCount = 0;
+
+		for (const ContactCache::ContactEvent& rEvent : a_rContacts.GetEvents()) {
+			if (rEvent.type != ContactCache::CONTACT_EVENT_TYPE_END) {
+				pairs.push_back(MakeSlotPair(rEvent.first.uiIndex, rEvent.second.uiIndex));
+			} else if (!a_rSchedule.IsDue(a_uiTick, rEvent.first.uiIndex) &&
+				!a_rSchedule.IsDue(a_uiTick, rEvent.second.uiIndex)) {
+				++a_rUncheckedEndCount;
+			}
+		}
+
+		std::sort(pairs.begin(), pairs.end());
+		return pairs;
+	}
+}
+
+bool ContactTests::CheckStaggeredContactsMatchBruteForce() {
+	Scene scene(Scene::SPATIAL_INDEX_TYPE_OCT_TREE, false, sceneExtent);
+	std::mt19937 randomGenerator(colliderCount);
+	std::uniform_real_distribution<float> randomPosition(-sceneExtent, sceneExtent);
+	std::uniform_real_distribution<float> randomStep(-colliderStep, colliderStep);
+	std::vector<TransformComponent*> transforms;
+	std::vector<ColliderComponent*> colliders;
+	std::vector<glm::vec3> steps;
+
+	for (unsigned int i = 0; i < colliderCount; ++i) {
+		const glm::vec3 position = i < colliderCount - stackedColliderCount ?
+			glm::vec3(randomPosition(randomGenerator), randomPosition(randomGenerator), randomPosition(randomGenerator)) :
+			glm::vec3(0.0f);
+		Entity* pEntity = scene.CreateEntity();
+		TransformComponent* pTransform = scene.CreateComponent<TransformComponent>(pEntity);
+		pTransform->SetMatrixRow(TransformComponent::MATRIX_ROW_POSITION_VECTOR, position);
+		pEntity->AddComponent(COMPONENT_TYPE_TRANSFORM, static_cast<Component*>(pTransform));
+		ColliderComponent* pCollider = scene.CreateComponent<ColliderComponent>(pEntity);
+		pCollider->SetDimensions(glm::vec3(0.33f, 0.15f, 0.33f));
+		pEntity->AddComponent(COMPONENT_TYPE_COLLIDER, pCollider);
+		transforms.push_back(pTransform);
+		colliders.push_back(pCollider);
+		steps.push_back(glm::vec3(randomStep(randomGenerator), randomStep(randomGenerator), randomStep(randomGenerator)));
+	}
+
+	const unsigned int interval = 9;
+	const StaggeredSchedule schedule(interval, interval);
+	SweepAndPrune broadphase;
+	ContactCache contacts;
+
+	for (ColliderComponent* pCollider : colliders) {
+		const PoolHandle handle = pCollider->GetEntity()->GetHandle();
+		broadphase.AddCollider(handle.uiIndex, pCollider, handle);
+	}
+
+	unsigned int mismatchCount = 0;
+	unsigned int checkedPairCount = 0;
+
+	for (unsigned int tick = 0; tick < movingUpdateCount + interval; ++tick) {
+		// The colliders stop moving for the last interval, so every contact has been checked since they last moved.
+		if (tick < movingUpdateCount) {
+			for (unsigned int i = 0; i < transforms.size(); ++i) {
+				transforms[i]->SetMatrixRow(TransformComponent::MATRIX_ROW_POSITION_VECTOR,
+					*transforms[i]->GetPosition() + steps[i]);
+			}
+		}
+
+		contacts.BeginUpdate();
+		broadphase.Update(contacts, &schedule, tick);
+		contacts.EndUpdate(&schedule, tick);
+		const std::vector<SlotPair> duePairs = FindOverlappingPairs(colliders, &schedule, tick);
+		unsigned int uncheckedEndCount = 0;
+		const std::vector<SlotPair> touchingPairs = GetTouchingPairs(contacts, schedule, tick, uncheckedEndCount);
+		checkedPairCount += duePairs.size();
+
+		if (touchingPairs != duePairs || uncheckedEndCount != 0 || contacts.GetContactCount() < duePairs.size()) {
+			++mismatchCount;
+		}
+	}
+
+	const unsigned int overlappingPairCount = FindOverlappingPairs(colliders, nullptr, 0).size();
+
+	if (contacts.GetContactCount() != overlappingPairCount) {
+		++mismatchCount;
+	}
+
+	std::printf("Contacts: %u staggered updates over %u colliders, %.1f due pairs listed each, %u contacts left for %u "
+		"overlapping pairs: %u mismatched\n",
+		movingUpdateCount + interval,
+		colliderCount,
+		static_cast<float>(checkedPairCount) / (movingUpdateCount + interval),
+		contacts.GetContactCount(),
+		overlappingPairCount,
+		mismatchCount);
+	return mismatchCount == 0;
+}
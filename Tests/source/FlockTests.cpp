@@ -0,0 +1,314 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+// File's header.
+#include "FlockTests.h"
+#include "BoundingBox.h"
+#include "BrainComponent.h"
+#include "ColliderComponent.h"
+#include "Entity.h"
+#include "FlockKernels.h"
+#include "FlockSystem.h"
+#include "glm/glm.hpp"
+#include "Scene.h"
+#include "StaggeredSchedule.h"
+#include "TransformComponent.h"
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace {
+	/// <summary>
+	/// Matches the neighbour distance used by the boids' brains.
+	/// </summary>
+	const float neighbourDistance = 8.0f;
+	/// <summary>
+	/// The width, height, and depth of the application's scene, as measured outward from its centre.
+	/// </summary>
+	const float applicationSceneExtent = 10.0f;
+
+	/// <summary>
+	/// Boids scattered randomly around a scene that's the same size as the application's, stored the way the flock
+	/// system stores them.
+	/// </summary>
+	struct KernelBoids {
+		KernelBoids(unsigned int a_uiCount,
+			unsigned int a_uiSeed) : positions(),
+			velocities(),
+			dimensions(a_uiCount, glm::vec3(0.33f, 0.15f, 0.33f)) {
+			std::mt19937 randomGenerator(a_uiSeed);
+			std::uniform_real_distribution<float> randomPosition(-applicationSceneExtent, applicationSceneExtent);
+			std::uniform_real_distribution<float> randomVelocity(-1.0f, 1.0f);
+
+			for (unsigned int i = 0; i < a_uiCount; ++i) {
+				positions.push_back(glm::vec3(randomPosition(randomGenerator),
+					randomPosition(randomGenerator),
+					randomPosition(randomGenerator)));
+				velocities.push_back(glm::vec3(randomVelocity(randomGenerator),
+					randomVelocity(randomGenerator),
+					randomVelocity(randomGenerator)));
+			}
+
+			// Put some boids on top of each other so that touching boids are checked too.
+			for (unsigned int i = 1; i < a_uiCount; i += 37) {
+				positions[i] = positions[i - 1];
+			}
+		}
+
+		FlockKernels::Neighbourhood GetNeighbourhood(unsigned int a_uiBoid) const {
+			const FlockKernels::Neighbourhood neighbourhood = {
+				positions[a_uiBoid],
+				glm::vec3(neighbourDistance),
+				dimensions[a_uiBoid],
+				a_uiBoid
+			};
+			return neighbourhood;
+		}
+
+		std::vector<glm::vec3> positions;
+		std::vector<glm::vec3> velocities;
+		std::vector<glm::vec3> dimensions;
+	};
+
+	/// <summary>
+	/// Fills a scene with boids that each steer by their own brain, in the same places and moving at the same
+	/// velocities as a set of kernel boids.
+	/// </summary>
+	/// <returns> The boids, in the same order as the kernel boids. </returns>
+	std::vector<Entity*> AddBrainBoids(Scene& a_rScene,
+		const KernelBoids& a_rBoids) {
+		std::vector<Entity*> boids;
+
+		for (unsigned int i = 0; i < a_rBoids.positions.size(); ++i) {
+			Entity* pBoid = a_rScene.CreateEntity();
+			TransformComponent* pTransform = a_rScene.CreateComponent<TransformComponent>(pBoid);
+			pTransform->SetMatrixRow(TransformComponent::MATRIX_ROW_POSITION_VECTOR, a_rBoids.positions[i]);
+			pBoid->AddComponent(COMPONENT_TYPE_TRANSFORM, static_cast<Component*>(pTransform));
+			ColliderComponent* pCollider = a_rScene.CreateComponent<ColliderComponent>(pBoid);
+			pCollider->SetDimensions(a_rBoids.dimensions[i]);
+			pBoid->AddComponent(COMPONENT_TYPE_COLLIDER, pCollider);
+			BrainComponent* pBrain = a_rScene.CreateComponent<BrainComponent>(pBoid, &a_rScene);
+			pBrain->SetVelocity(a_rBoids.velocities[i]);
+			pBoid->AddComponent(COMPONENT_TYPE_BRAIN, static_cast<Component*>(pBrain));
+			pBoid->SetTag("Boid");
+			a_rScene.AddEntity(pBoid);
+			boids.push_back(pBoid);
+		}
+
+		return boids;
+	}
+
+	/// <summary>
+	/// Fills a flock system with boids scattered randomly around a scene that's the same size as the application's.
+	/// </summary>
+	void AddRandomBoids(FlockSystem& a_rFlockSystem,
+		unsigned int a_uiBoidCount) {
+		const glm::vec3 boidDimensions(0.33f, 0.15f, 0.33f);
+		std::mt19937 randomGenerator(a_uiBoidCount);
+		std::uniform_real_distribution<float> randomPosition(-applicationSceneExtent, applicationSceneExtent);
+
+		for (unsigned int i = 0; i < a_uiBoidCount; ++i) {
+			a_rFlockSystem.AddBoid(nullptr,
+				glm::vec3(randomPosition(randomGenerator),
+					randomPosition(randomGenerator),
+					randomPosition(randomGenerator)),
+				glm::vec3(0.0f),
+				boidDimensions);
+		}
+	}
+}
+
+bool FlockTests::CheckKernelsMatchScalar() {
+	const unsigned int boidCount = 1000;
+	const unsigned int maximumRunLength = 35;
+	const KernelBoids boids(boidCount, 1);
+	std::vector<unsigned int> scalarTouchingBoids(maximumRunLength);
+	std::vector<unsigned int> touchingBoids(maximumRunLength);
+	bool allMatched = true;
+	std::printf("Flock kernels: %s selected\n",
+		FlockKernels::GetInstructionSetName(FlockKernels::GetInstructionSet()));
+
+	for (unsigned int instructionSet = FlockKernels::INSTRUCTION_SET_SSE2;
+		instructionSet < FlockKernels::INSTRUCTION_SET_COUNT;
+		++instructionSet) {
+		const FlockKernels::INSTRUCTION_SET set = static_cast<FlockKernels::INSTRUCTION_SET>(instructionSet);
+
+		if (!FlockKernels::IsSupported(set)) {
+			std::printf("%-8s not supported\n", FlockKernels::GetInstructionSetName(set));
+			continue;
+		}
+
+		unsigned int mismatchCount = 0;
+		float largestError = 0.0f;
+		unsigned int checkCount = 0;
+
+		for (unsigned int boid = 0; boid < boidCount; boid += 7) {
+			for (unsigned int runLength = 0; runLength <= maximumRunLength; ++runLength) {
+				// Start the run just before the boid so that it's sometimes inside its own run.
+				const unsigned int firstBoid = std::min(boid >= 3 ? boid - 3 : 0, boidCount - runLength);
+				const FlockKernels::Neighbourhood neighbourhood = boids.GetNeighbourhood(boid);
+				glm::vec3 scalarAlignment(0.0f);
+				glm::vec3 scalarCohesion(0.0f);
+				glm::vec3 alignment(0.0f);
+				glm::vec3 cohesion(0.0f);
+				const unsigned int scalarTouchingCount =
+					FlockKernels::AccumulateNeighbours(FlockKernels::INSTRUCTION_SET_SCALAR,
+						neighbourhood,
+						boids.positions.data(),
+						boids.velocities.data(),
+						boids.dimensions.data(),
+						firstBoid,
+						firstBoid + runLength,
+						scalarAlignment,
+						scalarCohesion,
+						scalarTouchingBoids.data());
+				const unsigned int touchingCount = FlockKernels::AccumulateNeighbours(set,
+					neighbourhood,
+					boids.positions.data(),
+					boids.velocities.data(),
+					boids.dimensions.data(),
+					firstBoid,
+					firstBoid + runLength,
+					alignment,
+					cohesion,
+					touchingBoids.data());
+				// Each of the values that are added is at most 20 units long, so the sums can only drift from each
+				// other by a few rounding errors of that size per value.
+				const float tolerance = 1e-5f * 20.0f * (runLength + 1);
+				const float error = std::max(glm::length(alignment - scalarAlignment),
+					glm::length(cohesion - scalarCohesion));
+				largestError = std::max(largestError, error);
+				++checkCount;
+
+				if (error > tolerance ||
+					touchingCount != scalarTouchingCount ||
+					!std::equal(touchingBoids.begin(),
+						touchingBoids.begin() + touchingCount,
+						scalarTouchingBoids.begin())) {
+					++mismatchCount;
+				}
+			}
+		}
+
+		std::printf("%-8s %6u runs checked against scalar: %u mismatched (largest error %g)\n",
+			FlockKernels::GetInstructionSetName(set),
+			checkCount,
+			mismatchCount,
+			largestError);
+		allMatched = allMatched && mismatchCount == 0;
+	}
+
+	return allMatched;
+}
+
+bool FlockTests::CheckKernelsMatchBrains() {
+	const unsigned int boidCount = 1000;
+	const KernelBoids boids(boidCount, 1);
+	Scene scene(Scene::SPATIAL_INDEX_TYPE_OCT_TREE, false, applicationSceneExtent);
+	const std::vector<Entity*> brainBoids = AddBrainBoids(scene, boids);
+	std::vector<unsigned int> touchingBoids(boidCount);
+	pEntityVector nearbyEntities;
+	bool allMatched = brainBoids.size() == boidCount;
+
+	for (unsigned int instructionSet = FlockKernels::INSTRUCTION_SET_SCALAR;
+		instructionSet < FlockKernels::INSTRUCTION_SET_COUNT;
+		++instructionSet) {
+		const FlockKernels::INSTRUCTION_SET set = static_cast<FlockKernels::INSTRUCTION_SET>(instructionSet);
+
+		if (!FlockKernels::IsSupported(set)) {
+			std::printf("%-8s not supported\n", FlockKernels::GetInstructionSetName(set));
+			continue;
+		}
+
+		unsigned int mismatchCount = 0;
+		float largestError = 0.0f;
+
+		for (unsigned int boid = 0; boid < brainBoids.size(); ++boid) {
+			const BrainComponent* pBrain = static_cast<BrainComponent*>(brainBoids[boid]->GetComponentOfType(COMPONENT_TYPE_BRAIN));
+			const glm::vec3 position = boids.positions[boid];
+			// Finds the brain's neighbours the same way that it does when it reevaluates.
+			nearbyEntities.clear();
+			scene.GetSpatialIndex().Query(BoundingBox<glm::vec3>(position, glm::vec3(pBrain->GetNeighbourDistance())),
+				nearbyEntities);
+			glm::vec3 separationSum(0.0f);
+			glm::vec3 velocitySum(0.0f);
+			glm::vec3 positionSum(0.0f);
+			const unsigned int neighbourCount = pBrain->AccumulateNeighbours(position,
+				nearbyEntities,
+				separationSum,
+				velocitySum,
+				positionSum);
+			glm::vec3 alignment(0.0f);
+			glm::vec3 cohesion(0.0f);
+			FlockKernels::AccumulateNeighbours(set,
+				boids.GetNeighbourhood(boid),
+				boids.positions.data(),
+				boids.velocities.data(),
+				boids.dimensions.data(),
+				0,
+				boidCount,
+				alignment,
+				cohesion,
+				touchingBoids.data());
+			// The brain adds up positions where the kernels add up directions, which only drift apart by a few
+			// rounding errors of the scene's width per neighbour.
+			const float tolerance = 1e-5f * 20.0f * (neighbourCount + 1);
+			const glm::vec3 brainCohesion = positionSum - position * static_cast<float>(neighbourCount);
+			const float error = std::max(glm::length(alignment - velocitySum), glm::length(cohesion - brainCohesion));
+			largestError = std::max(largestError, error);
+
+			if (error > tolerance) {
+				++mismatchCount;
+			}
+		}
+
+		std::printf("%-8s %6u boids checked against their brains: %u mismatched (largest error %g)\n",
+			FlockKernels::GetInstructionSetName(set),
+			boidCount,
+			mismatchCount,
+			largestError);
+		allMatched = allMatched && mismatchCount == 0;
+	}
+
+	return allMatched;
+}
+
+bool FlockTests::CheckThreadCountIsDeterministic() {
+	const unsigned int boidCount = 1000;
+	const unsigned int frameCount = 120;
+	const float deltaTime = 1.0f / 60.0f;
+	// Steers every boid on the same frame, as often as the scene does at its default tick rate.
+	const StaggeredSchedule steeringSchedule(9, 1);
+	const unsigned int seed = 1;
+	const std::vector<BoundingBox<glm::vec3>> obstacles;
+	const unsigned int threadCounts[] = { 1, std::max(std::thread::hardware_concurrency(), 2u) };
+	std::vector<glm::vec3> positions[2];
+
+	for (unsigned int i = 0; i < 2; ++i) {
+		FlockSystem flockSystem(BoundingBox<glm::vec3>(glm::vec3(0.0f), glm::vec3(applicationSceneExtent)),
+			neighbourDistance,
+			seed,
+			threadCounts[i]);
+		AddRandomBoids(flockSystem, boidCount);
+
+		for (unsigned int frame = 0; frame < frameCount; ++frame) {
+			flockSystem.Update(deltaTime, obstacles, &steeringSchedule, frame);
+		}
+
+		for (unsigned int boid = 0; boid < flockSystem.GetBoidCount(); ++boid) {
+			positions[i].push_back(flockSystem.GetPosition(boid));
+		}
+	}
+
+	const bool identical = positions[0] == positions[1];
+	std::printf("Flock system: %u boids, %u frames, 1 vs %u threads: %s\n",
+		boidCount,
+		frameCount,
+		threadCounts[1],
+		identical ? "identical" : "different");
+	return identical;
+}
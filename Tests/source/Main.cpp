@@ -0,0 +1,66 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+// Checks that the simulation's faster paths give the same results as its simpler ones. Exits with a non-zero code if
+// any check fails, so that CTest reports it.
+
+#include "BrainTests.h"
+#include "ContactTests.h"
+#include "FlockTests.h"
+#include "SnapshotTests.h"
+#include "SpatialIndexTests.h"
+#include <cstdio>
+#include <cstring>
+
+namespace {
+	/// <summary>
+	/// A named check that returns true if it passed.
+	/// </summary>
+	struct TestCase {
+		const char* pName;
+		bool (*pRun)();
+	};
+
+	const TestCase testCases[] = {
+		{ "SpatialIndexQueries", SpatialIndexTests::CheckQueriesMatchBruteForce },
+		{ "SpatialIndexNearestQueries", SpatialIndexTests::CheckNearestQueriesMatchBruteForce },
+		{ "SpatialIndexVolumeQueries", SpatialIndexTests::CheckVolumeQueriesMatchBruteForce },
+		{ "SnapshotCulling", SnapshotTests::CheckCellCullingMatchesModels },
+		{ "StaggeredContacts", ContactTests::CheckStaggeredContactsMatchBruteForce },
+		{ "FlockKernels", FlockTests::CheckKernelsMatchScalar },
+		{ "FlockKernelsMatchBrains", FlockTests::CheckKernelsMatchBrains },
+		{ "FlockSystemDeterminism", FlockTests::CheckThreadCountIsDeterministic },
+		{ "CellAggregateSteering", BrainTests::CheckCellAggregatesMatchExactSteering },
+		{ "MetricSteering", BrainTests::CheckMetricSteeringMatchesBaseline },
+		{ "TopologicalNeighbours", BrainTests::CheckTopologicalNeighboursExcludeSelf },
+		{ "NeighbourLists", BrainTests::CheckNeighbourListsMatchQueries }
+	};
+}
+
+int main(int argc, char* argv[]) {
+	// Runs only the check named by the first argument, or every check if there isn't one.
+	const char* pName = argc > 1 ? argv[1] : nullptr;
+	unsigned int runCount = 0;
+	unsigned int failureCount = 0;
+
+	for (const TestCase& rTestCase : testCases) {
+		if (pName && std::strcmp(pName, rTestCase.pName) != 0) {
+			continue;
+		}
+
+		std::printf("[ RUN  ] %s\n", rTestCase.pName);
+		const bool passed = rTestCase.pRun();
+		std::printf("[ %s ] %s\n", passed ? "PASS" : "FAIL", rTestCase.pName);
+		++runCount;
+		failureCount += passed ? 0 : 1;
+	}
+
+	if (runCount == 0) {
+		std::fprintf(stderr, "There's no check named %s.\n", pName);
+		return 1;
+	}
+
+	return failureCount == 0 ? 0 : 1;
+}
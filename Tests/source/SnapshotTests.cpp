@@ -0,0 +1,144 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+// File's header.
+#include "SnapshotTests.h"
+#include "BoundingBox.h"
+#include "DrawQueue.h"
+#include "Frustum.h"
+#include "glm/glm.hpp"
+#include "glm/gtc/matrix_transform.hpp"
+#include "SceneSnapshot.h"
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace {
+	/// <summary>
+	/// Remembers where each model that it's asked to draw was placed, rather than drawing it.
+	/// </summary>
+	class RecordingDrawQueue : public DrawQueue {
+	public:
+		virtual void AddModelInstance(Model* a_pModel,
+			const float* a_pModelMatrix) {
+			positions.push_back(glm::vec3(a_pModelMatrix[12], a_pModelMatrix[13], a_pModelMatrix[14]));
+		}
+
+		virtual void DrawModelInstances() {}
+		virtual void AddLine(const float*,
+			const float*,
+			const float*) {}
+		virtual void AddLineBox(const float*,
+			const float*,
+			const float*) {}
+		virtual void DrawLines() {}
+
+		std::vector<glm::vec3> positions;
+	};
+
+	/// <summary>
+	/// Orders positions so that two lists of the same positions can be compared.
+	/// </summary>
+	bool ComparePositions(const glm::vec3& a_rFirst,
+		const glm::vec3& a_rSecond) {
+		if (a_rFirst.x != a_rSecond.x) {
+			return a_rFirst.x < a_rSecond.x;
+		} else if (a_rFirst.y != a_rSecond.y) {
+			return a_rFirst.y < a_rSecond.y;
+		}
+
+		return a_rFirst.z < a_rSecond.z;
+	}
+}
+
+bool SnapshotTests::CheckCellCullingMatchesModels() {
+	const unsigned int modelCount = 5000;
+	const unsigned int viewCount = 100;
+	const float sceneExtent = 20.0f;
+	// Further than a boid moves in a step, so models cross the edges of the cells they're sorted into.
+	const float stepMovement = 4.0f;
+	const glm::vec3 modelExtents(0.33f, 0.15f, 0.33f);
+	std::mt19937 randomGenerator(modelCount);
+	std::uniform_real_distribution<float> randomPosition(-sceneExtent, sceneExtent);
+	std::uniform_real_distribution<float> randomMovement(-stepMovement, stepMovement);
+	std::uniform_real_distribution<float> randomFraction(0.0f, 1.0f);
+	SceneSnapshot previousSnapshot;
+	SceneSnapshot snapshot;
+	unsigned int mismatchCount = 0;
+	unsigned int drawnCount = 0;
+
+	for (unsigned int i = 0; i < modelCount; ++i) {
+		const glm::vec3 previousPosition(randomPosition(randomGenerator),
+			randomPosition(randomGenerator),
+			randomPosition(randomGenerator));
+		const glm::vec3 position = previousPosition + glm::vec3(randomMovement(randomGenerator),
+			randomMovement(randomGenerator),
+			randomMovement(randomGenerator));
+		const PoolHandle handle = { i, 1 };
+		glm::mat4 modelMatrix(1.0f);
+
+		// Every tenth entity has only just been added, so it has no previous position.
+		if (i % 10 != 0) {
+			modelMatrix[3] = glm::vec4(previousPosition, 1.0f);
+			previousSnapshot.AddModelInstance(handle, nullptr, modelMatrix, &modelExtents);
+		}
+
+		modelMatrix[3] = glm::vec4(position, 1.0f);
+		// Every hundredth model has nothing to test against the camera's view, so it's always drawn.
+		snapshot.AddModelInstance(handle, nullptr, modelMatrix, i % 100 == 1 ? nullptr : &modelExtents);
+	}
+
+	snapshot.SetPreviousStep(previousSnapshot);
+
+	for (unsigned int view = 0; view < viewCount; ++view) {
+		const glm::vec3 cameraPosition(randomPosition(randomGenerator),
+			randomPosition(randomGenerator),
+			randomPosition(randomGenerator));
+		const glm::vec3 target(randomPosition(randomGenerator),
+			randomPosition(randomGenerator),
+			randomPosition(randomGenerator));
+		const Frustum viewFrustum(glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 30.0f) *
+			glm::lookAt(cameraPosition, target, glm::vec3(0.0f, 1.0f, 0.0f)));
+		const float interpolation = randomFraction(randomGenerator);
+		RecordingDrawQueue cellQueue;
+		snapshot.Draw(&cellQueue, interpolation, &viewFrustum);
+		// Tests every model one at a time, by generating the same models again.
+		std::vector<glm::vec3> modelPositions;
+		std::mt19937 replayGenerator(modelCount);
+
+		for (unsigned int i = 0; i < modelCount; ++i) {
+			const glm::vec3 previousPosition(randomPosition(replayGenerator),
+				randomPosition(replayGenerator),
+				randomPosition(replayGenerator));
+			const glm::vec3 position = previousPosition + glm::vec3(randomMovement(replayGenerator),
+				randomMovement(replayGenerator),
+				randomMovement(replayGenerator));
+			const glm::vec3 drawnPosition = i % 10 == 0 ?
+				position :
+				previousPosition + (position - previousPosition) * interpolation;
+
+			if (i % 100 == 1 ||
+				viewFrustum.Classify(BoundingBox<glm::vec3>(drawnPosition, modelExtents)) != Frustum::CONTAINMENT_OUTSIDE) {
+				modelPositions.push_back(drawnPosition);
+			}
+		}
+
+		std::sort(cellQueue.positions.begin(), cellQueue.positions.end(), ComparePositions);
+		std::sort(modelPositions.begin(), modelPositions.end(), ComparePositions);
+		drawnCount += modelPositions.size();
+		const bool matched = cellQueue.positions == modelPositions;
+
+		mismatchCount += matched ? 0 : 1;
+	}
+
+	std::printf("Snapshots: %u views of %u models checked against testing each model: %u mismatched "
+		"(%.1f models drawn per view)\n",
+		viewCount,
+		modelCount,
+		mismatchCount,
+		static_cast<float>(drawnCount) / viewCount);
+	return mismatchCount == 0 && drawnCount > 0;
+}
@@ -0,0 +1,349 @@
+//////////////////////////////
+// Author: Liam Bansal
+// Date Created: 18/10/2026
+//////////////////////////////
+
+// File's header.
+#include "SpatialIndexTests.h"
+#include "Boundary.h"
+#include "BoundingBox.h"
+#include "glm/glm.hpp"
+#include "LinearOctTree.h"
+#include "OctTree.h"
+#include "SpatialHashGrid.h"
+#include "SpatialIndex.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace {
+	/// <summary>
+	/// An object for the indices to keep track of, which remembers where it's stored so results can be compared.
+	/// </summary>
+	struct TestObject {
+		unsigned int uiIndex;
+	};
+
+	typedef SpatialIndex<TestObject, glm::vec3> TestIndex;
+
+	/// <summary>
+	/// The width, height, and depth of the indices' area, as measured outward from its centre.
+	/// </summary>
+	const float areaExtent = 20.0f;
+	/// <summary>
+	/// How far objects may stray outside of the indices' area, as a fraction of its extent.
+	/// </summary>
+	const float strayFraction = 1.1f;
+	const unsigned int objectCount = 2000;
+	const unsigned int roundCount = 4;
+	const unsigned int queriesPerRound = 500;
+
+	/// <summary>
+	/// Objects that are mostly scattered across the area, with a third of them clumped together so that the indices
+	/// subdivide unevenly.
+	/// </summary>
+	struct TestObjects {
+		TestObjects(unsigned int a_uiSeed) : randomGenerator(a_uiSeed),
+			objects(objectCount),
+			positions(objectCount),
+			boundaries() {
+			std::uniform_real_distribution<float> randomPosition(-areaExtent, areaExtent);
+			std::uniform_real_distribution<float> randomClumpPosition(3.0f, 7.0f);
+			// Every boundary points at a position, so reserve the memory up front to keep the positions from moving.
+			boundaries.reserve(objectCount);
+
+			for (unsigned int i = 0; i < objectCount; ++i) {
+				objects[i].uiIndex = i;
+
+				if (i % 3 == 0) {
+					positions[i] = glm::vec3(randomClumpPosition(randomGenerator),
+						randomClumpPosition(randomGenerator),
+						randomClumpPosition(randomGenerator));
+				} else {
+					positions[i] = glm::vec3(randomPosition(randomGenerator),
+						randomPosition(randomGenerator),
+						randomPosition(randomGenerator));
+				}
+
+				// Objects of a few different sizes, so queries have to reach into neighbouring areas to find them.
+				boundaries.push_back(Boundary<glm::vec3>(&positions[i], glm::vec3(0.2f + (i % 4) * 0.3f)));
+			}
+		}
+
+		/// <summary>
+		/// Moves every object a short random distance, and a few of them far enough to cross several areas or leave
+		/// the indices' area.
+		/// </summary>
+		void Move() {
+			std::uniform_real_distribution<float> randomStep(-0.5f, 0.5f);
+			std::uniform_real_distribution<float> randomJump(-15.0f, 15.0f);
+
+			for (unsigned int i = 0; i < objectCount; ++i) {
+				std::uniform_real_distribution<float>& rDistribution = i % 50 == 1 ? randomJump : randomStep;
+				positions[i] = glm::clamp(positions[i] + glm::vec3(rDistribution(randomGenerator),
+					rDistribution(randomGenerator),
+					rDistribution(randomGenerator)),
+					glm::vec3(-areaExtent * strayFraction),
+					glm::vec3(areaExtent * strayFraction));
+			}
+		}
+
+		std::mt19937 randomGenerator;
+		std::vector<TestObject> objects;
+		std::vector<glm::vec3> positions;
+		std::vector<Boundary<glm::vec3>> boundaries;
+	};
+
+	/// <summary>
+	/// Creates one of each index, all covering the same area.
+	/// </summary>
+	void CreateIndices(std::unique_ptr<TestIndex> a_indices[3]) {
+		a_indices[0].reset(new OctTree<TestObject, glm::vec3>(4, glm::vec3(0.0f), glm::vec3(areaExtent)));
+		a_indices[1].reset(new SpatialHashGrid<TestObject, glm::vec3>(glm::vec3(0.0f), glm::vec3(areaExtent), 4.0f));
+		a_indices[2].reset(new LinearOctTree<TestObject, glm::vec3>(4, glm::vec3(0.0f), glm::vec3(areaExtent)));
+	}
+
+	const char* const indexNames[3] = { "Oct-tree", "Hash grid", "Linear oct-tree" };
+
+	/// <summary>
+	/// A box that classifies other boxes the way a frustum does, so the oct-tree's volume queries can be checked
+	/// without a camera.
+	/// </summary>
+	struct BoxVolume {
+		enum CONTAINMENT {
+			CONTAINMENT_OUTSIDE,
+			CONTAINMENT_INTERSECTING,
+			CONTAINMENT_INSIDE,
+			CONTAINMENT_COUNT
+		};
+
+		CONTAINMENT Classify(const BoundingBox<glm::vec3>& a_rBox) const {
+			if (!box.Overlaps(a_rBox)) {
+				return CONTAINMENT_OUTSIDE;
+			} else if (box.Contains(a_rBox.GetPosition() - a_rBox.GetDimensions()) &&
+				box.Contains(a_rBox.GetPosition() + a_rBox.GetDimensions())) {
+				return CONTAINMENT_INSIDE;
+			}
+
+			return CONTAINMENT_INTERSECTING;
+		}
+
+		BoundingBox<glm::vec3> box;
+	};
+}
+
+bool SpatialIndexTests::CheckQueriesMatchBruteForce() {
+	TestObjects testObjects(1);
+	std::unique_ptr<TestIndex> indices[3];
+	CreateIndices(indices);
+	std::vector<bool> registered(objectCount, true);
+	std::mt19937 randomGenerator(2);
+	std::uniform_real_distribution<float> randomCentre(-areaExtent, areaExtent);
+	std::uniform_real_distribution<float> randomExtent(0.5f, 10.0f);
+	std::vector<TestObject*> found;
+	std::vector<unsigned int> foundIndices;
+	std::vector<unsigned int> expectedIndices;
+	unsigned int mismatchCounts[3] = {};
+	unsigned int checkCount = 0;
+
+	for (std::unique_ptr<TestIndex>& rIndex : indices) {
+		for (unsigned int i = 0; i < objectCount; ++i) {
+			rIndex->InsertObject(&testObjects.objects[i], testObjects.boundaries[i]);
+		}
+
+		rIndex->Update();
+	}
+
+	// Queries the indices with random volumes and compares them against checking every registered object.
+	auto checkQueries = [&]() {
+		for (unsigned int query = 0; query < queriesPerRound; ++query) {
+			const BoundingBox<glm::vec3> volume(glm::vec3(randomCentre(randomGenerator),
+				randomCentre(randomGenerator),
+				randomCentre(randomGenerator)),
+				glm::vec3(randomExtent(randomGenerator)));
+			expectedIndices.clear();
+
+			for (unsigned int i = 0; i < objectCount; ++i) {
+				if (registered[i] && volume.Overlaps(testObjects.boundaries[i].GetBoundingBox())) {
+					expectedIndices.push_back(i);
+				}
+			}
+
+			++checkCount;
+
+			for (unsigned int index = 0; index < 3; ++index) {
+				found.clear();
+				indices[index]->Query(volume, found);
+				foundIndices.clear();
+
+				for (const TestObject* pObject : found) {
+					foundIndices.push_back(pObject->uiIndex);
+				}
+
+				std::sort(foundIndices.begin(), foundIndices.end());
+
+				if (foundIndices != expectedIndices) {
+					++mismatchCounts[index];
+				}
+			}
+		}
+	};
+
+	for (unsigned int round = 0; round < roundCount; ++round) {
+		testObjects.Move();
+
+		for (std::unique_ptr<TestIndex>& rIndex : indices) {
+			rIndex->Update();
+		}
+
+		checkQueries();
+
+		// Removed objects must stop being found straight away, before the indices are next updated.
+		for (unsigned int i = round; i < objectCount; i += 7 * roundCount) {
+			registered[i] = false;
+
+			for (std::unique_ptr<TestIndex>& rIndex : indices) {
+				rIndex->RemoveObject(&testObjects.objects[i]);
+			}
+		}
+
+		checkQueries();
+	}
+
+	bool allMatched = true;
+
+	for (unsigned int index = 0; index < 3; ++index) {
+		std::printf("%-16s %6u volume queries checked: %u mismatched\n", indexNames[index], checkCount, mismatchCounts[index]);
+		allMatched = allMatched && mismatchCounts[index] == 0;
+	}
+
+	return allMatched;
+}
+
+bool SpatialIndexTests::CheckNearestQueriesMatchBruteForce() {
+	TestObjects testObjects(3);
+	std::unique_ptr<TestIndex> indices[3];
+	CreateIndices(indices);
+	std::mt19937 randomGenerator(4);
+	std::uniform_real_distribution<float> randomPosition(-areaExtent * 1.3f, areaExtent * 1.3f);
+	std::uniform_int_distribution<unsigned int> randomObject(0, objectCount - 1);
+	// Includes counts of none, one, and more than there are objects.
+	const unsigned int nearestCounts[] = { 0, 1, 7, 8, 20, objectCount + 1 };
+	const unsigned int nearestCountCount = sizeof(nearestCounts) / sizeof(nearestCounts[0]);
+	std::vector<TestIndex::NearestObject> nearestObjects;
+	std::vector<float> squaredDistances(objectCount);
+	unsigned int mismatchCounts[3] = {};
+	unsigned int checkCount = 0;
+
+	for (std::unique_ptr<TestIndex>& rIndex : indices) {
+		for (unsigned int i = 0; i < objectCount; ++i) {
+			rIndex->InsertObject(&testObjects.objects[i], testObjects.boundaries[i]);
+		}
+
+		rIndex->Update();
+	}
+
+	for (unsigned int round = 0; round < roundCount; ++round) {
+		testObjects.Move();
+
+		for (std::unique_ptr<TestIndex>& rIndex : indices) {
+			rIndex->Update();
+		}
+
+		for (unsigned int query = 0; query < queriesPerRound; ++query) {
+			// Mostly searches around objects, as boids do, and sometimes around positions outside of the area.
+			const glm::vec3 position = query % 10 == 0 ?
+				glm::vec3(randomPosition(randomGenerator), randomPosition(randomGenerator), randomPosition(randomGenerator)) :
+				testObjects.positions[randomObject(randomGenerator)];
+			const unsigned int count = nearestCounts[query % nearestCountCount];
+
+			for (unsigned int i = 0; i < objectCount; ++i) {
+				const glm::vec3 offset = testObjects.positions[i] - position;
+				squaredDistances[i] = glm::dot(offset, offset);
+			}
+
+			std::sort(squaredDistances.begin(), squaredDistances.end());
+			const unsigned int expectedCount = std::min(count, objectCount);
+			++checkCount;
+
+			for (unsigned int index = 0; index < 3; ++index) {
+				indices[index]->QueryNearest(position, count, nearestObjects);
+				// Objects that are equally far away can be found in any order, so only the distances are compared.
+				bool matched = nearestObjects.size() == expectedCount;
+
+				for (unsigned int i = 0; matched && i < nearestObjects.size(); ++i) {
+					const glm::vec3 offset = testObjects.positions[nearestObjects[i].pObject->uiIndex] - position;
+					const float tolerance = 1e-3f;
+					matched = std::abs(nearestObjects[i].fSquaredDistance - squaredDistances[i]) <= tolerance &&
+						std::abs(glm::dot(offset, offset) - nearestObjects[i].fSquaredDistance) <= tolerance;
+				}
+
+				if (!matched) {
+					++mismatchCounts[index];
+				}
+			}
+		}
+	}
+
+	bool allMatched = true;
+
+	for (unsigned int index = 0; index < 3; ++index) {
+		std::printf("%-16s %6u nearest queries checked: %u mismatched\n", indexNames[index], checkCount, mismatchCounts[index]);
+		allMatched = allMatched && mismatchCounts[index] == 0;
+	}
+
+	return allMatched;
+}
+
+bool SpatialIndexTests::CheckVolumeQueriesMatchBruteForce() {
+	TestObjects testObjects(5);
+	OctTree<TestObject, glm::vec3> octTree(4, glm::vec3(0.0f), glm::vec3(areaExtent));
+	std::mt19937 randomGenerator(6);
+	// Reaches past the area on every side, where only the objects that have left it can be found.
+	std::uniform_real_distribution<float> randomCentre(-areaExtent * 1.3f, areaExtent * 1.3f);
+	std::uniform_real_distribution<float> randomExtent(0.5f, 10.0f);
+	std::vector<unsigned int> foundIndices;
+	std::vector<unsigned int> expectedIndices;
+	unsigned int mismatchCount = 0;
+	unsigned int checkCount = 0;
+
+	for (unsigned int i = 0; i < objectCount; ++i) {
+		octTree.InsertObject(&testObjects.objects[i], testObjects.boundaries[i]);
+	}
+
+	for (unsigned int round = 0; round < roundCount; ++round) {
+		testObjects.Move();
+		octTree.Update();
+
+		for (unsigned int query = 0; query < queriesPerRound; ++query) {
+			const BoxVolume volume = { BoundingBox<glm::vec3>(glm::vec3(randomCentre(randomGenerator),
+				randomCentre(randomGenerator),
+				randomCentre(randomGenerator)),
+				glm::vec3(randomExtent(randomGenerator))) };
+			expectedIndices.clear();
+
+			for (unsigned int i = 0; i < objectCount; ++i) {
+				if (volume.box.Overlaps(testObjects.boundaries[i].GetBoundingBox())) {
+					expectedIndices.push_back(i);
+				}
+			}
+
+			foundIndices.clear();
+			octTree.QueryVolume(volume, [&foundIndices](TestObject* a_pObject) {
+				foundIndices.push_back(a_pObject->uiIndex);
+			});
+			std::sort(foundIndices.begin(), foundIndices.end());
+			++checkCount;
+
+			if (foundIndices != expectedIndices) {
+				++mismatchCount;
+			}
+		}
+	}
+
+	std::printf("%-16s %6u frustum-style queries checked: %u mismatched\n", indexNames[0], checkCount, mismatchCount);
+	return mismatchCount == 0;
+}